@@ -338,6 +338,18 @@ else ()
     endif ()
 endif ()
 
+# ----------------------------------------------------------------------------
+# Runtime SIMD dispatch
+# ----------------------------------------------------------------------------
+
+# The vectorised algorithms instantiate simd types wider than the compile flags allow and call them only from
+# functions compiled for the instruction set selected at runtime. GCC warns that passing such vectors by value changes
+# the ABI, which does not matter here since all of them are inlined into the dispatched kernels.
+if (CMAKE_CXX_COMPILER_ID STREQUAL "GNU" AND CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64")
+    set (SEQAN3_CXX_FLAGS "${SEQAN3_CXX_FLAGS} -Wno-psabi")
+    seqan3_config_print ("Runtime SIMD dispatch:      via -Wno-psabi")
+endif ()
+
 # ----------------------------------------------------------------------------
 # thread support (pthread, windows threads)
 # ----------------------------------------------------------------------------
@@ -33,6 +33,9 @@ namespace seqan3::align_cfg
  * the lower bound, or the band is not shifted out of the alignment matrix. If an invalid setting is detected, a
  * seqan3::invalid_alignment_configuration exception will be thrown.
  *
+ * The band can be combined with seqan3::align_cfg::vectorise. All sequence pairs computed in one simd vector share
+ * the band, while the sequences of every pair are sliced to the band individually.
+ *
  * ### Example
  *
  * \include test/snippet/alignment/configuration/align_cfg_band_example.cpp
@@ -0,0 +1,60 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::difference_recurrence configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A tag to select the alignment algorithm computing long global alignments with the difference recurrence.
+ * \ingroup alignment_configuration
+ */
+struct difference_recurrence_tag : public pipeable_config_element<difference_recurrence_tag, empty_type>
+{
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::difference_recurrence};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes long global alignments with the difference recurrence in 8 bit simd lanes.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * With this option, sequence pairs whose sequences are both at least 1024 symbols long are computed with the
+ * difference recurrence of Suzuki and Kasahara (Introducing difference recurrence relations for faster semi-global
+ * alignment of long sequences, 2018). It stores the differences between adjacent cells instead of their scores,
+ * which are bounded by the scoring scheme rather than by the sequence length, and thus computes the anti-diagonals
+ * of the alignment matrix in 8 bit simd lanes. The trace is stored for the computed cells, such that long sequence
+ * pairs can be aligned quickly within a band, e.g. multi-kilobase reads.
+ *
+ * The score, the coordinates and the aligned sequences are the same as without this option, but if several optimal
+ * alignments exist a different one might be reported. Shorter sequence pairs, bands that do not contain both ends
+ * of the alignment matrix and scoring schemes whose differences do not fit into 8 bits are computed with the default
+ * algorithm. This option can only be combined with the global alignment without seqan3::align_cfg::aligned_ends,
+ * and not with seqan3::align_cfg::debug, seqan3::align_cfg::linear_memory, seqan3::align_cfg::max_error,
+ * seqan3::align_cfg::vectorise, seqan3::align_cfg::wavefront and seqan3::align_cfg::x_drop.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_difference_recurrence_example.cpp
+ */
+inline constexpr detail::difference_recurrence_tag difference_recurrence{};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,60 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::linear_memory configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A tag to select the alignment algorithm computing the traceback in linear memory.
+ * \ingroup alignment_configuration
+ */
+struct linear_memory_tag : public pipeable_config_element<linear_memory_tag, empty_type>
+{
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::linear_memory};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the alignment in memory linear to the length of the second sequence.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The default alignment algorithm stores the trace matrix in order to compute the front coordinate and the
+ * alignment, which requires memory quadratic to the sequence lengths. For long sequences, e.g. when aligning two
+ * bacterial genomes, this quickly exceeds the available memory. With this option the alignment is computed with the
+ * divide-and-conquer algorithm of Myers and Miller (Optimal alignments in linear space, 1988), which recursively
+ * determines where the optimal alignment crosses the middle column of the alignment matrix from one forward and one
+ * reverse computation of the scores. Only two score columns over the second sequence are kept, at the cost of
+ * computing the scores about twice as often as the default algorithm.
+ *
+ * The computed alignment result is the same as without this option, i.e. the score, the coordinates and the
+ * aligned sequences can be requested with seqan3::align_cfg::result. If several optimal alignments exist a
+ * different one might be reported. This option can be combined with the global and the local alignment, but not
+ * with seqan3::align_cfg::aligned_ends, seqan3::align_cfg::band, seqan3::align_cfg::max_error and
+ * seqan3::align_cfg::vectorise.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_linear_memory_example.cpp
+ */
+inline constexpr detail::linear_memory_tag linear_memory{};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,55 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::vectorised_score_type_element.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/simd/concept.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/type_traits>
+
+namespace seqan3::detail
+{
+
+/*!\brief Configuration element fixing the width of the simd lanes used by the vectorised alignment algorithm.
+ * \ingroup alignment_configuration
+ * \tparam scalar_t The scalar type of a single simd lane; must model std::signed_integral.
+ * \tparam simd_t   The simd vector type over `scalar_t`. Defaults to the simd type of the instruction set enabled by
+ *                  the compiler flags.
+ *
+ * \details
+ *
+ * By default the vectorised alignment computes the scores in simd lanes of the score type selected by
+ * seqan3::align_cfg::result. If this element is present, the lanes have the type `scalar_t` instead, which changes
+ * the number of alignments computed in one simd vector. The scores are converted to the original score type
+ * when the alignment result is created. The simd vector type, and thereby the instruction set the algorithm is
+ * compiled for (see seqan3::detail::simd_instruction_set_of), is wrapped in std::type_identity to preserve the trivial
+ * type properties of the configuration element and can be accessed via the
+ * seqan3::detail::alignment_configuration_traits.
+ *
+ * This configuration element is only added internally by the seqan3::detail::alignment_configurator, which selects
+ * the simd vector type for the instruction set of the executing CPU.
+ */
+template <std::signed_integral scalar_t, simd_concept simd_t = simd_type_t<scalar_t>>
+struct vectorised_score_type_element :
+    public pipeable_config_element<vectorised_score_type_element<scalar_t, simd_t>, std::type_identity<simd_t>>
+{
+    static_assert(std::same_as<typename simd_traits<simd_t>::scalar_type, scalar_t>,
+                  "The scalar type of the simd vector type must be the lane type.");
+
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::vectorised_score_type};
+};
+
+} // namespace seqan3::detail
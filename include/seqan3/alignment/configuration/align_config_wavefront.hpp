@@ -0,0 +1,63 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::wavefront configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+
+namespace seqan3::detail
+{
+
+/*!\brief A tag to select the wavefront alignment algorithm.
+ * \ingroup alignment_configuration
+ */
+struct wavefront_tag : public pipeable_config_element<wavefront_tag, empty_type>
+{
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::wavefront};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3::align_cfg
+{
+
+/*!\brief Computes the global alignment with the wavefront alignment algorithm.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * The default alignment algorithm computes every cell of the alignment matrix, regardless of how similar the
+ * sequences are. The wavefront alignment algorithm (Marco-Sola et al., Fast gap-affine pairwise alignment using the
+ * wavefront algorithm, 2021) instead computes, for increasing penalties, the furthest reaching cell on every diagonal
+ * of the alignment matrix and follows runs of matches without computing them one by one. Its run time is
+ * proportional to the product of the sequence length and the alignment penalty, which makes it much faster than the
+ * default algorithm for highly similar sequences, e.g. when aligning reads against their reference region or
+ * comparing assembled haplotypes.
+ *
+ * The algorithm works on penalties instead of scores. The configured scores are converted such that the optimal
+ * alignments are the same, which requires a scoring scheme that assigns one score to all matches and a lower score
+ * to all mismatches, e.g. a seqan3::nucleotide_scoring_scheme. The computed alignment result is the same as without
+ * this option, i.e. the score, the coordinates and the aligned sequences can be requested with
+ * seqan3::align_cfg::result. If several optimal alignments exist a different one might be reported. This option can
+ * only be combined with the global alignment, and not with seqan3::align_cfg::aligned_ends, seqan3::align_cfg::band,
+ * seqan3::align_cfg::max_error, seqan3::align_cfg::vectorise, seqan3::align_cfg::linear_memory and
+ * seqan3::align_cfg::x_drop.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_wavefront_example.cpp
+ */
+inline constexpr detail::wavefront_tag wavefront{};
+
+} // namespace seqan3::align_cfg
@@ -0,0 +1,50 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::align_cfg::x_drop configuration.
+ */
+
+#pragma once
+
+#include <seqan3/alignment/configuration/detail.hpp>
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+
+namespace seqan3::align_cfg
+{
+/*!\brief Computes an extension alignment that terminates once the score drops by the given value below the best score.
+ * \ingroup alignment_configuration
+ *
+ * \details
+ *
+ * This configuration computes the alignment used for the seed extension of seed-and-extend algorithms, e.g. BLAST.
+ * The alignment starts at the begin of both sequences and ends at the cell with the best score, i.e. all gaps at the
+ * end of the sequences are free. Cells whose score is more than `x` below the best score found so far are pruned and
+ * not extended any further. Accordingly, only the region around the optimal extension is computed and the
+ * computation stops early as soon as all cells of a column are pruned, which makes the extension cost proportional to
+ * the aligned region instead of the lengths of the sequences.
+ *
+ * The computed score is a lower bound of the score of the unrestricted extension and equals it if the optimal
+ * extension never drops by more than `x` below the best score of its prefixes.
+ *
+ * This configuration can only be used together with the \ref seqan3::global_alignment "global alignment" and
+ * can compute the score and the back coordinate as well as the trivial front coordinate at the begin of both
+ * sequences. A seqan3::invalid_alignment_configuration exception will be thrown if the aligned sequences are
+ * requested or the given value is negative.
+ *
+ * ### Example
+ *
+ * \include test/snippet/alignment/configuration/align_cfg_x_drop_example.cpp
+ */
+struct x_drop : public pipeable_config_element<x_drop, int32_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::align_config_id id{detail::align_config_id::x_drop};
+};
+
+} // namespace seqan3::align_cfg
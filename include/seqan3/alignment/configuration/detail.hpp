@@ -27,14 +27,22 @@ enum struct align_config_id : uint8_t
     aligned_ends, //!< ID for the \ref seqan3::align_cfg::aligned_ends "aligned_ends" option.
     band,         //!< ID for the \ref seqan3::align_cfg::band "band" option.
     debug,        //!< ID for the \ref seqan3::align_cfg::debug "debug" option.
+    //!\brief ID for the \ref seqan3::align_cfg::difference_recurrence "difference_recurrence" option.
+    difference_recurrence,
     gap,          //!< ID for the \ref seqan3::align_cfg::gap "gap" option.
     global,       //!< ID for the \ref seqan3::global_alignment "global alignment" option.
+    //!\brief ID for the \ref seqan3::align_cfg::linear_memory "linear_memory" option.
+    linear_memory,
     local,        //!< ID for the \ref seqan3::local_alignment "local alignment" option.
     max_error,    //!< ID for the \ref seqan3::align_cfg::max_error "max_error" option.
     parallel,     //!< ID for the \ref seqan3::align_cfg::parallel "parallel" option.
     result,       //!< ID for the \ref seqan3::align_cfg::result "result" option.
     scoring,      //!< ID for the \ref seqan3::align_cfg::scoring "scoring" option.
     vectorise,    //!< ID for the \ref seqan3::align_cfg::vectorise "vectorise" option.
+    //!\brief ID for the internal \ref seqan3::detail::vectorised_score_type_element "vectorised_score_type" option.
+    vectorised_score_type,
+    wavefront,    //!< ID for the \ref seqan3::align_cfg::wavefront "wavefront" option.
+    x_drop,       //!< ID for the \ref seqan3::align_cfg::x_drop "x_drop" option.
     SIZE          //!< Represents the number of configuration elements.
 };
 
@@ -51,19 +59,24 @@ template <>
 inline constexpr std::array<std::array<bool, static_cast<uint8_t>(align_config_id::SIZE)>,
                             static_cast<uint8_t>(align_config_id::SIZE)> compatibility_table<align_config_id>
 {
-    {   //0  1  2  3  4  5  6  7  8  9 10 11
-        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  0: alignment_result_capture
-        { 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, //  1: aligned_ends
-        { 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  2: band
-        { 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, //  3: debug
-        { 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1}, //  4: gap
-        { 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1}, //  5: global
-        { 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1}, //  6: local
-        { 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1}, //  7: max_error
-        { 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1}, //  8: parallel
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1}, //  9: result
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1}, // 10: scoring
-        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0}  // 11: vectorise
+    {   //0  1  2  3  4  5  6  7  8  9 10 11 12 13 14 15 16
+        { 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  0: alignment_result_capture
+        { 1, 0, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0}, //  1: aligned_ends
+        { 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0}, //  2: band
+        { 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0}, //  3: debug
+        { 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0}, //  4: difference_recurrence
+        { 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, //  5: gap
+        { 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1}, //  6: global
+        { 1, 0, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0}, //  7: linear_memory
+        { 1, 0, 1, 1, 0, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0}, //  8: local
+        { 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0}, //  9: max_error
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1}, // 10: parallel
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1}, // 11: result
+        { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1}, // 12: scoring
+        { 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0}, // 13: vectorise
+        { 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0}, // 14: vectorised_score_type
+        { 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0}, // 15: wavefront
+        { 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0}  // 16: x_drop
     }
 };
 
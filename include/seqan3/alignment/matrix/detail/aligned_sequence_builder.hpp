@@ -191,6 +191,39 @@ public:
         std::tie(res.first_sequence_slice_positions.first, res.second_sequence_slice_positions.first) =
             std::pair<size_t, size_t>{trace_it.coordinate()};
 
+        return (*this)(res.first_sequence_slice_positions,
+                       res.second_sequence_slice_positions,
+                       trace_segments | std::views::reverse);
+    }
+
+    /*!\brief Builds the aligned sequences from the given trace segments.
+     * \tparam trace_segments_t The type of the trace segments; must model std::ranges::forward_range over
+     *                          std::pair<seqan3::detail::trace_directions, size_t>.
+     * \param[in] first_sequence_slice_positions  The begin and end position of the aligned slice of the first sequence.
+     * \param[in] second_sequence_slice_positions The begin and end position of the aligned slice of the second
+     *                                            sequence.
+     * \param[in] trace_segments                  The trace directions and their span in order from the begin to the
+     *                                            end of the alignment.
+     * \returns seqan3::detail::aligned_sequence_builder::result_type with the built alignment.
+     *
+     * \details
+     *
+     * This overload is used by alignment algorithms that do not store a trace matrix but compute the trace
+     * segments of the alignment directly, e.g. seqan3::detail::linear_memory_alignment_algorithm.
+     */
+    template <std::ranges::forward_range trace_segments_t>
+    result_type operator()(std::pair<size_t, size_t> const first_sequence_slice_positions,
+                           std::pair<size_t, size_t> const second_sequence_slice_positions,
+                           trace_segments_t && trace_segments)
+    {
+        static_assert(std::same_as<std::ranges::range_value_t<trace_segments_t>,
+                                   std::pair<trace_directions, size_t>>,
+                      "The value type of the trace segments must be std::pair<trace_directions, size_t>.");
+
+        result_type res{};
+        res.first_sequence_slice_positions = first_sequence_slice_positions;
+        res.second_sequence_slice_positions = second_sequence_slice_positions;
+
         assign_unaligned(std::get<0>(res.alignment),
                          fst_rng | views::slice(res.first_sequence_slice_positions.first,
                                                 res.first_sequence_slice_positions.second));
@@ -199,9 +232,7 @@ public:
                                                 res.second_sequence_slice_positions.second));
 
         // Now we need to insert the values.
-        fill_aligned_sequence(trace_segments | std::views::reverse,
-                              std::get<0>(res.alignment),
-                              std::get<1>(res.alignment));
+        fill_aligned_sequence(trace_segments, std::get<0>(res.alignment), std::get<1>(res.alignment));
 
         return res;
     }
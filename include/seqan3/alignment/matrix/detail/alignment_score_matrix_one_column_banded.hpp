@@ -113,6 +113,31 @@ public:
                                                        second_sequence_t && second,
                                                        static_band const & band,
                                                        score_t const initial_value = score_t{})
+    {
+        resize(first, second, band, initial_value);
+    }
+    //!\}
+
+    /*!\brief Reinitialises the matrix for the two given ranges and the band.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first          The first range.
+     * \param[in] second         The second range.
+     * \param[in] band           The seqan3::static_band in which to calculate the alignment.
+     * \param[in] initial_value  The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Leaves the matrix in the same state as constructing it from the given ranges and band. Reallocation happens
+     * only if the new band size exceeds the current capacity of the memory pool, which is never reduced.
+     */
+    template <std::ranges::forward_range first_sequence_t,
+              std::ranges::forward_range second_sequence_t>
+    constexpr void resize(first_sequence_t && first,
+                          second_sequence_t && second,
+                          static_band const & band,
+                          score_t const initial_value = score_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
@@ -123,9 +148,9 @@ public:
 
         band_size = band_col_index + band_row_index + 1;
         // Reserve one more cell to deal with last cell in the banded column which needs only the diagonal and up cell.
-        matrix_base_t::pool.resize(band_size + 1, element_type{initial_value, initial_value});
+        matrix_base_t::pool.assign(band_size + 1, element_type{initial_value, initial_value});
+        matrix_base_t::cache = {};
     }
-    //!\}
 
     //!\brief The column index where the upper bound of the band passes through.
     int32_t band_col_index{};
@@ -129,6 +129,31 @@ public:
                                                  second_sequence_t && second,
                                                  static_band const & band,
                                                  [[maybe_unused]] trace_t const initial_value = trace_t{})
+    {
+        resize(first, second, band, initial_value);
+    }
+    //!\}
+
+    /*!\brief Reinitialises the matrix for the two given ranges and the band.
+     * \tparam first_sequence_t  The first range type; must model std::ranges::forward_range.
+     * \tparam second_sequence_t The second range type; must model std::ranges::forward_range.
+     *
+     * \param[in] first         The first range.
+     * \param[in] second        The second range.
+     * \param[in] band          The seqan3::static_band in which to calculate the alignment.
+     * \param[in] initial_value The value to initialise the matrix with. Default initialised if not specified.
+     *
+     * \details
+     *
+     * Leaves the matrix in the same state as constructing it from the given ranges and band. Reallocation happens
+     * only if the new banded matrix exceeds the current capacity of the underlying memory, which is never reduced.
+     * If `coordinate_only` is set to `true`, nothing will be allocated.
+     */
+    template <std::ranges::forward_range first_sequence_t, std::ranges::forward_range second_sequence_t>
+    constexpr void resize(first_sequence_t && first,
+                          second_sequence_t && second,
+                          static_band const & band,
+                          [[maybe_unused]] trace_t const initial_value = trace_t{})
     {
         matrix_base_t::num_cols = static_cast<size_type>(std::ranges::distance(first) + 1);
         matrix_base_t::num_rows = static_cast<size_type>(std::ranges::distance(second) + 1);
@@ -140,12 +165,12 @@ public:
         // Reserve one more cell to deal with last cell in the banded column which needs only the diagonal and up cell.
         if constexpr (!coordinate_only)
         {
-            matrix_base_t::data = typename matrix_base_t::pool_type{number_rows{static_cast<size_type>(band_size)},
-                                                                    number_cols{matrix_base_t::num_cols}};
-            matrix_base_t::cache_left.resize(band_size + 1, initial_value);
+            matrix_base_t::data.resize(number_rows{static_cast<size_type>(band_size)},
+                                       number_cols{matrix_base_t::num_cols});
+            matrix_base_t::cache_left.assign(band_size + 1, initial_value);
+            matrix_base_t::cache_up = trace_t{};
         }
     }
-    //!\}
 
     //!\copydoc seqan3::detail::alignment_trace_matrix_full::trace_path
     auto trace_path(matrix_coordinate const & trace_begin)
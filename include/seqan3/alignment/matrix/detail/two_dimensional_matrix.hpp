@@ -185,6 +185,27 @@ public:
     }
     //!\}
 
+    /*!\brief Resizes the matrix to the given dimensions and assigns the given value to every element.
+     * \param row_dim The new row dimension (number of rows).
+     * \param col_dim The new column dimension (number of columns).
+     * \param value   The value to assign to every element. Value initialised if not specified.
+     *
+     * \details
+     *
+     * Reallocation happens only if the new number of elements exceeds the current capacity of the underlying storage.
+     * The capacity is never reduced, such that a matrix reused for several computations grows monotonically.
+     *
+     * ### Exception
+     *
+     * Basic exception guarantee. Might throw std::bad_alloc on reallocation.
+     */
+    void resize(number_rows const row_dim, number_cols const col_dim, value_type const value = value_type{})
+    {
+        this->row_dim = row_dim.get();
+        this->col_dim = col_dim.get();
+        storage.assign(row_dim.get() * col_dim.get(), value);
+    }
+
     /*!\brief Returns a reference to the element at the given coordinate.
      * \param[in] coordinate The two-dimensional coordinate to access.
      */
@@ -180,7 +180,7 @@ constexpr auto align_pairwise(sequence_t && sequences,
     using alignment_result_t = typename traits_t::alignment_result_type;
 
     auto indexed_sequence_chunk_view = views::zip(seq_view, std::views::iota(0))
-                                     | views::chunk(traits_t::alignments_per_vector);
+                                     | views::chunk(traits_t::runtime_alignments_per_vector());
 
     // Create a two-way executor for the alignment.
     detail::algorithm_executor_blocking executor{indexed_sequence_chunk_view,
@@ -12,9 +12,11 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <optional>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/alignment/configuration/align_config_band.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring.hpp>
@@ -107,6 +109,11 @@ private:
                                                   std::allocator<std::optional<trace_directions>>,
                                                   matrix_major_order::column>,
                            empty_type>;
+    //!\brief The type of the tracked range of the cell scores; only tracked if the lanes are narrower than the score
+    //!\      type, see seqan3::detail::alignment_configuration_traits::checks_lane_overflow.
+    using cell_score_range_t = std::conditional_t<traits_t::checks_lane_overflow,
+                                                  typename traits_t::score_type,
+                                                  empty_type>;
 
 public:
     /*!\name Constructors, destructor and assignment
@@ -203,24 +210,74 @@ public:
         static_assert(simd_concept<typename traits_t::score_type>, "Expected simd score type.");
         static_assert(simd_concept<typename traits_t::trace_type>, "Expected simd trace type.");
 
-        // Extract the batch of sequences for the first and the second sequence.
-        auto sequence1_range = indexed_sequence_pairs | views::get<0> | views::get<0>;
-        auto sequence2_range = indexed_sequence_pairs | views::get<0> | views::get<1>;
+        if constexpr (traits_t::checks_lane_overflow)
+        {
+            lowest_cell_score = simd::fill<typename traits_t::score_type>(0);
+            highest_cell_score = simd::fill<typename traits_t::score_type>(0);
+        }
+
+        if constexpr (traits_t::is_banded)
+        {
+            // Get the band and slice every sequence pair individually as in the scalar banded alignment, such that
+            // the band starts in the origin and ends in the sink of the alignment matrix of every lane.
+            auto const & band = seqan3::get<align_cfg::band>(*cfg_ptr).value;
 
-        // Initialise the find_optimum policy in the simd case.
-        this->initialise_find_optimum_policy(sequence1_range,
-                                             sequence2_range,
-                                             this->scoring_scheme.padding_match_score());
+            auto slice_sequence_pair = [&] (auto && sequence_pair)
+            {
+                using std::get;
+
+                check_valid_band_parameter(get<0>(sequence_pair), get<1>(sequence_pair), band);
+                return this->slice_sequences(get<0>(sequence_pair), get<1>(sequence_pair), band);
+            };
 
-        // Convert batch of sequences to sequence of simd vectors.
-        auto simd_sequences1 = convert_batch_of_sequences_to_simd_vector(sequence1_range);
-        auto simd_sequences2 = convert_batch_of_sequences_to_simd_vector(sequence2_range);
+            auto sequence_pairs = indexed_sequence_pairs | views::get<0>;
+            using sliced_sequence_pair_t = decltype(slice_sequence_pair(*std::ranges::begin(sequence_pairs)));
 
-        max_size_in_collection = std::pair{simd_sequences1.size(), simd_sequences2.size()};
-        // Reset the alignment state's optimum between executions of the alignment algorithm.
-        this->alignment_state.reset_optimum();
+            std::vector<sliced_sequence_pair_t> sliced_sequence_pairs{};
+            for (auto && sequence_pair : sequence_pairs)
+                sliced_sequence_pairs.push_back(slice_sequence_pair(sequence_pair));
 
-        compute_matrix(simd_sequences1, simd_sequences2);
+            // Extract the batch of sliced sequences for the first and the second sequence.
+            auto sequence1_range = sliced_sequence_pairs | views::get<0>;
+            auto sequence2_range = sliced_sequence_pairs | views::get<1>;
+
+            // Initialise the find_optimum policy in the simd case.
+            this->initialise_find_optimum_policy(sequence1_range,
+                                                 sequence2_range,
+                                                 this->scoring_scheme.padding_match_score(),
+                                                 band);
+
+            // Convert batch of sequences to sequence of simd vectors.
+            auto simd_sequences1 = convert_batch_of_sequences_to_simd_vector(sequence1_range);
+            auto simd_sequences2 = convert_batch_of_sequences_to_simd_vector(sequence2_range);
+
+            max_size_in_collection = std::pair{simd_sequences1.size(), simd_sequences2.size()};
+            // Reset the alignment state's optimum between executions of the alignment algorithm.
+            this->alignment_state.reset_optimum();
+
+            compute_matrix(simd_sequences1, simd_sequences2, band);
+        }
+        else
+        {
+            // Extract the batch of sequences for the first and the second sequence.
+            auto sequence1_range = indexed_sequence_pairs | views::get<0> | views::get<0>;
+            auto sequence2_range = indexed_sequence_pairs | views::get<0> | views::get<1>;
+
+            // Initialise the find_optimum policy in the simd case.
+            this->initialise_find_optimum_policy(sequence1_range,
+                                                 sequence2_range,
+                                                 this->scoring_scheme.padding_match_score());
+
+            // Convert batch of sequences to sequence of simd vectors.
+            auto simd_sequences1 = convert_batch_of_sequences_to_simd_vector(sequence1_range);
+            auto simd_sequences2 = convert_batch_of_sequences_to_simd_vector(sequence2_range);
+
+            max_size_in_collection = std::pair{simd_sequences1.size(), simd_sequences2.size()};
+            // Reset the alignment state's optimum between executions of the alignment algorithm.
+            this->alignment_state.reset_optimum();
+
+            compute_matrix(simd_sequences1, simd_sequences2);
+        }
 
         make_alignment_result(indexed_sequence_pairs, callback);
     }
@@ -422,7 +479,7 @@ private:
 
         // Allocate and initialise first column.
         this->allocate_matrix(sequence1, sequence2, band, this->alignment_state);
-        size_t last_row_index = this->score_matrix.band_row_index;
+        size_t last_row_index = this->score_matrix().band_row_index;
         initialise_first_alignment_column(sequence2 | views::take(last_row_index));
 
         // ----------------------------------------------------------------------------
@@ -430,7 +487,7 @@ private:
         // ----------------------------------------------------------------------------
 
         size_t sequence2_size = std::ranges::distance(sequence2);
-        for (auto const & seq1_value : sequence1 | views::take(this->score_matrix.band_col_index))
+        for (auto const & seq1_value : sequence1 | views::take(this->score_matrix().band_col_index))
         {
             compute_alignment_column<true>(seq1_value, sequence2 | views::take(++last_row_index));
             // Only if band reached last row of matrix the last cell might be tracked.
@@ -442,7 +499,7 @@ private:
         // ----------------------------------------------------------------------------
 
         size_t first_row_index = 0;
-        for (auto const & seq1_value : sequence1 | views::drop(this->score_matrix.band_col_index))
+        for (auto const & seq1_value : sequence1 | views::drop(this->score_matrix().band_col_index))
         {
             // In the second phase the band moves in every column one base down on the second sequence.
             compute_alignment_column<false>(seq1_value, sequence2 | views::slice(first_row_index++, ++last_row_index));
@@ -479,15 +536,22 @@ private:
         // Initialise first cell.
         alignment_column_it = alignment_column.begin();
         this->init_origin_cell(*alignment_column_it, this->alignment_state);
+        track_cell_score(*alignment_column_it);
 
         // Initialise the remaining cells of this column.
         for (auto it = std::ranges::begin(sequence2); it != std::ranges::end(sequence2); ++it)
+        {
             this->init_column_cell(*++alignment_column_it, this->alignment_state);
+            track_cell_score(*alignment_column_it);
+        }
 
         // Finalise the last cell of the initial column.
         bool at_last_row = true;
         if constexpr (traits_t::is_banded) // If the band reaches until the last row of the matrix.
-            at_last_row = static_cast<size_t>(this->score_matrix.band_row_index) == this->score_matrix.num_rows - 1;
+        {
+            auto const & score_matrix = this->score_matrix();
+            at_last_row = static_cast<size_t>(score_matrix.band_row_index) == score_matrix.num_rows - 1;
+        }
 
         finalise_last_cell_in_column(at_last_row);
     }
@@ -527,11 +591,38 @@ private:
                                           this->scoring_scheme.score(seq1_value, *seq2_it));
             ++seq2_it;
         }
+        track_cell_score(*alignment_column_it);
 
         for (; seq2_it != std::ranges::end(sequence2); ++seq2_it)
+        {
             this->compute_cell(*++alignment_column_it,
                                this->alignment_state,
                                this->scoring_scheme.score(seq1_value, *seq2_it));
+            track_cell_score(*alignment_column_it);
+        }
+    }
+
+    /*!\brief Tracks the range of the scores of every lane if the lanes are narrower than the score type.
+     * \tparam cell_t The type of the alignment matrix cell.
+     * \param[in] cell The computed cell.
+     *
+     * \details
+     *
+     * Every score of the alignment matrix is either computed from the score of a tracked cell by adding a single
+     * substitution or gap score, or it is bounded by the score of the cell it is used for. Hence, if all tracked
+     * scores of a lane keep a distance of seqan3::detail::alignment_configuration_traits::lane_overflow_margin to the
+     * limits of the lane type, no score of the lane has overflowed. Does nothing for all other configurations.
+     */
+    template <typename cell_t>
+    constexpr void track_cell_score([[maybe_unused]] cell_t const & cell) noexcept
+    {
+        if constexpr (traits_t::checks_lane_overflow)
+        {
+            auto const & [score_cell, trace_cell] = cell;
+
+            lowest_cell_score = (score_cell.current < lowest_cell_score) ? score_cell.current : lowest_cell_score;
+            highest_cell_score = (score_cell.current > highest_cell_score) ? score_cell.current : highest_cell_score;
+        }
     }
 
     /*!\brief Finalises the last cell of the current alignment column.
@@ -622,7 +713,7 @@ private:
                                                        row_index_type{this->alignment_state.optimum.row_index}};
             // At some point this needs to be refactored so that it is not necessary to adapt the coordinate.
             if constexpr (traits_t::is_banded)
-                res.back_coordinate.second += res.back_coordinate.first - this->trace_matrix.band_col_index;
+                res.back_coordinate.second += res.back_coordinate.first - this->trace_matrix().band_col_index;
         }
 
         if constexpr (traits_t::compute_front_coordinate)
@@ -631,7 +722,7 @@ private:
             aligned_sequence_builder builder{sequence1, sequence2};
             auto optimum_coordinate = alignment_coordinate{column_index_type{this->alignment_state.optimum.column_index},
                                                            row_index_type{this->alignment_state.optimum.row_index}};
-            auto trace_res = builder(this->trace_matrix.trace_path(optimum_coordinate));
+            auto trace_res = builder(this->trace_matrix().trace_path(optimum_coordinate));
             res.front_coordinate.first = trace_res.first_sequence_slice_positions.first;
             res.front_coordinate.second = trace_res.second_sequence_slice_positions.first;
 
@@ -673,7 +764,9 @@ private:
      * If the alignment is run in debug mode (see seqan3::align_cfg::debug) the debug score and optionally trace matrix
      * are stored in the alignment result as well.
      *
-     * Finally, the callback is invoked with each computed alignment result iteratively.
+     * Finally, the callback is invoked with each computed alignment result iteratively. If the simd lanes are narrower
+     * than the score type, the callback is not invoked for the lanes whose scores might have overflowed (see
+     * seqan3::detail::alignment_configuration_traits::checks_lane_overflow).
      */
     template <typename indexed_sequence_pair_range_t, typename callback_t>
     //!\cond
@@ -684,10 +777,27 @@ private:
     {
         using result_value_t = typename alignment_result_value_type_accessor<alignment_result_t>::type;
 
+        using scalar_t = typename traits_t::vectorised_score_type;
+
         size_t simd_index = 0;
         for (auto && [sequence_pairs, alignment_index] : index_sequence_pairs)
         {
             (void) sequence_pairs;
+
+            // The alignment of a lane whose scores might have overflowed is not reported, such that the
+            // seqan3::detail::adaptive_simd_alignment_algorithm recomputes it in wider lanes.
+            if constexpr (traits_t::checks_lane_overflow)
+            {
+                constexpr scalar_t margin = traits_t::lane_overflow_margin;
+
+                if (lowest_cell_score[simd_index] < std::numeric_limits<scalar_t>::lowest() + margin ||
+                    highest_cell_score[simd_index] > std::numeric_limits<scalar_t>::max() - margin)
+                {
+                    ++simd_index;
+                    continue;
+                }
+            }
+
             result_value_t res{};
             res.id = alignment_index;
 
@@ -698,6 +808,9 @@ private:
             {
                 res.back_coordinate.first = this->alignment_state.optimum.column_index[simd_index] ;
                 res.back_coordinate.second = this->alignment_state.optimum.row_index[simd_index];
+                // The row index is relative to the band, see the scalar banded alignment.
+                if constexpr (traits_t::is_banded)
+                    res.back_coordinate.second += res.back_coordinate.first - this->trace_matrix().band_col_index;
             }
 
             callback(std::move(res));
@@ -721,7 +834,7 @@ private:
 
         auto coord = get<1>(column.front()).coordinate;
         if constexpr (traits_t::is_banded)
-            coord.second += coord.first - this->score_matrix.band_col_index;
+            coord.second += coord.first - this->score_matrix().band_col_index;
 
         matrix_offset offset{row_index_type{static_cast<std::ptrdiff_t>(coord.second)},
                              column_index_type{static_cast<std::ptrdiff_t>(coord.first)}};
@@ -756,6 +869,10 @@ private:
     trace_debug_matrix_t trace_debug_matrix{};
     //!\brief The maximal size within the first and the second sequence collection.
     std::pair<size_t, size_t> max_size_in_collection{};
+    //!\brief The lowest score of the computed cells of every lane.
+    cell_score_range_t lowest_cell_score{};
+    //!\brief The highest score of the computed cells of every lane.
+    cell_score_range_t highest_cell_score{};
 };
 
 } // namespace seqan3::detail
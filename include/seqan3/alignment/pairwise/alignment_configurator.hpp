@@ -18,6 +18,7 @@
 #include <vector>
 
 #include <seqan3/alignment/configuration/align_config_alignment_result_capture.hpp>
+#include <seqan3/alignment/configuration/align_config_difference_recurrence.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_one_column.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_score_matrix_one_column_banded.hpp>
 #include <seqan3/alignment/matrix/detail/alignment_trace_matrix_full.hpp>
@@ -34,13 +35,21 @@
 #include <seqan3/alignment/pairwise/alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/align_result_selector.hpp>
 #include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/adaptive_simd_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/difference_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/linear_memory_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm_x_drop.hpp>
+#include <seqan3/alignment/pairwise/detail/striped_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/pairwise/detail/wavefront_alignment_algorithm.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/alignment/pairwise/edit_distance_algorithm.hpp>
 #include <seqan3/alignment/scoring/detail/simd_match_mismatch_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/detail/simd_matrix_scoring_scheme.hpp>
 #include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 #include <seqan3/core/concept/tuple.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
 #include <seqan3/core/simd/simd.hpp>
 #include <seqan3/core/type_traits/deferred_crtp_base.hpp>
 #include <seqan3/core/type_traits/lazy.hpp>
@@ -215,6 +224,8 @@ public:
      * \tparam sequences_t The range type containing the sequence pairs; must model std::ranges::forward_range.
      * \tparam config_t    The alignment configuration type; must be a specialisation of seqan3::configuration.
      * \param[in] cfg      The configuration object.
+     * \param[in] instruction_set The simd instruction set of the vectorised alignment. Defaults to the widest
+     *                            instruction set supported by the executing CPU.
      *
      * \returns a std::pair over std::function wrapper of the configured alignment algorithm and the adapted
      *          alignment configuration.
@@ -225,6 +236,9 @@ public:
      * During this process some runtime configurations are converted to static configurations if required.
      * In case of a missing configuration that has a default, e.g. the seqan3::align_cfg::result option, the
      * default version of this configuration element is added to the passed configuration object.
+     * The vectorised alignment computes as many sequence pairs in one simd vector as fit into the vectors of the given
+     * instruction set, see seqan3::detail::alignment_configuration_traits::runtime_alignments_per_vector. Its kernel
+     * is compiled for this instruction set, such that one binary uses the widest simd vectors of the executing CPU.
      * The return type is a std::pair over a std::function object and the adapted configuration object. Thus, the
      * calling function has access to the possibly modified configuration object.
      * The function object type is determined using the following type trait:
@@ -240,13 +254,14 @@ public:
     //!\cond
         requires is_type_specialisation_of_v<config_t, configuration>
     //!\endcond
-    static constexpr auto configure(config_t const & cfg)
+    static constexpr auto configure(config_t const & cfg,
+                                    simd_instruction_set const instruction_set = runtime_simd_instruction_set())
     {
 
         if constexpr (!config_t::template exists<align_cfg::result>())
         {
             // Set the default result value to be computed.
-            return configure<sequences_t>(cfg | align_cfg::result{with_score});
+            return configure<sequences_t>(cfg | align_cfg::result{with_score}, instruction_set);
         }
         else
         {
@@ -300,6 +315,29 @@ public:
             // Configure the algorithm
             // ----------------------------------------------------------------------------
 
+            // Compute the alignment in linear memory if requested.
+            if constexpr (config_t::template exists<detail::linear_memory_tag>())
+            {
+                using linear_memory_algorithm_t = linear_memory_alignment_algorithm<decltype(config_with_result_type)>;
+                return std::pair{function_wrapper_t{linear_memory_algorithm_t{config_with_result_type}},
+                                 config_with_result_type};
+            }
+
+            // Compute the global alignment with the wavefront alignment algorithm if requested.
+            if constexpr (config_t::template exists<detail::wavefront_tag>())
+            {
+                using wavefront_algorithm_t = wavefront_alignment_algorithm<decltype(config_with_result_type)>;
+                return std::pair{function_wrapper_t{wavefront_algorithm_t{config_with_result_type}},
+                                 config_with_result_type};
+            }
+
+            // Compute the extension alignment with the x-drop termination.
+            if constexpr (config_t::template exists<align_cfg::x_drop>())
+            {
+                return std::pair{configure_x_drop<function_wrapper_t>(config_with_result_type),
+                                 config_with_result_type};
+            }
+
             // Use default edit distance if gaps are not set.
             auto const & gaps = config_with_result_type.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
             auto const & scoring_scheme = get<align_cfg::scoring>(cfg).value;
@@ -335,9 +373,55 @@ public:
             if (config_t::template exists<align_cfg::max_error>())
                 throw invalid_alignment_configuration{"The align_cfg::max_error configuration is only allowed for "
                                                       "the specific edit distance computation."};
-            // Configure the alignment algorithm.
-            return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
-                             config_with_result_type};
+
+            using traits_t = alignment_configuration_traits<decltype(config_with_result_type)>;
+
+            if constexpr (traits_t::is_vectorised && !config_t::template exists<vectorised_score_type_element>())
+            {
+                // Select the simd vector type of the given instruction set and, for the adaptive score width, the
+                // width of the simd lanes for every batch of sequence pairs.
+                auto configure_instruction_set = [&] (auto instruction_set_constant) -> function_wrapper_t
+                {
+                    constexpr simd_instruction_set selected_set = decltype(instruction_set_constant)::value;
+
+                    auto configure_lane_width = [&] (auto scalar_type)
+                    {
+                        using scalar_t = typename decltype(scalar_type)::type;
+                        using simd_t = simd_type_for_t<scalar_t, selected_set>;
+                        return config_with_result_type | vectorised_score_type_element<scalar_t, simd_t>{};
+                    };
+
+                    if constexpr (traits_t::is_score_width_adaptive)
+                    {
+                        using adaptive_algorithm_t =
+                            adaptive_simd_alignment_algorithm<decltype(config_with_result_type),
+                                                              indexed_sequence_pair_chunk_t,
+                                                              callback_on_result_t>;
+                        using lane_algorithm_t = typename adaptive_algorithm_t::algorithm_type;
+
+                        auto configure_lane_algorithm = [&] (auto scalar_type)
+                        {
+                            return configure_scoring_scheme<lane_algorithm_t>(configure_lane_width(scalar_type));
+                        };
+
+                        return adaptive_algorithm_t{config_with_result_type, selected_set, configure_lane_algorithm};
+                    }
+                    else
+                    {
+                        using scalar_type_t = std::type_identity<typename traits_t::vectorised_score_type>;
+                        return configure_scoring_scheme<function_wrapper_t>(configure_lane_width(scalar_type_t{}));
+                    }
+                };
+
+                return std::pair{visit_simd_instruction_set(configure_instruction_set, instruction_set),
+                                 config_with_result_type};
+            }
+            else
+            {
+                // Configure the alignment algorithm.
+                return std::pair{configure_scoring_scheme<function_wrapper_t>(config_with_result_type),
+                                 config_with_result_type};
+            }
         }
     }
 
@@ -416,6 +500,38 @@ private:
         }
     }
 
+    /*!\brief Configures the extension alignment with the x-drop termination.
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t           The alignment configuration type.
+     * \param[in] cfg             The passed configuration object.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the aligned sequences are requested or the configured
+     *         x-drop value is negative.
+     */
+    template <typename function_wrapper_t, typename config_t>
+    static constexpr function_wrapper_t configure_x_drop(config_t const & cfg)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+
+        // ----------------------------------------------------------------------------
+        // Unsupported configurations
+        // ----------------------------------------------------------------------------
+
+        if (get<align_cfg::x_drop>(cfg).value < 0)
+            throw invalid_alignment_configuration{"The align_cfg::x_drop value must not be negative."};
+
+        if constexpr (traits_t::compute_sequence_alignment)
+        {
+            throw invalid_alignment_configuration{"The align_cfg::x_drop configuration does not support the "
+                                                  "computation of the aligned sequences."};
+        }
+        else
+        {
+            using algorithm_t = pairwise_alignment_algorithm_x_drop<config_t, policy_affine_gap_recursion<config_t>>;
+            return function_wrapper_t{algorithm_t{cfg}};
+        }
+    }
+
     /*!\brief Configures the dynamic programming matrix initialisation accoring to seqan3::align_cfg::aligned_ends
      *        settings.
      *
@@ -468,7 +584,9 @@ private:
      * The correct scoring scheme is selected based on the vectorisation mode. If no vectorisation is enabled, the
      * scoring scheme is the one configured in seqan3::align_config::scoring. If vectorisation is enabled, then the
      * appropriate scoring scheme for the vectorised alignment algorithm is selected. This involves checking whether the
-     * passed scoring scheme is a matrix or a simple scoring scheme, which has only mismatch and match costs.
+     * passed scoring scheme is a matrix or a simple scoring scheme, which has only mismatch and match costs:
+     * seqan3::nucleotide_scoring_scheme is vectorised with seqan3::detail::simd_match_mismatch_scoring_scheme and all
+     * other scoring schemes, e.g. seqan3::aminoacid_scoring_scheme, with seqan3::detail::simd_matrix_scoring_scheme.
      */
     template <typename function_wrapper_t, typename config_t>
     static constexpr function_wrapper_t configure_scoring_scheme(config_t const & cfg);
@@ -507,14 +625,86 @@ private:
             using matrix_policy_t = typename select_matrix_policy<traits_t>::type;
             using gap_policy_t = typename select_gap_policy<traits_t>::type;
 
-            return alignment_algorithm<config_t, matrix_policy_t, gap_policy_t, policies_t...>{cfg};
+            return make_intra_sequence_simd_algorithm<function_wrapper_t>(
+                cfg,
+                alignment_algorithm<config_t, matrix_policy_t, gap_policy_t, policies_t...>{cfg});
         }
         else  // Use new alignment algorithm implementation.
         {
             using optimum_tracker_policy_t = policy_optimum_tracker<config_t>;
             using gap_cost_policy_t = policy_affine_gap_recursion<config_t>;
 
-            return pairwise_alignment_algorithm<config_t, gap_cost_policy_t, optimum_tracker_policy_t>{cfg};
+            return make_intra_sequence_simd_algorithm<function_wrapper_t>(
+                cfg,
+                pairwise_alignment_algorithm<config_t, gap_cost_policy_t, optimum_tracker_policy_t>{cfg});
+        }
+    }
+
+    /*!\brief Wraps the scalar alignment algorithm into an algorithm that vectorises the computation of a single
+     *        sequence pair if the configuration allows it.
+     *
+     * \tparam function_wrapper_t The invocable alignment function type-erased via std::function.
+     * \tparam config_t The alignment configuration type.
+     * \tparam algorithm_t The type of the configured scalar alignment algorithm.
+     *
+     * \param[in] cfg The passed configuration object.
+     * \param[in] algorithm The configured scalar alignment algorithm.
+     *
+     * \returns the configured alignment algorithm.
+     *
+     * \details
+     *
+     * Large sequence pairs of scalar global alignments without free end-gaps are computed by the
+     * seqan3::detail::difference_alignment_algorithm if seqan3::align_cfg::difference_recurrence is configured. Large
+     * sequence pairs of scalar global alignments without free end-gaps and of scalar local alignments that only
+     * compute the score and optionally the back coordinate are otherwise computed by the
+     * seqan3::detail::striped_alignment_algorithm. The scalar algorithm is used for all other configurations and for
+     * the small sequence pairs. The vectorised algorithm is invoked via seqan3::detail::invoke_simd_kernel_of, such
+     * that it is compiled for the instruction set of its simd type.
+     */
+    template <typename function_wrapper_t, typename config_t, typename algorithm_t>
+    static constexpr function_wrapper_t make_intra_sequence_simd_algorithm(config_t const & cfg, algorithm_t algorithm)
+    {
+        using traits_t = alignment_configuration_traits<config_t>;
+        using score_t = typename traits_t::score_type;
+
+        // Use the difference recurrence if...
+        if constexpr (config_t::template exists<difference_recurrence_tag>() && // it was selected,
+                      !traits_t::is_vectorised &&                               // it is not vectorised,
+                      traits_t::is_global &&                                    // it is a global alignment,
+                      !traits_t::is_aligned_ends &&                             // it has no aligned ends configured,
+                      !traits_t::is_debug &&                                    // it does not run in debug mode,
+                      std::signed_integral<score_t> &&                          // the score type is a signed
+                      sizeof(score_t) >= 4)                                     // integral of at least 32 bits.
+        {
+            return difference_alignment_algorithm<config_t, algorithm_t>{cfg, std::move(algorithm)};
+        }
+        // Use the striped alignment if...
+        else if constexpr (!traits_t::is_vectorised &&          // it is not vectorised,
+                           !traits_t::is_aligned_ends &&        // it has no aligned ends configured,
+                           !traits_t::is_banded &&              // it is not banded,
+                           !traits_t::is_debug &&               // it does not run in debug mode,
+                           traits_t::result_type_rank <= 1 &&   // it computes at most the back coordinate and
+                           std::signed_integral<score_t> &&     // the score type is a signed integral of
+                           sizeof(score_t) >= 4)                // at least 32 bits, which cannot overflow in the
+                                                                // lazy-F loop.
+        {
+            return striped_alignment_algorithm<config_t, algorithm_t>{cfg, std::move(algorithm)};
+        }
+        // Compile the vectorised alignment for the instruction set of its simd type, which was selected at runtime.
+        else if constexpr (traits_t::is_vectorised)
+        {
+            return [algorithm = std::move(algorithm)] (auto && indexed_sequence_pairs, auto && callback) mutable
+            {
+                invoke_simd_kernel_of<score_t>([&] (auto)
+                {
+                    algorithm(indexed_sequence_pairs, callback);
+                });
+            };
+        }
+        else
+        {
+            return algorithm;
         }
     }
 };
@@ -525,13 +715,24 @@ constexpr function_wrapper_t alignment_configurator::configure_scoring_scheme(co
 {
     using traits_t = alignment_configuration_traits<config_t>;
 
+    // Nucleotide scoring schemes are vectorised with match and mismatch scores, all other scoring schemes, e.g.
+    // amino acid substitution matrices, look up the scores in a table.
+    static constexpr bool is_match_mismatch_scheme =
+        is_type_specialisation_of_v<remove_cvref_t<typename traits_t::scoring_scheme_type>, nucleotide_scoring_scheme>;
+
     using alignment_scoring_scheme_t =
-        lazy_conditional_t<traits_t::is_vectorised,
+        lazy_conditional_t<traits_t::is_vectorised && is_match_mismatch_scheme,
                            lazy<simd_match_mismatch_scoring_scheme,
                                 typename traits_t::score_type,
                                 typename traits_t::scoring_scheme_alphabet_type,
                                 typename traits_t::alignment_mode_type>,
-                                typename traits_t::scoring_scheme_type>;
+                           lazy_conditional_t<traits_t::is_vectorised,
+                                              lazy<simd_matrix_scoring_scheme,
+                                                   typename traits_t::score_type,
+                                                   typename traits_t::scoring_scheme_alphabet_type,
+                                                   typename traits_t::alignment_mode_type,
+                                                   remove_cvref_t<typename traits_t::scoring_scheme_type>>,
+                                              typename traits_t::scoring_scheme_type>>;
 
     using scoring_scheme_policy_t = deferred_crtp_base<scoring_scheme_policy, alignment_scoring_scheme_t>;
     return configure_free_ends_initialisation<function_wrapper_t, scoring_scheme_policy_t>(cfg);
@@ -0,0 +1,287 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::adaptive_simd_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised_score_type.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
+#include <seqan3/core/type_traits/function.hpp>
+#include <seqan3/range/views/type_reduce.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes a vectorised alignment in the narrowest simd lanes in which the scores do not overflow.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t     The configuration type; must be of type seqan3::configuration.
+ * \tparam indexed_sequence_pair_chunk_t The type of the chunk over indexed sequence pairs passed by the executor.
+ * \tparam callback_t                    The type of the callback invoked with every alignment result.
+ *
+ * \details
+ *
+ * The number of alignments computed in one simd vector is determined by the width of the simd lanes. With 8 bit
+ * lanes four times as many alignments fit into a vector than with 32 bit lanes, but only scores of small magnitudes
+ * can be represented. This algorithm wraps one vectorised alignment algorithm for every signed integral lane width up
+ * to the score type selected by seqan3::align_cfg::result (see seqan3::detail::vectorised_score_type_element).
+ *
+ * Every sequence pair is first computed in the narrowest lanes that can represent the coordinates of its alignment
+ * matrix. The algorithms of the narrower lanes track the range of the scores of every lane and do not report the
+ * alignments whose scores came too close to the limits of the lane type to exclude an overflow (see
+ * seqan3::detail::alignment_configuration_traits::checks_lane_overflow). Only these sequence pairs are recomputed in
+ * the next wider lanes. Hence, the lane width adapts to the actual scores instead of a bound on the scores of the
+ * worst case, at the cost of recomputing the sequence pairs with large scores. A narrower lane width is only used
+ * if no substitution score and no gap score exceeds half of the
+ * seqan3::detail::alignment_configuration_traits::lane_overflow_margin in magnitude. The widest lane width is the
+ * score type of the configuration and computes all remaining sequence pairs.
+ *
+ * The results are buffered and reported in the order of the chunk.
+ */
+template <typename alignment_configuration_t, typename indexed_sequence_pair_chunk_t, typename callback_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class adaptive_simd_alignment_algorithm
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The score type selected by the user, which is also the widest lane type.
+    using original_score_type = typename traits_type::original_score_type;
+
+    static_assert(traits_type::is_score_width_adaptive, "The configuration does not allow adaptive score widths.");
+
+    //!\brief The reference type of the chunk over indexed sequence pairs.
+    using indexed_sequence_pair_t = std::ranges::range_reference_t<indexed_sequence_pair_chunk_t>;
+    //!\brief The type of a sequence pair of the chunk.
+    using sequence_pair_t = decltype(std::get<0>(std::declval<indexed_sequence_pair_t &>()));
+    //!\brief An indexed sequence pair over views of the sequences, which are cheap to copy into a batch.
+    using batch_element_t =
+        std::pair<std::pair<decltype(views::type_reduce(std::get<0>(std::declval<sequence_pair_t>()))),
+                            decltype(views::type_reduce(std::get<1>(std::declval<sequence_pair_t>())))>,
+                  std::remove_cvref_t<decltype(std::get<1>(std::declval<indexed_sequence_pair_t &>()))>>;
+    //!\brief The type of a batch of sequence pairs passed to a wrapped algorithm.
+    using batch_type = std::span<batch_element_t>;
+    //!\brief The type of the alignment result.
+    using alignment_result_t =
+        std::remove_cvref_t<typename function_traits<callback_t>::template argument_type_at<0>>;
+
+    //!\brief The number of candidate lane widths, i.e. the widths of 8, 16, 32 and 64 bits up to the original width.
+    static constexpr size_t width_count = (sizeof(original_score_type) >= 2) +
+                                          (sizeof(original_score_type) >= 4) +
+                                          (sizeof(original_score_type) >= 8) + 1;
+
+public:
+    //!\brief The type of the wrapped vectorised alignment algorithm of a single lane width.
+    using algorithm_type = std::function<void(batch_type, callback_t)>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    adaptive_simd_alignment_algorithm() = default; //!< Defaulted.
+    adaptive_simd_alignment_algorithm(adaptive_simd_alignment_algorithm const &) = default; //!< Defaulted.
+    adaptive_simd_alignment_algorithm(adaptive_simd_alignment_algorithm &&) = default; //!< Defaulted.
+    adaptive_simd_alignment_algorithm & operator=(adaptive_simd_alignment_algorithm const &) = default; //!< Defaulted.
+    adaptive_simd_alignment_algorithm & operator=(adaptive_simd_alignment_algorithm &&) = default; //!< Defaulted.
+    ~adaptive_simd_alignment_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs the wrapped algorithms for all lane widths that can be used with the configured scores.
+     * \tparam algorithm_factory_t The type of the factory; must be invocable with std::type_identity over the lane
+     *                             type and must return
+     *                             seqan3::detail::adaptive_simd_alignment_algorithm::algorithm_type.
+     * \param[in] config          The alignment configuration.
+     * \param[in] instruction_set The simd instruction set the factory configures the algorithms for.
+     * \param[in] factory         The factory configuring the vectorised alignment algorithm for a given lane type.
+     *
+     * \details
+     *
+     * Algorithms are only configured for the narrower lane widths whose
+     * seqan3::detail::alignment_configuration_traits::lane_overflow_margin is at least twice the largest magnitude of
+     * a substitution score and of a gap score.
+     */
+    template <typename algorithm_factory_t>
+    adaptive_simd_alignment_algorithm(alignment_configuration_t const & config,
+                                      simd_instruction_set const instruction_set,
+                                      algorithm_factory_t && factory)
+    {
+        using alphabet_t = typename traits_type::scoring_scheme_alphabet_type;
+
+        auto const & scoring_scheme = seqan3::get<align_cfg::scoring>(config).value;
+        auto const & gaps = config.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}, gap_open_score{-10}});
+
+        auto magnitude = [] (auto const score) { return score < 0 ? -static_cast<int64_t>(score)
+                                                                  : static_cast<int64_t>(score); };
+
+        // The largest change of a score in one step of the recursion; padded symbols change it by 1.
+        int64_t largest_step = std::max<int64_t>(1, magnitude(gaps.get_gap_open_score()) +
+                                                    magnitude(gaps.get_gap_score()));
+        for (size_t rank1 = 0; rank1 < alphabet_size<alphabet_t>; ++rank1)
+        {
+            for (size_t rank2 = 0; rank2 < alphabet_size<alphabet_t>; ++rank2)
+            {
+                largest_step = std::max(largest_step,
+                                        magnitude(scoring_scheme.score(seqan3::assign_rank_to(rank1, alphabet_t{}),
+                                                                       seqan3::assign_rank_to(rank2, alphabet_t{}))));
+            }
+        }
+
+        size_t width = 0;
+        auto add_width = [&] (auto scalar_type)
+        {
+            using scalar_t = typename decltype(scalar_type)::type;
+            using lane_traits_t =
+                alignment_configuration_traits<decltype(config | vectorised_score_type_element<scalar_t>{})>;
+
+            lanes[width] = simd_length_for<scalar_t>(instruction_set);
+
+            if constexpr (std::same_as<scalar_t, original_score_type>)
+            {   // The fallback computes all sequence pairs as without adaptive widths.
+                max_length[width] = std::numeric_limits<size_t>::max();
+                algorithms[width] = factory(scalar_type);
+            }
+            else if (2 * largest_step <= lane_traits_t::lane_overflow_margin)
+            {   // The coordinates of the optimum are stored in the lanes as well.
+                max_length[width] = std::numeric_limits<scalar_t>::max() - 1;
+                algorithms[width] = factory(scalar_type);
+            }
+            else // The width cannot be used with the configured scores.
+            {
+                max_length[width] = 0;
+                lanes[width] = 0;
+            }
+
+            ++width;
+        };
+
+        add_width(std::type_identity<int8_t>{});
+        if constexpr (sizeof(original_score_type) > 2)
+            add_width(std::type_identity<int16_t>{});
+        if constexpr (sizeof(original_score_type) > 4)
+            add_width(std::type_identity<int32_t>{});
+        add_width(std::type_identity<original_score_type>{});
+
+        assert(width == width_count);
+    }
+    //!\}
+
+    /*!\brief Computes the alignments of the given chunk over indexed sequence pairs.
+     * \param[in] indexed_sequence_pairs The chunk over indexed sequence pairs.
+     * \param[in] callback               The callback invoked with every alignment result.
+     *
+     * \details
+     *
+     * Computes the sequence pairs in batches, starting with the narrowest lane width. Every lane width computes the
+     * sequence pairs that were not reported by a narrower lane width and whose coordinates it can represent.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     */
+    void operator()(indexed_sequence_pair_chunk_t indexed_sequence_pairs, callback_t callback)
+    {
+        chunk.clear();
+        sequence_lengths.clear();
+        for (auto && indexed_sequence_pair : indexed_sequence_pairs)
+        {
+            auto & sequence_pair = std::get<0>(indexed_sequence_pair);
+            sequence_lengths.push_back(std::max<size_t>(std::ranges::distance(std::get<0>(sequence_pair)),
+                                                        std::ranges::distance(std::get<1>(sequence_pair))));
+            chunk.emplace_back(std::pair{views::type_reduce(std::get<0>(sequence_pair)),
+                                         views::type_reduce(std::get<1>(sequence_pair))},
+                               std::get<1>(indexed_sequence_pair));
+        }
+
+        size_t const chunk_size = chunk.size();
+        results.clear();
+        results.resize(chunk_size);
+
+        callback_t store_result{[this] (alignment_result_t result)
+        {
+            // The wrapped algorithm reports the results in the order of the batch but skips the overflowed lanes.
+            while (batch[batch_cursor].second != result.id())
+                ++batch_cursor;
+
+            results[batch_positions[batch_cursor]] = std::move(result);
+        }};
+
+        for (size_t width = 0; width < width_count; ++width)
+        {
+            for (size_t position = 0; lanes[width] > 0 && position < chunk_size;)
+            {
+                batch.clear();
+                batch_positions.clear();
+                for (; position < chunk_size && batch.size() < lanes[width]; ++position)
+                {
+                    if (!results[position].has_value() && sequence_lengths[position] <= max_length[width])
+                    {
+                        batch.push_back(chunk[position]);
+                        batch_positions.push_back(position);
+                    }
+                }
+
+                if (!batch.empty())
+                {
+                    batch_cursor = 0;
+                    algorithms[width](batch_type{batch}, store_result);
+                }
+            }
+        }
+
+        for (std::optional<alignment_result_t> & result : results)
+        {
+            assert(result.has_value()); // The widest lane width reports all sequence pairs.
+            callback(std::move(*result));
+        }
+    }
+
+private:
+    //!\brief The wrapped algorithms ordered from the narrowest to the widest lane type.
+    std::array<algorithm_type, width_count> algorithms{};
+    //!\brief The maximal sequence length whose coordinates can be represented by the respective lane width.
+    std::array<size_t, width_count> max_length{};
+    //!\brief The number of sequence pairs that are computed in one simd vector of the respective lane width.
+    std::array<size_t, width_count> lanes{};
+    //!\brief Buffer for the sequence pairs of the current chunk.
+    std::vector<batch_element_t> chunk{};
+    //!\brief Buffer for the lengths of the sequence pairs of the current chunk.
+    std::vector<size_t> sequence_lengths{};
+    //!\brief Buffer for the results of the current chunk, ordered by the position of the sequence pair.
+    std::vector<std::optional<alignment_result_t>> results{};
+    //!\brief The sequence pairs of the current batch.
+    std::vector<batch_element_t> batch{};
+    //!\brief The positions within the chunk of the sequence pairs of the current batch.
+    std::vector<size_t> batch_positions{};
+    //!\brief The position within the current batch of the last reported result.
+    size_t batch_cursor{};
+};
+
+} // namespace seqan3::detail
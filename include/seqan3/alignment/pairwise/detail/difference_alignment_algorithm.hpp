@@ -0,0 +1,212 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::difference_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alignment/band/static_band.hpp>
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/pairwise/policy/difference_affine_gap_policy.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/type_inspection.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes global alignments of long sequence pairs with the difference recurrence in 8 bit simd lanes.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam fallback_algorithm_t      The type of the scalar alignment algorithm used for the other sequence pairs.
+ *
+ * \details
+ *
+ * This algorithm computes every sequence pair whose sequences are both at least
+ * seqan3::detail::difference_alignment_algorithm::minimal_sequence_length long with the
+ * seqan3::detail::difference_affine_gap_policy, which vectorises the anti-diagonals of a single alignment matrix
+ * with 8 bit lanes and stores the trace of the computed cells. If a band is configured the sequence pair is only
+ * computed with this kernel if the band contains the origin and the sink of the matrix. Sequence pairs that do not
+ * meet these requirements as well as scoring schemes whose differences do not fit into 8 bits are forwarded to the
+ * scalar algorithm.
+ *
+ * The algorithm is selected by the seqan3::detail::alignment_configurator for scalar global alignments without free
+ * end-gaps if seqan3::align_cfg::difference_recurrence is configured.
+ */
+template <typename alignment_configuration_t, typename fallback_algorithm_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class difference_alignment_algorithm :
+    protected difference_affine_gap_policy<difference_alignment_algorithm<alignment_configuration_t,
+                                                                          fallback_algorithm_t>,
+                                           typename alignment_configuration_traits<alignment_configuration_t>
+                                               ::score_type>
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The type of the difference recurrence kernel.
+    using difference_policy_type = difference_affine_gap_policy<difference_alignment_algorithm,
+                                                                typename traits_type::score_type>;
+    //!\brief The type of the scoring scheme.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of a trace segment, i.e. the trace direction and the number of consecutive cells it spans.
+    using trace_segment_type = std::pair<trace_directions, size_t>;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(traits_type::is_global && !traits_type::is_aligned_ends && !traits_type::is_vectorised &&
+                  !traits_type::is_debug,
+                  "The difference alignment only supports scalar global alignments without free end-gaps.");
+
+    //!\brief The scalar algorithm computing the remaining sequence pairs.
+    fallback_algorithm_t fallback_algorithm{};
+    //!\brief The configured scoring scheme.
+    scoring_scheme_type m_scoring_scheme{};
+    //!\brief The configured band or a band covering the entire matrix.
+    static_band band{};
+    //!\brief The trace segments of the computed alignment in order from its begin to its end.
+    std::vector<trace_segment_type> trace_segments{};
+
+public:
+    //!\brief The minimal length of both sequences for which the difference kernel is used.
+    static constexpr size_t minimal_sequence_length = 1024;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    difference_alignment_algorithm() = default; //!< Defaulted.
+    difference_alignment_algorithm(difference_alignment_algorithm const &) = default; //!< Defaulted.
+    difference_alignment_algorithm(difference_alignment_algorithm &&) = default; //!< Defaulted.
+    difference_alignment_algorithm & operator=(difference_alignment_algorithm const &) = default; //!< Defaulted.
+    difference_alignment_algorithm & operator=(difference_alignment_algorithm &&) = default; //!< Defaulted.
+    ~difference_alignment_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config             The configuration passed into the algorithm.
+     * \param fallback_algorithm The scalar algorithm computing the remaining sequence pairs.
+     */
+    difference_alignment_algorithm(alignment_configuration_t const & config, fallback_algorithm_t fallback_algorithm) :
+        difference_policy_type{config},
+        fallback_algorithm{std::move(fallback_algorithm)},
+        m_scoring_scheme{seqan3::get<align_cfg::scoring>(config).value}
+    {
+        if constexpr (traits_type::is_banded)
+            band = seqan3::get<align_cfg::band>(config).value;
+    }
+    //!\}
+
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * The results are reported in the order of the given sequence pairs. If several optimal alignments exist the
+     * reported alignment might differ from the one of the scalar algorithm.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using result_value_t = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+        using std::get;
+
+        for (auto && indexed_sequence_pair : indexed_sequence_pairs)
+        {
+            auto && [sequence_pair, idx] = indexed_sequence_pair;
+            auto && sequence1 = get<0>(sequence_pair);
+            auto && sequence2 = get<1>(sequence_pair);
+
+            int64_t const columns = std::ranges::distance(sequence1);
+            int64_t const rows = std::ranges::distance(sequence2);
+            int64_t const lower_diagonal = std::max<int64_t>(band.lower_bound, -rows);
+            int64_t const upper_diagonal = std::min<int64_t>(band.upper_bound, columns);
+
+            std::optional<typename traits_type::score_type> score{};
+
+            if (static_cast<size_t>(columns) >= minimal_sequence_length &&
+                static_cast<size_t>(rows) >= minimal_sequence_length &&
+                lower_diagonal <= std::min<int64_t>(0, columns - rows) &&
+                upper_diagonal >= std::max<int64_t>(0, columns - rows) &&
+                lower_diagonal < upper_diagonal)
+            {
+                score = this->compute_difference_score(sequence1,
+                                                       sequence2,
+                                                       m_scoring_scheme,
+                                                       lower_diagonal,
+                                                       upper_diagonal,
+                                                       traits_type::compute_sequence_alignment);
+            }
+
+            if (!score.has_value())
+            {
+                fallback_algorithm(std::views::single(indexed_sequence_pair), callback);
+                continue;
+            }
+
+            result_value_t res{};
+            res.id = idx;
+            res.score = *score;
+
+            if constexpr (traits_type::compute_back_coordinate)
+            {
+                res.back_coordinate = alignment_coordinate{column_index_type{static_cast<size_t>(columns)},
+                                                           row_index_type{static_cast<size_t>(rows)}};
+            }
+
+            if constexpr (traits_type::compute_front_coordinate)
+            {
+                res.front_coordinate = alignment_coordinate{column_index_type{size_t{0}}, row_index_type{size_t{0}}};
+            }
+
+            if constexpr (traits_type::compute_sequence_alignment)
+            {
+                this->compute_trace_segments(trace_segments);
+
+                aligned_sequence_builder builder{sequence1, sequence2};
+                res.alignment = builder(std::pair<size_t, size_t>{0, static_cast<size_t>(columns)},
+                                        std::pair<size_t, size_t>{0, static_cast<size_t>(rows)},
+                                        trace_segments).alignment;
+            }
+
+            callback(alignment_result_type{std::move(res)});
+        }
+    }
+};
+
+} // namespace seqan3::detail
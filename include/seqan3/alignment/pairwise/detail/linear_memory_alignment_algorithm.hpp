@@ -0,0 +1,611 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::linear_memory_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap.hpp>
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/type_inspection.hpp>
+#include <seqan3/range/views/slice.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the pairwise alignment with an affine gap scheme in memory linear to the sequence length.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ *
+ * \details
+ *
+ * This algorithm is selected by the seqan3::detail::alignment_configurator if seqan3::align_cfg::linear_memory is
+ * configured. It implements the divide-and-conquer algorithm of Myers and Miller (Optimal alignments in linear space,
+ * 1988) for affine gap costs: the first sequence is split in the middle and the scores of the upper half are computed
+ * in forward direction while the scores of the lower half are computed in reverse direction. Combining both score
+ * columns gives the position where an optimal alignment crosses the middle, either through a cell or within a gap
+ * that spans the split position. Both halves are solved recursively until one sequence is empty or the first
+ * sequence contains a single symbol. The score columns are stored in four buffers over the second sequence that are
+ * reused throughout the recursion, such that only memory linear to the length of the second sequence is needed in
+ * addition to the trace segments of the computed alignment. Computing the alignment requires about twice as many cell
+ * computations as the default algorithm.
+ *
+ * For the local alignment the optimum and its position are computed in a first pass. The begin of the alignment is
+ * determined from a second pass over the reversed prefixes ending at the optimum, which finds the cell from which
+ * the optimal score is reached. The alignment between both positions is then computed as a global alignment.
+ *
+ * Only the values requested by seqan3::align_cfg::result are computed, e.g. the score of a global alignment only
+ * needs a single forward pass.
+ */
+template <typename alignment_configuration_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class linear_memory_alignment_algorithm
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The type of the score.
+    using score_type = typename traits_type::score_type;
+    //!\brief The type of the scoring scheme.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of a trace segment, i.e. the trace direction and the number of consecutive cells it spans.
+    using trace_segment_type = std::pair<trace_directions, size_t>;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(!traits_type::is_vectorised && !traits_type::is_banded && !traits_type::is_aligned_ends &&
+                  !traits_type::is_debug,
+                  "The linear memory alignment only supports unbanded, scalar global and local alignments.");
+
+    //!\brief The configured scoring scheme.
+    scoring_scheme_type m_scoring_scheme{};
+    //!\brief The score for opening a gap, excluding the score of the first gap extension.
+    score_type m_gap_open_score{};
+    //!\brief The score for extending a gap.
+    score_type m_gap_extension_score{};
+
+    //!\brief The optimal scores of the forward computation.
+    std::vector<score_type> forward_scores{};
+    //!\brief The optimal scores ending with a gap in the second sequence of the forward computation.
+    std::vector<score_type> forward_gap_scores{};
+    //!\brief The optimal scores of the reverse computation.
+    std::vector<score_type> reverse_scores{};
+    //!\brief The optimal scores ending with a gap in the second sequence of the reverse computation.
+    std::vector<score_type> reverse_gap_scores{};
+    //!\brief The trace segments of the computed alignment in order from its begin to its end.
+    std::vector<trace_segment_type> trace_segments{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    linear_memory_alignment_algorithm() = default; //!< Defaulted.
+    linear_memory_alignment_algorithm(linear_memory_alignment_algorithm const &) = default; //!< Defaulted.
+    linear_memory_alignment_algorithm(linear_memory_alignment_algorithm &&) = default; //!< Defaulted.
+    linear_memory_alignment_algorithm & operator=(linear_memory_alignment_algorithm const &) = default; //!< Defaulted.
+    linear_memory_alignment_algorithm & operator=(linear_memory_alignment_algorithm &&) = default; //!< Defaulted.
+    ~linear_memory_alignment_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     */
+    linear_memory_alignment_algorithm(alignment_configuration_t const & config) :
+        m_scoring_scheme{seqan3::get<align_cfg::scoring>(config).value}
+    {
+        auto const & gaps = config.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}, gap_open_score{-10}});
+        m_gap_open_score = static_cast<score_type>(gaps.get_gap_open_score());
+        m_gap_extension_score = static_cast<score_type>(gaps.get_gap_score());
+    }
+    //!\}
+
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * The sequences must model std::ranges::random_access_range and std::ranges::sized_range.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using result_value_t = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            auto && sequence1 = get<0>(sequence_pair);
+            auto && sequence2 = get<1>(sequence_pair);
+
+            static_assert(std::ranges::random_access_range<decltype(sequence1)> &&
+                          std::ranges::sized_range<decltype(sequence1)> &&
+                          std::ranges::random_access_range<decltype(sequence2)> &&
+                          std::ranges::sized_range<decltype(sequence2)>,
+                          "The linear memory alignment requires sized random access sequences.");
+
+            std::pair<size_t, size_t> first_positions{0, std::ranges::size(sequence1)};
+            std::pair<size_t, size_t> second_positions{0, std::ranges::size(sequence2)};
+            score_type score{};
+
+            if constexpr (traits_type::is_local)
+            {
+                score = compute_local_end(sequence1, sequence2, first_positions, second_positions);
+
+                if constexpr (traits_type::compute_front_coordinate)
+                    compute_local_begin(sequence1, sequence2, score, first_positions, second_positions);
+            }
+
+            if constexpr (traits_type::compute_front_coordinate)
+            {
+                trace_segments.clear();
+                compute_trace_segments(sequence1, sequence2,
+                                       first_positions.first, first_positions.second,
+                                       second_positions.first, second_positions.second,
+                                       m_gap_open_score, m_gap_open_score);
+
+                if constexpr (!traits_type::is_local)
+                    score = score_of_trace_segments(sequence1, sequence2);
+            }
+            else if constexpr (!traits_type::is_local)
+            {
+                compute_last_scores(sequence1, sequence2, m_gap_open_score, forward_scores, forward_gap_scores);
+                score = forward_scores.back();
+            }
+
+            result_value_t res{};
+            res.id = idx;
+
+            if constexpr (traits_type::compute_score)
+                res.score = score;
+
+            if constexpr (traits_type::compute_back_coordinate)
+            {
+                res.back_coordinate = alignment_coordinate{column_index_type{first_positions.second},
+                                                           row_index_type{second_positions.second}};
+            }
+
+            if constexpr (traits_type::compute_front_coordinate)
+            {
+                res.front_coordinate.first = first_positions.first;
+                res.front_coordinate.second = second_positions.first;
+            }
+
+            if constexpr (traits_type::compute_sequence_alignment)
+            {
+                aligned_sequence_builder builder{sequence1, sequence2};
+                res.alignment = builder(first_positions, second_positions, trace_segments).alignment;
+            }
+
+            callback(alignment_result_type{std::move(res)});
+        }
+    }
+
+private:
+    //!\brief Returns the score of a gap with the given length.
+    score_type gap_cost(size_t const length) const noexcept
+    {
+        if (length == 0)
+            return score_type{};
+
+        return m_gap_open_score + static_cast<score_type>(length) * m_gap_extension_score;
+    }
+
+    //!\brief Appends the given number of cells in the given direction to the trace segments.
+    void append_trace_segment(trace_directions const direction, size_t const span)
+    {
+        if (span == 0)
+            return;
+
+        if (!trace_segments.empty() && trace_segments.back().first == direction)
+            trace_segments.back().second += span;
+        else
+            trace_segments.emplace_back(direction, span);
+    }
+
+    /*!\brief Computes the scores of the last column of the global alignment between both sequences.
+     * \param[in]  sequence1        The first sequence, spanning the columns of the alignment matrix.
+     * \param[in]  sequence2        The second sequence, spanning the rows of the alignment matrix.
+     * \param[in]  leading_gap_open The score for opening a gap in the second sequence at the begin of the column.
+     * \param[out] scores           The optimal scores of the last column.
+     * \param[out] gap_scores       The optimal scores of the last column that end with a gap in the second sequence.
+     * \param[in]  stop_at          A predicate invoked with the column, the row and the score of every computed cell.
+     * \returns `true` if the computation was stopped by `stop_at`, otherwise `false`.
+     *
+     * \details
+     *
+     * The `leading_gap_open` score is 0 if the alignment continues a gap of the enclosing alignment.
+     */
+    template <typename sequence1_t, typename sequence2_t, typename predicate_t>
+    bool compute_last_scores(sequence1_t && sequence1,
+                             sequence2_t && sequence2,
+                             score_type const leading_gap_open,
+                             std::vector<score_type> & scores,
+                             std::vector<score_type> & gap_scores,
+                             predicate_t && stop_at) const
+    {
+        size_t const row_count = std::ranges::size(sequence2);
+        scores.resize(row_count + 1);
+        gap_scores.resize(row_count + 1);
+
+        // Initialise the first column.
+        score_type gap = m_gap_open_score;
+        scores[0] = score_type{};
+        for (size_t row = 1; row <= row_count; ++row)
+        {
+            gap += m_gap_extension_score;
+            scores[row] = gap;
+            gap_scores[row] = gap + m_gap_open_score;
+        }
+
+        gap = leading_gap_open;
+        size_t column = 1;
+        for (auto const & symbol1 : sequence1)
+        {
+            score_type diagonal = scores[0];
+            gap += m_gap_extension_score;
+            score_type current = gap;
+            score_type vertical_gap = gap + m_gap_open_score;
+            scores[0] = current;
+
+            size_t row = 1;
+            for (auto const & symbol2 : sequence2)
+            {
+                vertical_gap = std::max<score_type>(vertical_gap, current + m_gap_open_score) + m_gap_extension_score;
+                gap_scores[row] = std::max<score_type>(gap_scores[row], scores[row] + m_gap_open_score) +
+                                  m_gap_extension_score;
+                current = std::max<score_type>({gap_scores[row],
+                                                vertical_gap,
+                                                diagonal + m_scoring_scheme.score(symbol1, symbol2)});
+                diagonal = scores[row];
+                scores[row] = current;
+
+                if (stop_at(column, row, current))
+                    return true;
+                ++row;
+            }
+            ++column;
+        }
+
+        gap_scores[0] = scores[0];
+        return false;
+    }
+
+    //!\brief Computes the scores of the last column without stopping early.
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_last_scores(sequence1_t && sequence1,
+                             sequence2_t && sequence2,
+                             score_type const leading_gap_open,
+                             std::vector<score_type> & scores,
+                             std::vector<score_type> & gap_scores) const
+    {
+        compute_last_scores(std::forward<sequence1_t>(sequence1), std::forward<sequence2_t>(sequence2),
+                            leading_gap_open, scores, gap_scores,
+                            [] (size_t, size_t, score_type) { return false; });
+    }
+
+    /*!\brief Computes the trace segments of the global alignment between the given slices of both sequences.
+     * \param[in] sequence1         The first sequence.
+     * \param[in] sequence2         The second sequence.
+     * \param[in] begin1            The begin position of the slice of the first sequence.
+     * \param[in] end1              The end position of the slice of the first sequence.
+     * \param[in] begin2            The begin position of the slice of the second sequence.
+     * \param[in] end2              The end position of the slice of the second sequence.
+     * \param[in] leading_gap_open  The score for opening a gap in the second sequence at the begin of the slice.
+     * \param[in] trailing_gap_open The score for opening a gap in the second sequence at the end of the slice.
+     *
+     * \details
+     *
+     * The slices are always taken from the original sequences such that the recursion does not instantiate new
+     * view types.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_trace_segments(sequence1_t & sequence1,
+                                sequence2_t & sequence2,
+                                size_t const begin1,
+                                size_t const end1,
+                                size_t const begin2,
+                                size_t const end2,
+                                score_type const leading_gap_open,
+                                score_type const trailing_gap_open)
+    {
+        size_t const size1 = end1 - begin1;
+        size_t const size2 = end2 - begin2;
+
+        if (size2 == 0)
+        {
+            append_trace_segment(trace_directions::left, size1);
+            return;
+        }
+
+        if (size1 == 0)
+        {
+            append_trace_segment(trace_directions::up, size2);
+            return;
+        }
+
+        if (size1 == 1)
+        {
+            align_single_symbol(sequence1[begin1], sequence2 | views::slice(begin2, end2),
+                                leading_gap_open, trailing_gap_open);
+            return;
+        }
+
+        size_t const middle1 = begin1 + size1 / 2;
+        auto slice2 = sequence2 | views::slice(begin2, end2);
+
+        compute_last_scores(sequence1 | views::slice(begin1, middle1), slice2,
+                            leading_gap_open, forward_scores, forward_gap_scores);
+        compute_last_scores(sequence1 | views::slice(middle1, end1) | std::views::reverse,
+                            slice2 | std::views::reverse,
+                            trailing_gap_open, reverse_scores, reverse_gap_scores);
+
+        // Find the row where the optimal alignment crosses the middle column.
+        score_type best_score = forward_scores[0] + reverse_scores[size2];
+        size_t middle2 = 0;
+        bool crosses_within_gap = false;
+
+        for (size_t row = 1; row <= size2; ++row)
+        {
+            if (score_type score = forward_scores[row] + reverse_scores[size2 - row]; score > best_score)
+            {
+                best_score = score;
+                middle2 = row;
+            }
+        }
+
+        // A gap spanning the middle column was opened in both halves.
+        for (size_t row = 0; row <= size2; ++row)
+        {
+            if (score_type score = forward_gap_scores[row] + reverse_gap_scores[size2 - row] - m_gap_open_score;
+                score > best_score)
+            {
+                best_score = score;
+                middle2 = row;
+                crosses_within_gap = true;
+            }
+        }
+
+        middle2 += begin2;
+
+        if (crosses_within_gap)
+        {
+            compute_trace_segments(sequence1, sequence2, begin1, middle1 - 1, begin2, middle2,
+                                   leading_gap_open, score_type{});
+            append_trace_segment(trace_directions::left, 2);
+            compute_trace_segments(sequence1, sequence2, middle1 + 1, end1, middle2, end2,
+                                   score_type{}, trailing_gap_open);
+        }
+        else
+        {
+            compute_trace_segments(sequence1, sequence2, begin1, middle1, begin2, middle2,
+                                   leading_gap_open, m_gap_open_score);
+            compute_trace_segments(sequence1, sequence2, middle1, end1, middle2, end2,
+                                   m_gap_open_score, trailing_gap_open);
+        }
+    }
+
+    /*!\brief Computes the trace segments of the global alignment between a single symbol and a sequence.
+     * \param[in] symbol1           The symbol of the first sequence.
+     * \param[in] sequence2         The slice of the second sequence.
+     * \param[in] leading_gap_open  The score for opening a gap in the second sequence at the begin of the slice.
+     * \param[in] trailing_gap_open The score for opening a gap in the second sequence at the end of the slice.
+     *
+     * \details
+     *
+     * Either the symbol is aligned to one symbol of the second sequence and the remaining symbols are gaps, or the
+     * symbol is aligned to a gap that is joined with the gap of the enclosing alignment with the larger open score.
+     */
+    template <typename symbol1_t, typename sequence2_t>
+    void align_single_symbol(symbol1_t const & symbol1,
+                             sequence2_t && sequence2,
+                             score_type const leading_gap_open,
+                             score_type const trailing_gap_open)
+    {
+        size_t const size2 = std::ranges::size(sequence2);
+
+        score_type best_score = std::max(leading_gap_open, trailing_gap_open) + m_gap_extension_score + gap_cost(size2);
+        size_t best_row = 0;
+
+        size_t row = 1;
+        for (auto const & symbol2 : sequence2)
+        {
+            score_type score = gap_cost(row - 1) + m_scoring_scheme.score(symbol1, symbol2) + gap_cost(size2 - row);
+            if (score > best_score)
+            {
+                best_score = score;
+                best_row = row;
+            }
+            ++row;
+        }
+
+        if (best_row != 0)
+        {
+            append_trace_segment(trace_directions::up, best_row - 1);
+            append_trace_segment(trace_directions::diagonal, 1);
+            append_trace_segment(trace_directions::up, size2 - best_row);
+        }
+        else if (leading_gap_open >= trailing_gap_open)
+        {
+            append_trace_segment(trace_directions::left, 1);
+            append_trace_segment(trace_directions::up, size2);
+        }
+        else
+        {
+            append_trace_segment(trace_directions::up, size2);
+            append_trace_segment(trace_directions::left, 1);
+        }
+    }
+
+    //!\brief Returns the score of the alignment described by the trace segments.
+    template <typename sequence1_t, typename sequence2_t>
+    score_type score_of_trace_segments(sequence1_t & sequence1, sequence2_t & sequence2) const
+    {
+        score_type score{};
+        auto it1 = std::ranges::begin(sequence1);
+        auto it2 = std::ranges::begin(sequence2);
+
+        for (auto const & [direction, span] : trace_segments)
+        {
+            if (direction == trace_directions::diagonal)
+            {
+                for (size_t i = 0; i < span; ++i, ++it1, ++it2)
+                    score += m_scoring_scheme.score(*it1, *it2);
+            }
+            else
+            {
+                score += gap_cost(span);
+                if (direction == trace_directions::up)
+                    it2 += span;
+                else
+                    it1 += span;
+            }
+        }
+
+        return score;
+    }
+
+    /*!\brief Computes the optimal score of the local alignment and its end positions.
+     * \param[in]  sequence1        The first sequence.
+     * \param[in]  sequence2        The second sequence.
+     * \param[out] first_positions  The second value is set to the end position in the first sequence.
+     * \param[out] second_positions The second value is set to the end position in the second sequence.
+     * \returns The optimal local alignment score.
+     *
+     * \details
+     *
+     * The cells are visited column by column and the first cell with the optimal score is reported as the
+     * default algorithm does.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    score_type compute_local_end(sequence1_t & sequence1,
+                                 sequence2_t & sequence2,
+                                 std::pair<size_t, size_t> & first_positions,
+                                 std::pair<size_t, size_t> & second_positions)
+    {
+        size_t const row_count = std::ranges::size(sequence2);
+        forward_scores.assign(row_count + 1, score_type{});
+        forward_gap_scores.assign(row_count + 1, m_gap_open_score);
+
+        score_type best_score{};
+        first_positions = {0, 0};
+        second_positions = {0, 0};
+
+        size_t column = 1;
+        for (auto const & symbol1 : sequence1)
+        {
+            score_type diagonal{};
+            score_type current{};
+            score_type vertical_gap = m_gap_open_score;
+
+            size_t row = 1;
+            for (auto const & symbol2 : sequence2)
+            {
+                vertical_gap = std::max<score_type>(vertical_gap, current + m_gap_open_score) + m_gap_extension_score;
+                forward_gap_scores[row] = std::max<score_type>(forward_gap_scores[row],
+                                                               forward_scores[row] + m_gap_open_score) +
+                                          m_gap_extension_score;
+                current = std::max<score_type>({forward_gap_scores[row],
+                                                vertical_gap,
+                                                diagonal + m_scoring_scheme.score(symbol1, symbol2),
+                                                score_type{}});
+                diagonal = forward_scores[row];
+                forward_scores[row] = current;
+
+                if (current > best_score)
+                {
+                    best_score = current;
+                    first_positions.second = column;
+                    second_positions.second = row;
+                }
+                ++row;
+            }
+            ++column;
+        }
+
+        return best_score;
+    }
+
+    /*!\brief Computes the begin positions of the optimal local alignment.
+     * \param[in]     sequence1        The first sequence.
+     * \param[in]     sequence2        The second sequence.
+     * \param[in]     best_score       The optimal local alignment score.
+     * \param[in,out] first_positions  The first value is set to the begin position in the first sequence.
+     * \param[in,out] second_positions The first value is set to the begin position in the second sequence.
+     *
+     * \details
+     *
+     * Computes the global alignment scores of all suffixes of the prefixes ending at the optimum in reverse
+     * direction. No alignment starting at any cell can exceed the optimal local score, hence the first cell reaching
+     * it is a valid begin of an optimal local alignment.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    void compute_local_begin(sequence1_t & sequence1,
+                             sequence2_t & sequence2,
+                             score_type const best_score,
+                             std::pair<size_t, size_t> & first_positions,
+                             std::pair<size_t, size_t> & second_positions)
+    {
+        first_positions.first = first_positions.second;
+        second_positions.first = second_positions.second;
+
+        if (best_score == score_type{})
+            return;
+
+        auto reached_optimum = [&] (size_t const column, size_t const row, score_type const score)
+        {
+            if (score != best_score)
+                return false;
+
+            first_positions.first = first_positions.second - column;
+            second_positions.first = second_positions.second - row;
+            return true;
+        };
+
+        [[maybe_unused]] bool const found =
+            compute_last_scores(sequence1 | views::slice(0, first_positions.second) | std::views::reverse,
+                                sequence2 | views::slice(0, second_positions.second) | std::views::reverse,
+                                m_gap_open_score, forward_scores, forward_gap_scores, reached_optimum);
+        assert(found);
+    }
+};
+
+} // namespace seqan3::detail
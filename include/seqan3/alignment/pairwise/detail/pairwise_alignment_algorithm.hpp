@@ -61,6 +61,7 @@ private:
 
     static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
 
+protected:
     //!\brief The configured scoring scheme.
     scoring_scheme_type m_scoring_scheme{};
 
@@ -0,0 +1,331 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::pairwise_alignment_algorithm_x_drop.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_x_drop.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/matrix/detail/affine_cell_proxy.hpp>
+#include <seqan3/alignment/pairwise/detail/pairwise_alignment_algorithm.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief The alignment algorithm type to compute the extension alignment with the x-drop termination.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam policies_t Variadic template argument for the different policies of this alignment algorithm.
+ *
+ * \details
+ *
+ * This algorithm extends seqan3::detail::pairwise_alignment_algorithm and uses the same policies to initialise and
+ * compute the cells of the alignment matrix. The alignment starts in the origin of the matrix and the optimum is
+ * tracked over all cells. A cell whose score is more than seqan3::align_cfg::x_drop below the optimum found so far is
+ * pruned, i.e. no alignment is extended from it. Each column is only computed for the rows between the first and the
+ * last cell that was not pruned in the previous column, which is extended downwards as long as the vertical gaps
+ * stay above the threshold. This adaptive band follows the optimal extension through the matrix, and the computation
+ * stops as soon as all cells of a column are pruned. Thus, the run time and the space of the score column are
+ * proportional to the extended region rather than to the lengths of the sequences.
+ */
+template <typename alignment_configuration_t, typename ...policies_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class pairwise_alignment_algorithm_x_drop :
+    protected pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>
+{
+private:
+    //!\brief The type of the extended alignment algorithm.
+    using base_algorithm_t = pairwise_alignment_algorithm<alignment_configuration_t, policies_t...>;
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The configured score type.
+    using score_type = typename traits_type::score_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The affine cell type computed by the policies.
+    using affine_cell_type = affine_cell_proxy<std::tuple<score_type, score_type, score_type>>;
+
+    static_assert(!traits_type::compute_sequence_alignment,
+                  "The x-drop alignment does not compute the aligned sequences.");
+
+    //!\brief The score of a pruned cell, which can be extended with a few gaps without underflow.
+    static constexpr score_type pruned_score = std::numeric_limits<score_type>::lowest() / 2;
+
+    //!\brief The configured x-drop value.
+    score_type x_drop_score{};
+    //!\brief The optimal scores of the last computed column, starting at row column_offset.
+    std::vector<score_type> optimal_scores{};
+    //!\brief The horizontal gap scores of the last computed column, starting at row column_offset.
+    std::vector<score_type> horizontal_scores{};
+    //!\brief The row of the first stored cell of the score column.
+    size_t column_offset{};
+    //!\brief The tracked optimal score.
+    score_type optimal_score{};
+    //!\brief The column index of the tracked optimum.
+    size_t optimal_column{};
+    //!\brief The row index of the tracked optimum.
+    size_t optimal_row{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    pairwise_alignment_algorithm_x_drop() = default; //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop(pairwise_alignment_algorithm_x_drop const &) = default; //!< Defaulted.
+    pairwise_alignment_algorithm_x_drop(pairwise_alignment_algorithm_x_drop &&) = default; //!< Defaulted.
+    //!\brief Defaulted.
+    pairwise_alignment_algorithm_x_drop & operator=(pairwise_alignment_algorithm_x_drop const &) = default;
+    pairwise_alignment_algorithm_x_drop & operator=(pairwise_alignment_algorithm_x_drop &&) = default; //!< Defaulted.
+    ~pairwise_alignment_algorithm_x_drop() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     */
+    pairwise_alignment_algorithm_x_drop(alignment_configuration_t const & config) :
+        base_algorithm_t{config},
+        x_drop_score{static_cast<score_type>(seqan3::get<align_cfg::x_drop>(config).value)}
+    {}
+    //!\}
+
+    /*!\brief Computes the extension alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * The back coordinate is the first cell with the optimal score in column-major order. The front coordinate is
+     * always the origin of the alignment matrix.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using result_value_t = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            result_value_t res{};
+            res.id = idx;
+            res.score = compute_matrix(get<0>(sequence_pair), get<1>(sequence_pair));
+
+            if constexpr (traits_type::compute_back_coordinate)
+            {
+                res.back_coordinate = alignment_coordinate{column_index_type{optimal_column},
+                                                           row_index_type{optimal_row}};
+            }
+
+            if constexpr (traits_type::compute_front_coordinate)
+            {
+                res.front_coordinate = alignment_coordinate{column_index_type{size_t{0}},
+                                                            row_index_type{size_t{0}}};
+            }
+
+            callback(alignment_result_type{res});
+        }
+    }
+
+protected:
+    /*!\brief Computes the extension alignment.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::forward_range.
+     *
+     * \param[in] sequence1 The first sequence to compute the alignment for.
+     * \param[in] sequence2 The second sequence to compute the alignment for.
+     *
+     * \returns The optimal score of the extension.
+     */
+    template <std::ranges::forward_range sequence1_t, std::ranges::forward_range sequence2_t>
+    score_type compute_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        // ---------------------------------------------------------------------
+        // Initialisation phase: initialise the first column until it drops.
+        // ---------------------------------------------------------------------
+
+        // The score column only stores the rows of the band and grows on demand.
+        size_t const row_count = std::ranges::distance(sequence2);
+        optimal_scores.clear();
+        horizontal_scores.clear();
+        column_offset = 0;
+        optimal_score = 0;
+        optimal_column = 0;
+        optimal_row = 0;
+
+        affine_cell_type cell = this->initialise_origin_cell();
+        store_cell(cell, 0);
+
+        size_t first_row = 0; // The first row of the last column that was not pruned.
+        size_t last_row = 0; // The last row of the last column that was not pruned.
+        for (size_t row = 1; row <= row_count; ++row)
+        {
+            cell = this->initialise_first_column_cell(cell);
+            if (is_pruned(cell))
+                break;
+
+            store_cell(cell, row);
+            last_row = row;
+        }
+
+        // ---------------------------------------------------------------------
+        // Iteration phase: compute the rows of every column that were not pruned.
+        // ---------------------------------------------------------------------
+
+        size_t column = 0;
+        for (auto && sequence1_value : sequence1)
+        {
+            ++column;
+            size_t next_first_row = row_count + 1;
+            size_t next_last_row = 0;
+
+            // Tracks the cell if it is not pruned and returns whether it was pruned.
+            auto track_cell = [&] (affine_cell_type & current_cell, size_t const current_row)
+            {
+                if (is_pruned(current_cell))
+                {
+                    current_cell = affine_cell_type{pruned_score, pruned_score, pruned_score};
+                    return true;
+                }
+
+                if (current_cell.optimal_score() > optimal_score)
+                {
+                    optimal_score = current_cell.optimal_score();
+                    optimal_column = column;
+                    optimal_row = current_row;
+                }
+
+                next_first_row = std::min(next_first_row, current_row);
+                next_last_row = current_row;
+                return false;
+            };
+
+            size_t row = first_row;
+            score_type diagonal = pruned_score;
+            cell = affine_cell_type{pruned_score, pruned_score, pruned_score};
+
+            if (row == 0)
+            {
+                diagonal = optimal_scores[0];
+                cell = this->initialise_first_row_cell(affine_cell_type{optimal_scores[0],
+                                                                        horizontal_scores[0],
+                                                                        pruned_score});
+                track_cell(cell, 0);
+                store_cell(cell, 0);
+                ++row;
+            }
+
+            auto sequence2_it = std::ranges::next(std::ranges::begin(sequence2), row - 1, std::ranges::end(sequence2));
+            for (; row <= row_count; ++row, ++sequence2_it)
+            {
+                // Only the vertical gaps extend below the last row of the previous column.
+                bool const in_previous_column = row <= last_row;
+                score_type const next_diagonal = in_previous_column ? optimal_scores[row - column_offset]
+                                                                    : pruned_score;
+                score_type const horizontal = in_previous_column ? horizontal_scores[row - column_offset]
+                                                                 : pruned_score;
+
+                cell = this->compute_inner_cell(diagonal,
+                                                affine_cell_type{pruned_score, horizontal, cell.vertical_score()},
+                                                this->m_scoring_scheme.score(sequence1_value, *sequence2_it));
+                diagonal = next_diagonal;
+
+                if (track_cell(cell, row) && !in_previous_column)
+                    break;
+
+                store_cell(cell, row);
+            }
+
+            // ---------------------------------------------------------------------
+            // Final phase: stop if all cells of the column were pruned.
+            // ---------------------------------------------------------------------
+
+            if (next_first_row > next_last_row)
+                break;
+
+            first_row = next_first_row;
+            last_row = next_last_row;
+            shrink_column(first_row, last_row);
+        }
+
+        return optimal_score;
+    }
+
+private:
+    //!\brief Returns whether the optimal score of the given cell dropped too far below the tracked optimum.
+    bool is_pruned(affine_cell_type const & cell) const noexcept
+    {
+        return cell.optimal_score() < optimal_score - x_drop_score;
+    }
+
+    //!\brief Stores the given cell in the score column, which grows if the row lies below the stored rows.
+    void store_cell(affine_cell_type const & cell, size_t const row)
+    {
+        assert(row >= column_offset);
+
+        if (size_t const index = row - column_offset; index < optimal_scores.size())
+        {
+            optimal_scores[index] = cell.optimal_score();
+            horizontal_scores[index] = cell.horizontal_score();
+        }
+        else // The rows are stored in increasing order, so the column grows by exactly one cell.
+        {
+            assert(index == optimal_scores.size());
+            optimal_scores.push_back(cell.optimal_score());
+            horizontal_scores.push_back(cell.horizontal_score());
+        }
+    }
+
+    /*!\brief Removes the rows outside of the band [first_row, last_row] from the score column.
+     *
+     * \details
+     *
+     * The rows below the band are simply discarded. The rows above the band are only erased once they outnumber the
+     * rows of the band, such that moving the band down costs amortised constant time per row and the score column
+     * stays proportional to the band.
+     */
+    void shrink_column(size_t const first_row, size_t const last_row)
+    {
+        optimal_scores.resize(last_row - column_offset + 1);
+        horizontal_scores.resize(last_row - column_offset + 1);
+
+        if (size_t const rows_above = first_row - column_offset; rows_above > last_row - first_row)
+        {
+            optimal_scores.erase(optimal_scores.begin(), optimal_scores.begin() + rows_above);
+            horizontal_scores.erase(horizontal_scores.begin(), horizontal_scores.begin() + rows_above);
+            column_offset = first_row;
+        }
+    }
+};
+
+} // namespace seqan3::detail
@@ -0,0 +1,166 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::striped_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <utility>
+
+#include <seqan3/alignment/configuration/align_config_scoring.hpp>
+#include <seqan3/alignment/matrix/alignment_coordinate.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/pairwise/policy/striped_affine_gap_policy.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/type_inspection.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the scores of large sequence pairs with the striped intra-sequence vectorisation.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ * \tparam fallback_algorithm_t      The type of the scalar alignment algorithm used for small sequence pairs.
+ *
+ * \details
+ *
+ * The inter-sequence vectorisation (seqan3::align_cfg::vectorise) needs many sequence pairs to fill the simd
+ * vectors and does not speed up the alignment of a single large sequence pair. This algorithm computes every
+ * sequence pair whose sequences are both at least seqan3::detail::striped_alignment_algorithm::minimal_sequence_length
+ * long with the seqan3::detail::striped_affine_gap_policy, which vectorises the computation of a single alignment
+ * matrix. All other sequence pairs are forwarded to the scalar algorithm, since building the query profile does not
+ * pay off for them.
+ *
+ * The algorithm is selected by the seqan3::detail::alignment_configurator for scalar global alignments without free
+ * end-gaps and local alignments that compute the score and optionally the back coordinate. The front coordinate and
+ * the alignment need the trace matrix and are computed by the scalar algorithm.
+ */
+template <typename alignment_configuration_t, typename fallback_algorithm_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class striped_alignment_algorithm :
+    protected striped_affine_gap_policy<striped_alignment_algorithm<alignment_configuration_t, fallback_algorithm_t>,
+                                        typename alignment_configuration_traits<alignment_configuration_t>::score_type,
+                                        std::bool_constant<alignment_configuration_traits<alignment_configuration_t>
+                                                               ::is_local>>
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The type of the striped kernel.
+    using striped_policy_type = striped_affine_gap_policy<striped_alignment_algorithm,
+                                                          typename traits_type::score_type,
+                                                          std::bool_constant<traits_type::is_local>>;
+    //!\brief The type of the scoring scheme.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(traits_type::result_type_rank <= 1,
+                  "The striped alignment only computes the score and the back coordinate.");
+
+    //!\brief The scalar algorithm computing the small sequence pairs.
+    fallback_algorithm_t fallback_algorithm{};
+    //!\brief The configured scoring scheme.
+    scoring_scheme_type m_scoring_scheme{};
+
+public:
+    //!\brief The minimal length of both sequences for which the striped kernel is used.
+    static constexpr size_t minimal_sequence_length = 256;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    striped_alignment_algorithm() = default; //!< Defaulted.
+    striped_alignment_algorithm(striped_alignment_algorithm const &) = default; //!< Defaulted.
+    striped_alignment_algorithm(striped_alignment_algorithm &&) = default; //!< Defaulted.
+    striped_alignment_algorithm & operator=(striped_alignment_algorithm const &) = default; //!< Defaulted.
+    striped_alignment_algorithm & operator=(striped_alignment_algorithm &&) = default; //!< Defaulted.
+    ~striped_alignment_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config             The configuration passed into the algorithm.
+     * \param fallback_algorithm The scalar algorithm computing the small sequence pairs.
+     */
+    striped_alignment_algorithm(alignment_configuration_t const & config, fallback_algorithm_t fallback_algorithm) :
+        striped_policy_type{config},
+        fallback_algorithm{std::move(fallback_algorithm)},
+        m_scoring_scheme{seqan3::get<align_cfg::scoring>(config).value}
+    {}
+    //!\}
+
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * The results are reported in the order of the given sequence pairs.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using result_value_t = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+        using std::get;
+
+        for (auto && indexed_sequence_pair : indexed_sequence_pairs)
+        {
+            auto && [sequence_pair, idx] = indexed_sequence_pair;
+            auto && sequence1 = get<0>(sequence_pair);
+            auto && sequence2 = get<1>(sequence_pair);
+
+            if (static_cast<size_t>(std::ranges::distance(sequence1)) < minimal_sequence_length ||
+                static_cast<size_t>(std::ranges::distance(sequence2)) < minimal_sequence_length)
+            {
+                fallback_algorithm(std::views::single(indexed_sequence_pair), callback);
+                continue;
+            }
+
+            result_value_t res{};
+            res.id = idx;
+            auto const optimum =
+                this->template compute_striped_optimum<traits_type::compute_back_coordinate>(sequence1,
+                                                                                               sequence2,
+                                                                                               m_scoring_scheme);
+            res.score = optimum.score;
+
+            if constexpr (traits_type::compute_back_coordinate)
+            {
+                res.back_coordinate = alignment_coordinate{column_index_type{optimum.column_index},
+                                                           row_index_type{optimum.row_index}};
+            }
+
+            callback(alignment_result_type{res});
+        }
+    }
+};
+
+} // namespace seqan3::detail
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <limits>
 #include <type_traits>
 
 #include <seqan3/alignment/configuration/align_config_aligned_ends.hpp>
@@ -23,17 +24,20 @@
 #include <seqan3/alignment/configuration/align_config_result.hpp>
 #include <seqan3/alignment/configuration/align_config_scoring.hpp>
 #include <seqan3/alignment/configuration/align_config_vectorise.hpp>
+#include <seqan3/alignment/configuration/align_config_vectorised_score_type.hpp>
 #include <seqan3/alignment/matrix/trace_directions.hpp>
 #include <seqan3/alignment/pairwise/detail/concept.hpp>
 #include <seqan3/core/algorithm/configuration.hpp>
 #include <seqan3/core/bit_manipulation.hpp>
 #include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
 #include <seqan3/core/simd/simd_traits.hpp>
 #include <seqan3/core/simd/simd.hpp>
 #include <seqan3/core/type_traits/function.hpp>
 #include <seqan3/core/type_traits/template_inspection.hpp>
 #include <seqan3/range/views/chunk.hpp>
 #include <seqan3/range/views/zip.hpp>
+#include <seqan3/std/concepts>
 #include <seqan3/std/ranges>
 
 namespace seqan3::detail
@@ -98,6 +102,22 @@ private:
         }
     }
 
+    //!\brief Helper function to determine the simd vector type of the vectorised alignment.
+    static constexpr auto determine_vectorised_simd_type() noexcept
+    {
+        if constexpr (configuration_t::template exists<vectorised_score_type_element>())
+        {
+            using wrapped_simd_t =
+                decltype(seqan3::get<vectorised_score_type_element>(std::declval<configuration_t>()).value);
+            return typename wrapped_simd_t::type{};  // Unwrap the type_identity.
+        }
+        else
+        {
+            return simd_type_t<typename std::remove_reference_t<
+                decltype(seqan3::get<align_cfg::result>(std::declval<configuration_t>()))>::score_type>{};
+        }
+    }
+
 public:
     //!\brief Flag to indicate vectorised mode.
     static constexpr bool is_vectorised =
@@ -127,23 +147,86 @@ public:
         std::remove_reference_t<decltype(seqan3::get<align_cfg::result>(std::declval<configuration_t>()))>;
     //!\brief The original score type selected by the user.
     using original_score_type = typename result_type::score_type;
+    //!\brief The simd vector type if the alignment is vectorised.
+    using vectorised_simd_type = decltype(determine_vectorised_simd_type());
+    //!\brief The scalar type of the simd lanes if the alignment is vectorised.
+    using vectorised_score_type = typename simd_traits<vectorised_simd_type>::scalar_type;
     //!\brief The score type for the alignment algorithm.
-    using score_type = std::conditional_t<is_vectorised, simd_type_t<original_score_type>, original_score_type>;
+    using score_type = std::conditional_t<is_vectorised, vectorised_simd_type, original_score_type>;
     //!\brief The trace directions type for the alignment algorithm.
-    using trace_type = std::conditional_t<is_vectorised, simd_type_t<original_score_type>, trace_directions>;
+    using trace_type = std::conditional_t<is_vectorised, vectorised_simd_type, trace_directions>;
     //!\brief The alignment result type if present. Otherwise seqan3::detail::empty_type.
     using alignment_result_type = decltype(determine_alignment_result_type());
 
+    //!\brief The rank of the selected result type.
+    static constexpr int8_t result_type_rank = static_cast<int8_t>(decltype(std::declval<result_type>().value)::rank);
+    /*!\brief Flag indicating whether the width of the simd lanes is chosen per batch of sequence pairs.
+     *
+     * \details
+     *
+     * If the lane type was not fixed with seqan3::detail::vectorised_score_type_element, an unbanded vectorised
+     * alignment that computes at most the score and the back coordinate is dispatched via the
+     * seqan3::detail::adaptive_simd_alignment_algorithm, which computes short sequence pairs in narrower lanes.
+     */
+    static constexpr bool is_score_width_adaptive =
+        is_vectorised &&
+        !configuration_t::template exists<vectorised_score_type_element>() &&
+        !is_banded &&
+        !is_debug &&
+        result_type_rank <= 1 &&
+        std::signed_integral<original_score_type> &&
+        (sizeof(original_score_type) > 1);
+    /*!\brief Flag indicating whether the simd lanes are narrower than the original score type.
+     *
+     * \details
+     *
+     * If set, the vectorised alignment algorithm tracks the range of the scores of every lane and only reports the
+     * alignments whose scores kept a distance of seqan3::detail::alignment_configuration_traits::lane_overflow_margin
+     * to the limits of the lane type. The other alignments are recomputed in wider lanes by the
+     * seqan3::detail::adaptive_simd_alignment_algorithm.
+     */
+    static constexpr bool checks_lane_overflow = is_vectorised &&
+                                                 sizeof(vectorised_score_type) < sizeof(original_score_type);
+    /*!\brief The distance to the limits of the lane type that all scores must keep if
+     *        seqan3::detail::alignment_configuration_traits::checks_lane_overflow is set.
+     *
+     * \details
+     *
+     * No step of the recursion can overflow from a score within this distance, if no substitution score and no gap
+     * score exceeds half of the margin in magnitude.
+     */
+    static constexpr vectorised_score_type lane_overflow_margin =
+        std::numeric_limits<vectorised_score_type>::max() / 4;
     //!\brief The number of alignments that can be computed in one simd vector.
     static constexpr size_t alignments_per_vector = [] () constexpr
                                                     {
-                                                        if constexpr (is_vectorised)
+                                                        if constexpr (is_score_width_adaptive)
+                                                            return simd_traits<simd_type_t<int8_t>>::length;
+                                                        else if constexpr (is_vectorised)
                                                             return simd_traits<score_type>::length;
                                                         else
                                                             return 1;
                                                     }();
-    //!\brief The rank of the selected result type.
-    static constexpr int8_t result_type_rank = static_cast<int8_t>(decltype(std::declval<result_type>().value)::rank);
+    /*!\brief Returns the number of alignments that are computed in one simd vector of the given instruction set.
+     * \param[in] instruction_set The instruction set the alignment is configured for. Defaults to the widest
+     *                            instruction set supported by the executing CPU.
+     *
+     * \details
+     *
+     * If the simd vector type is not fixed with seqan3::detail::vectorised_score_type_element, the
+     * seqan3::detail::alignment_configurator configures the vectorised alignment for the simd vectors of the given
+     * instruction set. Otherwise, returns seqan3::detail::alignment_configuration_traits::alignments_per_vector.
+     */
+    static size_t runtime_alignments_per_vector(
+        simd_instruction_set const instruction_set = runtime_simd_instruction_set()) noexcept
+    {
+        if constexpr (!is_vectorised || configuration_t::template exists<vectorised_score_type_element>())
+            return alignments_per_vector;
+        else if constexpr (is_score_width_adaptive)
+            return simd_length_for<int8_t>(instruction_set);
+        else
+            return simd_length_for<vectorised_score_type>(instruction_set);
+    }
     //!\brief Flag indicating whether the score shall be computed.
     static constexpr bool compute_score = result_type_rank >= 0;
     //!\brief Flag indicating whether the back coordintate shall be computed.
@@ -153,8 +236,8 @@ public:
     //!\brief Flag indicating whether the sequence alignment shall be computed.
     static constexpr bool compute_sequence_alignment = result_type_rank >= 3;
     //!\brief The padding symbol to use for the computation of the alignment.
-    static constexpr original_score_type padding_symbol =
-        static_cast<original_score_type>(1u << (sizeof_bits<original_score_type> - 1));
+    static constexpr vectorised_score_type padding_symbol =
+        static_cast<vectorised_score_type>(1u << (sizeof_bits<vectorised_score_type> - 1));
 };
 
 //------------------------------------------------------------------------------
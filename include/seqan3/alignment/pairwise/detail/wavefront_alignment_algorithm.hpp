@@ -0,0 +1,552 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::wavefront_alignment_algorithm.
+ */
+
+#pragma once
+
+#include <array>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap.hpp>
+#include <seqan3/alignment/configuration/align_config_scoring.hpp>
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+#include <seqan3/alignment/exception.hpp>
+#include <seqan3/alignment/matrix/detail/aligned_sequence_builder.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alignment/pairwise/alignment_result.hpp>
+#include <seqan3/alignment/pairwise/detail/concept.hpp>
+#include <seqan3/alignment/pairwise/detail/type_traits.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/core/detail/type_inspection.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Computes the global alignment with the gap-affine wavefront alignment algorithm.
+ * \implements std::invocable
+ * \ingroup pairwise_alignment
+ *
+ * \tparam alignment_configuration_t The configuration type; must be of type seqan3::configuration.
+ *
+ * \details
+ *
+ * This algorithm is selected by the seqan3::detail::alignment_configurator if seqan3::align_cfg::wavefront is
+ * configured. It implements the wavefront alignment algorithm (Marco-Sola et al., Fast gap-affine pairwise alignment
+ * using the wavefront algorithm, 2021). The algorithm minimises the penalty of the alignment, where matches have no
+ * penalty. For every penalty it computes the wavefront, i.e. the furthest reaching column on every diagonal of the
+ * alignment matrix that can be reached with exactly this penalty, separately for alignments ending with a match or
+ * mismatch, a gap in the second sequence or a gap in the first sequence. The wavefront of a penalty is computed from
+ * the wavefronts of the penalty reduced by the mismatch, the gap open and the gap extension penalty, and every cell
+ * of the optimal wavefront is extended along the matches on its diagonal. The computation stops as soon as the sink
+ * of the alignment matrix is reached. Thus, the run time is proportional to the product of the sequence length and
+ * the penalty of the optimal alignment instead of the product of the sequence lengths.
+ *
+ * The penalties are derived from the configured scores, such that every alignment with the penalty `p` has the score
+ * `(match * (n + m) - p) / 2`, where `n` and `m` are the sequence lengths: the mismatch penalty is
+ * `2 * (match - mismatch)`, the gap open penalty is `-2 * gap_open` and the gap extension penalty is
+ * `match - 2 * gap_extension`. This requires a scoring scheme that assigns the same score to all matches and the same
+ * lower score to all mismatches.
+ *
+ * If only the score or the coordinates are computed, only the wavefronts that are needed to compute the next ones are
+ * kept. If the alignment is computed, all wavefronts are stored and the trace segments are recovered by recomputing
+ * the sources of the cells on the optimal path.
+ */
+template <typename alignment_configuration_t>
+//!\cond
+    requires is_type_specialisation_of_v<alignment_configuration_t, configuration>
+//!\endcond
+class wavefront_alignment_algorithm
+{
+private:
+    //!\brief The alignment configuration traits type with auxiliary information extracted from the configuration type.
+    using traits_type = alignment_configuration_traits<alignment_configuration_t>;
+    //!\brief The type of the score.
+    using score_type = typename traits_type::score_type;
+    //!\brief The type of the scoring scheme.
+    using scoring_scheme_type = typename traits_type::scoring_scheme_type;
+    //!\brief The alphabet type of the scoring scheme.
+    using scoring_scheme_alphabet_type = typename traits_type::scoring_scheme_alphabet_type;
+    //!\brief The configured alignment result type.
+    using alignment_result_type = typename traits_type::alignment_result_type;
+    //!\brief The type of a trace segment, i.e. the trace direction and the number of consecutive cells it spans.
+    using trace_segment_type = std::pair<trace_directions, size_t>;
+    //!\brief The type of the offsets, i.e. the column of a cell on its diagonal.
+    using offset_type = int64_t;
+
+    static_assert(!std::same_as<alignment_result_type, empty_type>, "Alignment result type was not configured.");
+    static_assert(traits_type::is_global && !traits_type::is_aligned_ends && !traits_type::is_banded &&
+                  !traits_type::is_vectorised && !traits_type::is_debug,
+                  "The wavefront alignment only supports unbanded, scalar global alignments without free end-gaps.");
+
+    //!\brief The furthest reaching offsets of all diagonals for one penalty.
+    struct wavefront
+    {
+        //!\brief Whether any diagonal can be reached with this penalty.
+        bool is_valid{false};
+        //!\brief The lowest diagonal of the wavefront.
+        int64_t lower_diagonal{};
+        //!\brief The highest diagonal of the wavefront.
+        int64_t upper_diagonal{};
+        //!\brief The offsets of the alignments ending with a match or a mismatch.
+        std::vector<offset_type> optimal{};
+        //!\brief The offsets of the alignments ending with a gap in the second sequence.
+        std::vector<offset_type> horizontal{};
+        //!\brief The offsets of the alignments ending with a gap in the first sequence.
+        std::vector<offset_type> vertical{};
+    };
+
+    //!\brief The wavefronts reduced by the mismatch, the gap open and the gap extension penalty, if they exist.
+    struct source_wavefronts
+    {
+        //!\brief The source of mismatches.
+        wavefront const * mismatch;
+        //!\brief The source of opened gaps.
+        wavefront const * gap_open;
+        //!\brief The source of extended gaps.
+        wavefront const * gap_extension;
+    };
+
+    //!\brief The offset of a diagonal that cannot be reached; stays negative after a few increments.
+    static constexpr offset_type null_offset = std::numeric_limits<offset_type>::lowest() / 2;
+
+    //!\brief The configured scoring scheme.
+    scoring_scheme_type m_scoring_scheme{};
+    //!\brief The score of all matches.
+    score_type m_match_score{};
+    //!\brief The penalty of a mismatch.
+    int64_t m_mismatch_penalty{};
+    //!\brief The penalty for opening a gap, excluding the penalty of the first gap extension.
+    int64_t m_gap_open_penalty{};
+    //!\brief The penalty for extending a gap.
+    int64_t m_gap_extension_penalty{};
+    //!\brief The number of wavefronts that are kept if the alignment is not computed.
+    int64_t window_size{};
+
+    //!\brief The computed wavefronts indexed by their penalty or by their penalty modulo the window size.
+    std::vector<wavefront> wavefronts{};
+    //!\brief The trace segments of the computed alignment in order from its begin to its end.
+    std::vector<trace_segment_type> trace_segments{};
+    //!\brief The length of the current first sequence.
+    int64_t column_count{};
+    //!\brief The length of the current second sequence.
+    int64_t row_count{};
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    wavefront_alignment_algorithm() = default; //!< Defaulted.
+    wavefront_alignment_algorithm(wavefront_alignment_algorithm const &) = default; //!< Defaulted.
+    wavefront_alignment_algorithm(wavefront_alignment_algorithm &&) = default; //!< Defaulted.
+    wavefront_alignment_algorithm & operator=(wavefront_alignment_algorithm const &) = default; //!< Defaulted.
+    wavefront_alignment_algorithm & operator=(wavefront_alignment_algorithm &&) = default; //!< Defaulted.
+    ~wavefront_alignment_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs and initialises the algorithm using the alignment configuration.
+     * \param config The configuration passed into the algorithm.
+     *
+     * \throws seqan3::invalid_alignment_configuration if the scoring scheme does not assign the same score to all
+     *         matches and the same lower score to all mismatches, or if the gap scores cannot be converted to
+     *         non-negative penalties.
+     */
+    wavefront_alignment_algorithm(alignment_configuration_t const & config) :
+        m_scoring_scheme{seqan3::get<align_cfg::scoring>(config).value}
+    {
+        using rank_t = std::remove_const_t<decltype(seqan3::alphabet_size<scoring_scheme_alphabet_type>)>;
+
+        std::optional<int64_t> match{};
+        std::optional<int64_t> mismatch{};
+        bool is_match_mismatch_scheme = true;
+
+        for (rank_t rank1 = 0; rank1 < seqan3::alphabet_size<scoring_scheme_alphabet_type>; ++rank1)
+        {
+            auto const symbol1 = seqan3::assign_rank_to(rank1, scoring_scheme_alphabet_type{});
+
+            for (rank_t rank2 = 0; rank2 < seqan3::alphabet_size<scoring_scheme_alphabet_type>; ++rank2)
+            {
+                auto const symbol2 = seqan3::assign_rank_to(rank2, scoring_scheme_alphabet_type{});
+                int64_t const score = m_scoring_scheme.score(symbol1, symbol2);
+                std::optional<int64_t> & expected = (rank1 == rank2) ? match : mismatch;
+
+                if (!expected.has_value())
+                    expected = score;
+
+                is_match_mismatch_scheme = is_match_mismatch_scheme && *expected == score;
+            }
+        }
+
+        if (!is_match_mismatch_scheme || (mismatch.has_value() && *mismatch >= *match))
+        {
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration requires a scoring scheme "
+                                                  "with one match score and a lower mismatch score."};
+        }
+
+        auto const & gaps = config.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}});
+
+        m_match_score = static_cast<score_type>(*match);
+        m_mismatch_penalty = 2 * (*match - mismatch.value_or(*match - 1));
+        m_gap_open_penalty = -2 * static_cast<int64_t>(gaps.get_gap_open_score());
+        m_gap_extension_penalty = *match - 2 * static_cast<int64_t>(gaps.get_gap_score());
+
+        if (m_gap_open_penalty < 0 || m_gap_extension_penalty <= 0)
+        {
+            throw invalid_alignment_configuration{"The align_cfg::wavefront configuration requires a non-positive "
+                                                  "gap open score and a gap score below half the match score."};
+        }
+
+        window_size = std::max(m_mismatch_penalty, m_gap_open_penalty + m_gap_extension_penalty) + 1;
+    }
+    //!\}
+
+    /*!\brief Computes the pairwise sequence alignment for the given range over indexed sequence pairs.
+     * \tparam indexed_sequence_pairs_t The type of indexed_sequence_pairs; must model
+     *                                  seqan3::detail::indexed_sequence_pair_range.
+     * \tparam callback_t The type of the callback function that is called with the alignment result; must model
+     *                    std::invocable with seqan3::alignment_result as argument.
+     *
+     * \param[in] indexed_sequence_pairs A range over indexed sequence pairs to be aligned.
+     * \param[in] callback The callback function to be invoked with each computed alignment result.
+     *
+     * \details
+     *
+     * The sequences must model std::ranges::random_access_range and std::ranges::sized_range. If several optimal
+     * alignments exist the reported alignment might differ from the one of the default algorithm.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this functions in a concurrent environment are not thread safe. Instead use a copy of the alignment
+     * algorithm type.
+     */
+    template <indexed_sequence_pair_range indexed_sequence_pairs_t, typename callback_t>
+    //!\cond
+        requires std::invocable<callback_t, alignment_result_type>
+    //!\endcond
+    void operator()(indexed_sequence_pairs_t && indexed_sequence_pairs, callback_t && callback)
+    {
+        using result_value_t = typename alignment_result_value_type_accessor<alignment_result_type>::type;
+        using std::get;
+
+        for (auto && [sequence_pair, idx] : indexed_sequence_pairs)
+        {
+            auto && sequence1 = get<0>(sequence_pair);
+            auto && sequence2 = get<1>(sequence_pair);
+
+            static_assert(std::ranges::random_access_range<decltype(sequence1)> &&
+                          std::ranges::sized_range<decltype(sequence1)> &&
+                          std::ranges::random_access_range<decltype(sequence2)> &&
+                          std::ranges::sized_range<decltype(sequence2)>,
+                          "The wavefront alignment requires sized random access sequences.");
+
+            column_count = std::ranges::size(sequence1);
+            row_count = std::ranges::size(sequence2);
+
+            int64_t const penalty = compute_wavefronts(sequence1, sequence2);
+
+            result_value_t res{};
+            res.id = idx;
+            res.score = static_cast<score_type>((m_match_score * (column_count + row_count) - penalty) / 2);
+
+            if constexpr (traits_type::compute_back_coordinate)
+            {
+                res.back_coordinate = alignment_coordinate{column_index_type{static_cast<size_t>(column_count)},
+                                                           row_index_type{static_cast<size_t>(row_count)}};
+            }
+
+            if constexpr (traits_type::compute_front_coordinate)
+            {
+                res.front_coordinate = alignment_coordinate{column_index_type{size_t{0}}, row_index_type{size_t{0}}};
+            }
+
+            if constexpr (traits_type::compute_sequence_alignment)
+            {
+                compute_trace_segments(penalty);
+
+                aligned_sequence_builder builder{sequence1, sequence2};
+                res.alignment = builder(std::pair<size_t, size_t>{0, static_cast<size_t>(column_count)},
+                                        std::pair<size_t, size_t>{0, static_cast<size_t>(row_count)},
+                                        trace_segments).alignment;
+            }
+
+            callback(alignment_result_type{std::move(res)});
+        }
+    }
+
+private:
+    /*!\brief Computes the wavefronts with increasing penalties until the sink of the alignment matrix is reached.
+     * \tparam sequence1_t The type of the first sequence; must model std::ranges::random_access_range.
+     * \tparam sequence2_t The type of the second sequence; must model std::ranges::random_access_range.
+     *
+     * \param[in] sequence1 The first sequence.
+     * \param[in] sequence2 The second sequence.
+     *
+     * \returns The penalty of the optimal global alignment.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    int64_t compute_wavefronts(sequence1_t && sequence1, sequence2_t && sequence2)
+    {
+        int64_t const sink_diagonal = column_count - row_count;
+
+        wavefront & origin = allocate_wavefront(0);
+        origin.is_valid = true;
+        origin.lower_diagonal = 0;
+        origin.upper_diagonal = 0;
+        origin.optimal.assign(1, extend(sequence1, sequence2, 0, 0));
+        origin.horizontal.assign(1, null_offset);
+        origin.vertical.assign(1, null_offset);
+
+        int64_t penalty = 0;
+        while (offset_of(valid_wavefront(penalty), &wavefront::optimal, sink_diagonal) != column_count)
+        {
+            ++penalty;
+
+            // Allocate the new wavefront first, since this might invalidate the pointers to its sources.
+            wavefront & current = allocate_wavefront(penalty);
+            source_wavefronts const sources = sources_of(penalty);
+
+            // The diagonals of the new wavefront span the diagonals of its source wavefronts.
+            int64_t lower_diagonal = std::numeric_limits<int64_t>::max();
+            int64_t upper_diagonal = std::numeric_limits<int64_t>::lowest();
+            auto span_source = [&] (wavefront const * source, int64_t const growth)
+            {
+                if (source == nullptr)
+                    return;
+
+                lower_diagonal = std::min(lower_diagonal, source->lower_diagonal - growth);
+                upper_diagonal = std::max(upper_diagonal, source->upper_diagonal + growth);
+            };
+
+            span_source(sources.mismatch, 0);
+            span_source(sources.gap_open, 1);
+            span_source(sources.gap_extension, 1);
+
+            lower_diagonal = std::max(lower_diagonal, -row_count);
+            upper_diagonal = std::min(upper_diagonal, column_count);
+            current.is_valid = lower_diagonal <= upper_diagonal;
+
+            if (!current.is_valid)
+                continue;
+
+            size_t const diagonal_count = upper_diagonal - lower_diagonal + 1;
+            current.lower_diagonal = lower_diagonal;
+            current.upper_diagonal = upper_diagonal;
+            current.optimal.resize(diagonal_count);
+            current.horizontal.resize(diagonal_count);
+            current.vertical.resize(diagonal_count);
+
+            for (int64_t diagonal = lower_diagonal; diagonal <= upper_diagonal; ++diagonal)
+            {
+                auto [mismatch, horizontal, vertical] = source_offsets(sources, diagonal);
+                offset_type const optimal = std::max({mismatch, horizontal, vertical});
+                size_t const position = diagonal - lower_diagonal;
+
+                current.horizontal[position] = horizontal;
+                current.vertical[position] = vertical;
+                current.optimal[position] = (optimal < 0) ? null_offset
+                                                          : extend(sequence1, sequence2, diagonal, optimal);
+            }
+        }
+
+        return penalty;
+    }
+
+    /*!\brief Follows the matches on a diagonal starting at the given offset.
+     * \returns The offset after the last match.
+     */
+    template <typename sequence1_t, typename sequence2_t>
+    offset_type extend(sequence1_t && sequence1,
+                       sequence2_t && sequence2,
+                       int64_t const diagonal,
+                       offset_type offset) const
+    {
+        auto sequence1_it = std::ranges::begin(sequence1);
+        auto sequence2_it = std::ranges::begin(sequence2);
+
+        for (int64_t row = offset - diagonal;
+             offset < column_count && row < row_count &&
+             m_scoring_scheme.score(sequence1_it[offset], sequence2_it[row]) == m_match_score;
+             ++offset, ++row)
+        {}
+
+        return offset;
+    }
+
+    /*!\brief Computes the offsets on a diagonal before the extension from the source wavefronts.
+     * \param[in] sources  The source wavefronts of the computed wavefront.
+     * \param[in] diagonal The computed diagonal.
+     *
+     * \returns The offsets reached with a mismatch, with a gap in the second sequence and with a gap in the first
+     *          sequence. Offsets that cannot be reached or lie outside of the alignment matrix are negative.
+     */
+    std::array<offset_type, 3> source_offsets(source_wavefronts const & sources, int64_t const diagonal) const noexcept
+    {
+        offset_type mismatch = offset_of(sources.mismatch, &wavefront::optimal, diagonal) + 1;
+        offset_type horizontal = std::max(offset_of(sources.gap_open, &wavefront::optimal, diagonal - 1),
+                                          offset_of(sources.gap_extension, &wavefront::horizontal, diagonal - 1)) + 1;
+        offset_type vertical = std::max(offset_of(sources.gap_open, &wavefront::optimal, diagonal + 1),
+                                        offset_of(sources.gap_extension, &wavefront::vertical, diagonal + 1));
+
+        if (mismatch > column_count || mismatch - diagonal > row_count)
+            mismatch = null_offset;
+        if (horizontal > column_count)
+            horizontal = null_offset;
+        if (vertical - diagonal > row_count)
+            vertical = null_offset;
+
+        return {mismatch, horizontal, vertical};
+    }
+
+    /*!\brief Returns the offset of the given diagonal in the given component of a wavefront.
+     * \returns The stored offset or seqan3::detail::wavefront_alignment_algorithm::null_offset if the wavefront or
+     *          the diagonal does not exist.
+     */
+    static offset_type offset_of(wavefront const * source,
+                                 std::vector<offset_type> wavefront::* component,
+                                 int64_t const diagonal) noexcept
+    {
+        if (source == nullptr || diagonal < source->lower_diagonal || diagonal > source->upper_diagonal)
+            return null_offset;
+
+        return (source->*component)[diagonal - source->lower_diagonal];
+    }
+
+    //!\brief Returns the wavefronts the wavefront of the given penalty is computed from.
+    source_wavefronts sources_of(int64_t const penalty) const noexcept
+    {
+        return {valid_wavefront(penalty - m_mismatch_penalty),
+                valid_wavefront(penalty - m_gap_open_penalty - m_gap_extension_penalty),
+                valid_wavefront(penalty - m_gap_extension_penalty)};
+    }
+
+    //!\brief Returns the computed wavefront of the given penalty or a nullptr if no diagonal can be reached with it.
+    wavefront const * valid_wavefront(int64_t const penalty) const noexcept
+    {
+        if (penalty < 0 || !wavefront_at(penalty).is_valid)
+            return nullptr;
+
+        return &wavefront_at(penalty);
+    }
+
+    //!\brief Returns the wavefront of the given penalty and allocates it if necessary.
+    wavefront & allocate_wavefront(int64_t const penalty)
+    {
+        size_t const position = wavefront_position(penalty);
+
+        if (position >= wavefronts.size())
+            wavefronts.resize(position + 1);
+
+        return wavefronts[position];
+    }
+
+    //!\brief Returns the already computed wavefront of the given penalty.
+    wavefront const & wavefront_at(int64_t const penalty) const noexcept
+    {
+        return wavefronts[wavefront_position(penalty)];
+    }
+
+    //!\brief Returns the position of the wavefront of the given penalty in the wavefront buffer.
+    size_t wavefront_position(int64_t const penalty) const noexcept
+    {
+        if constexpr (traits_type::compute_sequence_alignment)
+            return penalty;
+        else
+            return penalty % window_size;
+    }
+
+    /*!\brief Computes the trace segments of the optimal alignment from the stored wavefronts.
+     * \param[in] penalty The penalty of the optimal alignment.
+     *
+     * \details
+     *
+     * Starting at the sink of the alignment matrix, the source of every cell is determined by recomputing the offsets
+     * it was computed from. The segments are stored in seqan3::detail::wavefront_alignment_algorithm::trace_segments.
+     */
+    void compute_trace_segments(int64_t penalty)
+    {
+        trace_segments.clear();
+
+        auto append = [&] (trace_directions const direction, size_t const count)
+        {
+            if (count == 0)
+                return;
+
+            if (!trace_segments.empty() && trace_segments.back().first == direction)
+                trace_segments.back().second += count;
+            else
+                trace_segments.emplace_back(direction, count);
+        };
+
+        int64_t const gap_penalty = m_gap_open_penalty + m_gap_extension_penalty;
+        int64_t diagonal = column_count - row_count;
+        offset_type offset = column_count;
+        trace_directions state = trace_directions::diagonal;
+
+        while (penalty > 0)
+        {
+            if (state == trace_directions::diagonal)
+            {
+                auto [mismatch, horizontal, vertical] = source_offsets(sources_of(penalty), diagonal);
+                offset_type const source = std::max({mismatch, horizontal, vertical});
+
+                append(trace_directions::diagonal, offset - source);
+                offset = source;
+
+                if (source == horizontal)
+                {
+                    state = trace_directions::left;
+                }
+                else if (source == vertical)
+                {
+                    state = trace_directions::up;
+                }
+                else
+                {
+                    append(trace_directions::diagonal, 1);
+                    --offset;
+                    penalty -= m_mismatch_penalty;
+                }
+            }
+            else if (state == trace_directions::left)
+            {
+                append(trace_directions::left, 1);
+                bool const is_open = offset_of(valid_wavefront(penalty - gap_penalty), &wavefront::optimal,
+                                               diagonal - 1) + 1 == offset;
+                penalty -= is_open ? gap_penalty : m_gap_extension_penalty;
+                state = is_open ? trace_directions::diagonal : trace_directions::left;
+                --diagonal;
+                --offset;
+            }
+            else
+            {
+                append(trace_directions::up, 1);
+                bool const is_open = offset_of(valid_wavefront(penalty - gap_penalty), &wavefront::optimal,
+                                               diagonal + 1) == offset;
+                penalty -= is_open ? gap_penalty : m_gap_extension_penalty;
+                state = is_open ? trace_directions::diagonal : trace_directions::up;
+                ++diagonal;
+            }
+        }
+
+        // The remaining offset are the matches extended from the origin.
+        append(trace_directions::diagonal, offset);
+
+        std::ranges::reverse(trace_segments);
+    }
+};
+
+} // namespace seqan3::detail
@@ -17,6 +17,9 @@
 
 #include <seqan3/alignment/band/static_band.hpp>
 #include <seqan3/alignment/pairwise/detail/alignment_algorithm_state.hpp>
+#include <seqan3/core/simd/concept.hpp>
+#include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
 #include <seqan3/core/type_traits/basic.hpp>
 #include <seqan3/range/views/slice.hpp>
 #include <seqan3/range/views/zip.hpp>
@@ -39,6 +42,19 @@ namespace seqan3::detail
  * iterators are used as a global state within this particular alignment instance and are accessed from the alignment
  * algorithm.
  *
+ * The matrices are not owned by the policy but are taken from a workspace that is local to the calling thread and
+ * shared by all instances of the same alignment algorithm type. The matrices are reinitialised in place for every
+ * alignment, such that their memory grows monotonically with the largest alignment computed on this thread and
+ * aligning further sequence pairs of at most this size does not allocate any memory. This also means that copies of
+ * the alignment algorithm, e.g. the ones created for every parallel alignment task, do not copy the matrices.
+ * The workspace is never shrunk: the memory of the largest alignment stays allocated until the thread exits.
+ *
+ * The std::function objects that type-erase the alignment algorithm and the result callback
+ * (see seqan3::detail::alignment_configurator::configure) do not allocate per alignment either. The algorithm is
+ * wrapped once per call to seqan3::align_pairwise and the callback only captures an iterator into the result buffer,
+ * which fits into the small object storage of std::function. Their cost is an indirect call per chunk of sequence
+ * pairs, which is why they were left in place.
+ *
  * \remarks The template parameters of this CRTP-policy are selected in the
  *          seqan3::detail::alignment_configurator::select_matrix_policy when selecting the alignment for the given
  *          configuration.
@@ -76,8 +92,8 @@ private:
     template <typename sequence1_t, typename sequence2_t>
     constexpr void allocate_matrix(sequence1_t && sequence1, sequence2_t && sequence2)
     {
-        score_matrix = score_matrix_t{sequence1, sequence2};
-        trace_matrix = trace_matrix_t{sequence1, sequence2};
+        score_matrix().resize(sequence1, sequence2);
+        trace_matrix().resize(sequence1, sequence2);
 
         initialise_matrix_iterator();
     }
@@ -101,7 +117,7 @@ private:
      * to be properly initialised with an infinity value. To emulate the infinity for integral values we use the
      * smallest representable value and subtract the gap extension score (assumed to be always negative) from it.
      * In the algorithm we never write to this cell and only add the extension costs to the read value. This way we
-     * can get the smallest possible value as an infinity.
+     * can get the smallest possible value as an infinity. For simd score types every lane is initialised this way.
      */
     template <typename sequence1_t, typename sequence2_t, typename score_t>
     constexpr void allocate_matrix(sequence1_t && sequence1,
@@ -111,9 +127,15 @@ private:
     {
         assert(state.gap_extension_score <= 0); // We expect it to never be positive.
 
-        score_t inf = std::numeric_limits<score_t>::lowest() - state.gap_extension_score;
-        score_matrix = score_matrix_t{sequence1, sequence2, band, inf};
-        trace_matrix = trace_matrix_t{sequence1, sequence2, band};
+        score_t inf{};
+        if constexpr (simd_concept<score_t>)
+            inf = simd::fill<score_t>(std::numeric_limits<typename simd_traits<score_t>::scalar_type>::lowest());
+        else
+            inf = std::numeric_limits<score_t>::lowest();
+
+        inf -= state.gap_extension_score;
+        score_matrix().resize(sequence1, sequence2, band, inf);
+        trace_matrix().resize(sequence1, sequence2, band);
 
         initialise_matrix_iterator();
     }
@@ -121,8 +143,8 @@ private:
     //!\brief Initialises the score and trace matrix iterator after allocating the matrices.
     constexpr void initialise_matrix_iterator() noexcept
     {
-        score_matrix_iter = score_matrix.begin();
-        trace_matrix_iter = trace_matrix.begin();
+        score_matrix_iter = score_matrix().begin();
+        trace_matrix_iter = trace_matrix().begin();
     }
 
     /*!\brief Slices the sequences according to the band parameters.
@@ -190,8 +212,31 @@ private:
         ++trace_matrix_iter;
     }
 
-    score_matrix_t score_matrix{}; //!< The scoring matrix.
-    trace_matrix_t trace_matrix{}; //!< The trace matrix if needed.
+    //!\brief The matrices reused by all alignments computed on the same thread.
+    struct workspace_type
+    {
+        score_matrix_t score_matrix{}; //!< The scoring matrix.
+        trace_matrix_t trace_matrix{}; //!< The trace matrix if needed.
+    };
+
+    //!\brief Returns the workspace of the calling thread.
+    static workspace_type & local_workspace() noexcept
+    {
+        thread_local workspace_type workspace{};
+        return workspace;
+    }
+
+    //!\brief Returns the scoring matrix of the calling thread.
+    static score_matrix_t & score_matrix() noexcept
+    {
+        return local_workspace().score_matrix;
+    }
+
+    //!\brief Returns the trace matrix of the calling thread.
+    static trace_matrix_t & trace_matrix() noexcept
+    {
+        return local_workspace().trace_matrix;
+    }
 
     typename score_matrix_t::iterator score_matrix_iter{}; //!< The matrix iterator over the score matrix.
     typename trace_matrix_t::iterator trace_matrix_iter{}; //!< The matrix iterator over the trace matrix.
@@ -0,0 +1,600 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::difference_affine_gap_policy.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap.hpp>
+#include <seqan3/alignment/matrix/trace_directions.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+// ----------------------------------------------------------------------------
+// difference_affine_gap_policy
+// ----------------------------------------------------------------------------
+
+/*!\brief The CRTP-policy that computes the global alignment of a single sequence pair with the difference recurrence.
+ * \ingroup alignment_policy
+ * \tparam alignment_algorithm_t The derived type (seqan3::detail::difference_alignment_algorithm) to be augmented
+ *                               with this CRTP-policy.
+ * \tparam score_t The scalar score type of the computed alignment; must model std::signed_integral.
+ *
+ * \details
+ *
+ * This CRTP-policy implements the recursion for the global alignment with affine gaps in the difference
+ * formulation of `Suzuki, H. and Kasahara, M. Introducing difference recurrence relations for faster semi-global
+ * alignment of long sequences. BMC Bioinformatics 19.1 (2018): 45.` Instead of the absolute scores \f$H\f$,
+ * the recursion computes the differences between adjacent cells:
+ *
+ * * \f$u_{i,j} = H_{i,j} - H_{i-1,j}\f$ and \f$v_{i,j} = H_{i,j} - H_{i,j-1}\f$,
+ * * \f$e_{i,j} = E_{i,j} - H_{i,j-1}\f$ for the vertical and \f$f_{i,j} = F_{i,j} - H_{i-1,j}\f$ for the horizontal
+ *   gaps.
+ *
+ * With \f$d = \max(s_{i,j}, e_{i,j} + u_{i,j-1}, f_{i,j} + v_{i-1,j})\f$, \f$e_{i,j} = \max(e_{i,j-1} - v_{i,j-1}
+ * + g_e, g_o)\f$ and \f$f_{i,j} = \max(f_{i-1,j} - u_{i-1,j} + g_e, g_o)\f$ the differences of the cell are
+ * \f$u_{i,j} = d - v_{i-1,j}\f$ and \f$v_{i,j} = d - u_{i,j-1}\f$, where \f$g_o\f$ is the score for opening a gap
+ * including its first extension. All differences are bounded by the gap and substitution scores and not by the
+ * length of the sequences. Hence, they fit into 8 bit lanes for typical scoring schemes, which doubles or
+ * quadruples the number of cells computed per instruction compared to the 16 and 32 bit lanes needed for the
+ * absolute scores of long sequences.
+ *
+ * The cells of one anti-diagonal do not depend on each other and are computed with simd vectors over the
+ * columns of the anti-diagonal. The score of the alignment is accumulated from the differences along a path from
+ * the origin to the sink of the matrix. The computation can be restricted to a band of diagonals that contains the
+ * origin and the sink of the matrix, such that only the cells within the band are computed. For the traceback one
+ * byte is stored per computed cell, which records the origin of the cell score and whether the gaps were extended.
+ *
+ * The anti-diagonals are computed with the simd vectors of the widest instruction set supported by the executing
+ * CPU, see seqan3::detail::invoke_simd_kernel. All buffers are padded for the widest simd vectors.
+ */
+template <typename alignment_algorithm_t, std::signed_integral score_t>
+class difference_affine_gap_policy
+{
+private:
+    //!\brief Befriends the derived class to grant it access to the private members.
+    friend alignment_algorithm_t;
+
+    //!\brief The type of the differences stored in the simd lanes.
+    using difference_t = int8_t;
+    //!\brief The padding of the buffers, i.e. the largest number of cells computed in one simd vector.
+    static constexpr size_t padding = static_cast<size_t>(simd_instruction_set::avx512) / sizeof(difference_t);
+    //!\brief The type of a trace segment, i.e. the trace direction and the number of consecutive cells it spans.
+    using trace_segment_type = std::pair<trace_directions, size_t>;
+
+    //!\brief The trace of a cell whose score stems from the diagonal.
+    static constexpr difference_t trace_diagonal = 0;
+    //!\brief The trace of a cell whose score stems from a vertical gap.
+    static constexpr difference_t trace_vertical = 1;
+    //!\brief The trace of a cell whose score stems from a horizontal gap.
+    static constexpr difference_t trace_horizontal = 2;
+    //!\brief The trace flag of a cell whose vertical gap extends the vertical gap of the cell above.
+    static constexpr difference_t trace_vertical_extension = 4;
+    //!\brief The trace flag of a cell whose horizontal gap extends the horizontal gap of the cell to the left.
+    static constexpr difference_t trace_horizontal_extension = 8;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    difference_affine_gap_policy() = default; //!< Defaulted.
+    difference_affine_gap_policy(difference_affine_gap_policy const &) = default; //!< Defaulted.
+    difference_affine_gap_policy(difference_affine_gap_policy &&) = default; //!< Defaulted.
+    difference_affine_gap_policy & operator=(difference_affine_gap_policy const &) = default; //!< Defaulted.
+    difference_affine_gap_policy & operator=(difference_affine_gap_policy &&) = default; //!< Defaulted.
+    ~difference_affine_gap_policy() = default; //!< Defaulted.
+
+    /*!\brief Initialises the gap scores from the given configuration.
+     * \tparam configuration_t The type of the alignment configuration.
+     * \param[in] config The alignment configuration.
+     */
+    template <typename configuration_t>
+    explicit difference_affine_gap_policy(configuration_t const & config)
+    {
+        auto scheme = config.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}, seqan3::gap_open_score{-10}});
+
+        m_gap_extension_score = static_cast<int32_t>(scheme.get_gap_score());
+        m_gap_open_score = static_cast<int32_t>(scheme.get_gap_score() + scheme.get_gap_open_score());
+    }
+    //!\}
+
+    /*!\brief Computes the global alignment score of the given sequence pair within the given band.
+     * \tparam sequence1_t      The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t      The type of the second sequence; must model std::ranges::forward_range.
+     * \tparam scoring_scheme_t The type of the scoring scheme.
+     * \param[in] sequence1      The first sequence, whose symbols correspond to the columns of the matrix.
+     * \param[in] sequence2      The second sequence, whose symbols correspond to the rows of the matrix.
+     * \param[in] scoring_scheme The scoring scheme.
+     * \param[in] lower_diagonal The lowest diagonal (column minus row) of the band; must not be greater than 0 and
+     *                           not greater than the diagonal of the sink.
+     * \param[in] upper_diagonal The highest diagonal of the band; must be greater than the lower diagonal, not
+     *                           smaller than 0 and not smaller than the diagonal of the sink.
+     * \param[in] store_trace    Whether the trace of the computed cells is stored for
+     *                           seqan3::detail::difference_affine_gap_policy::compute_trace_segments.
+     * \returns The score of the optimal global alignment or std::nullopt if the differences of the given scores
+     *          cannot be represented in 8 bit lanes.
+     *
+     * \details
+     *
+     * Both sequences must not be empty.
+     */
+    template <std::ranges::forward_range sequence1_t,
+              std::ranges::forward_range sequence2_t,
+              typename scoring_scheme_t>
+    std::optional<score_t> compute_difference_score(sequence1_t && sequence1,
+                                                    sequence2_t && sequence2,
+                                                    scoring_scheme_t const & scoring_scheme,
+                                                    int64_t const lower_diagonal,
+                                                    int64_t const upper_diagonal,
+                                                    bool const store_trace)
+    {
+        return invoke_simd_kernel<difference_t>([&] (auto simd_type)
+        {
+            using simd_t = typename decltype(simd_type)::type;
+            return compute_difference_score_for<simd_t>(sequence1,
+                                                        sequence2,
+                                                        scoring_scheme,
+                                                        lower_diagonal,
+                                                        upper_diagonal,
+                                                        store_trace);
+        });
+    }
+
+    /*!\brief Computes the global alignment score of the given sequence pair with the given simd vector type.
+     * \tparam simd_t The simd vector type used to compute one chunk of an anti-diagonal.
+     * \copydetails compute_difference_score
+     */
+    template <typename simd_t,
+              std::ranges::forward_range sequence1_t,
+              std::ranges::forward_range sequence2_t,
+              typename scoring_scheme_t>
+    std::optional<score_t> compute_difference_score_for(sequence1_t && sequence1,
+                                                        sequence2_t && sequence2,
+                                                        scoring_scheme_t const & scoring_scheme,
+                                                        int64_t const lower_diagonal,
+                                                        int64_t const upper_diagonal,
+                                                        bool const store_trace)
+    {
+        constexpr size_t lanes = simd_traits<simd_t>::length;
+        static_assert(lanes <= padding, "The buffers are not padded for the given simd vector type.");
+
+        using alphabet1_t = std::ranges::range_value_t<sequence1_t>;
+
+        column_count = std::ranges::distance(sequence1);
+        row_count = std::ranges::distance(sequence2);
+        int64_t const columns = column_count;
+        int64_t const rows = row_count;
+        int64_t const sink_diagonal = columns - rows;
+
+        assert(columns > 0 && rows > 0);
+        assert(lower_diagonal <= std::min<int64_t>(0, sink_diagonal));
+        assert(upper_diagonal >= std::max<int64_t>(0, sink_diagonal));
+        assert(lower_diagonal < upper_diagonal);
+
+        if constexpr (alphabet_size<alphabet1_t> > std::numeric_limits<difference_t>::max())
+            return std::nullopt;
+
+        int32_t const substitution_bound = initialise_profile(sequence1, sequence2, scoring_scheme);
+
+        // The differences of the computed cells lie within [g_o, s_max - g_o] and the intermediate values of the
+        // recursion, including the values at the band borders, within +/- (3 * s_max - 5 * g_o - 2 * g_e + 1).
+        if (m_gap_extension_score > 0 || m_gap_open_score > m_gap_extension_score ||
+            3 * substitution_bound - 5 * m_gap_open_score - 2 * m_gap_extension_score + 1 >
+                std::numeric_limits<difference_t>::max())
+        {
+            return std::nullopt;
+        }
+
+        // The difference to a cell outside of the band or the matrix, which never contributes to an inner cell.
+        difference_t const outside = static_cast<difference_t>(substitution_bound - 2 * m_gap_open_score -
+                                                               m_gap_extension_score + 1);
+        difference_t const gap_open = static_cast<difference_t>(m_gap_open_score);
+        difference_t const gap_extension = static_cast<difference_t>(m_gap_extension_score);
+
+        initialise_first_row(columns, upper_diagonal, outside);
+
+        simd_t const gap_open_vector = simd_t{} + gap_open;
+        simd_t const gap_extension_vector = simd_t{} + gap_extension;
+        simd_t const zero_vector{};
+        simd_t const vertical_trace_vector = simd_t{} + trace_vertical;
+        simd_t const horizontal_trace_vector = simd_t{} + trace_horizontal;
+        simd_t const vertical_extension_vector = simd_t{} + trace_vertical_extension;
+        simd_t const horizontal_extension_vector = simd_t{} + trace_horizontal_extension;
+
+        trace_buffer.clear();
+        trace_begin.assign(columns + rows + 1, 0);
+        trace_first_column.assign(columns + rows + 1, 0);
+
+        // The score is accumulated along a path from the origin to the sink, which stays between the main diagonal
+        // and the diagonal of the sink and thus always within the band.
+        int64_t path_column = 0;
+        int64_t path_row = 0;
+        score_t score = 0;
+
+        for (int64_t anti_diagonal = 1; anti_diagonal <= columns + rows; ++anti_diagonal)
+        {
+            // The inner cells of the anti-diagonal within the band.
+            int64_t const band_first_column = (anti_diagonal + lower_diagonal <= 0)
+                                            ? 0 : (anti_diagonal + lower_diagonal + 1) / 2;
+            int64_t const first_column = std::max({int64_t{1}, anti_diagonal - rows, band_first_column});
+            int64_t const last_column = std::min({columns, anti_diagonal - 1, (anti_diagonal + upper_diagonal) / 2});
+
+            if (first_column <= last_column)
+            {
+                initialise_lower_border(anti_diagonal, first_column, lower_diagonal, outside);
+
+                size_t const trace_offset = trace_buffer.size();
+                if (store_trace)
+                {
+                    trace_begin[anti_diagonal] = trace_offset;
+                    trace_first_column[anti_diagonal] = first_column;
+                    trace_buffer.resize(trace_offset + (last_column - first_column + 1) + padding);
+                }
+
+                // The chunks are computed from the last to the first column, such that the differences of the
+                // previous anti-diagonal can be overwritten in place.
+                for (int64_t chunk_column = last_column - static_cast<int64_t>(lanes) + 1; ;
+                     chunk_column -= static_cast<int64_t>(lanes))
+                {
+                    size_t const slot = chunk_column + padding;
+                    simd_t left_horizontal, left_vertical, left_horizontal_gap;
+                    simd_t top_horizontal, top_vertical, top_vertical_gap, top_horizontal_gap;
+                    load(left_horizontal, horizontal_differences, slot - 1);
+                    load(left_vertical, vertical_differences, slot - 1);
+                    load(left_horizontal_gap, horizontal_gap_differences, slot - 1);
+                    load(top_horizontal, horizontal_differences, slot);
+                    load(top_vertical, vertical_differences, slot);
+                    load(top_vertical_gap, vertical_gap_differences, slot);
+                    load(top_horizontal_gap, horizontal_gap_differences, slot);
+
+                    simd_t computed_lanes = ~zero_vector;
+                    if (chunk_column < first_column)
+                    {
+                        for (size_t lane = 0; lane < lanes; ++lane)
+                            computed_lanes[lane] = (chunk_column + static_cast<int64_t>(lane) >= first_column) ? -1 : 0;
+                    }
+
+                    // The lanes before the first column are computed from zeros and are not stored.
+                    simd_t const u_left = computed_lanes ? left_horizontal : zero_vector;
+                    simd_t const v_left = computed_lanes ? left_vertical : zero_vector;
+                    simd_t const f_left = computed_lanes ? left_horizontal_gap : zero_vector;
+                    simd_t const u_top = computed_lanes ? top_horizontal : zero_vector;
+                    simd_t const v_top = computed_lanes ? top_vertical : zero_vector;
+                    simd_t const e_top = computed_lanes ? top_vertical_gap : zero_vector;
+
+                    simd_t substitution;
+                    profile_scores(substitution, chunk_column, anti_diagonal);
+
+                    simd_t const vertical_extension = e_top - v_top + gap_extension_vector;
+                    simd_t const horizontal_extension = f_left - u_left + gap_extension_vector;
+                    simd_t e = vertical_extension;
+                    assign_max(e, gap_open_vector);
+                    simd_t f = horizontal_extension;
+                    assign_max(f, gap_open_vector);
+                    simd_t const vertical_score = e + u_top;
+                    simd_t const horizontal_score = f + v_left;
+                    simd_t d = substitution;
+                    assign_max(d, vertical_score);
+                    assign_max(d, horizontal_score);
+
+                    store(horizontal_differences, slot, computed_lanes ? d - v_left : top_horizontal);
+                    store(vertical_differences, slot, computed_lanes ? d - u_top : top_vertical);
+                    store(vertical_gap_differences, slot, computed_lanes ? e : top_vertical_gap);
+                    store(horizontal_gap_differences, slot, computed_lanes ? f : top_horizontal_gap);
+
+                    if (store_trace)
+                    {
+                        simd_t trace = (d == vertical_score) ? vertical_trace_vector : horizontal_trace_vector;
+                        trace = (d == substitution) ? zero_vector : trace;
+                        // Like the scalar recursion, a gap is only opened if this is strictly better than extending.
+                        trace |= (vertical_extension >= gap_open_vector) ? vertical_extension_vector : zero_vector;
+                        trace |= (horizontal_extension >= gap_open_vector) ? horizontal_extension_vector : zero_vector;
+                        store(trace_buffer, trace_offset + padding + (chunk_column - first_column), trace);
+                    }
+
+                    if (chunk_column <= first_column)
+                        break;
+                }
+            }
+
+            // Advance the path by one cell of the current anti-diagonal towards the sink.
+            bool next_column = path_column - path_row < sink_diagonal;
+            if (path_column - path_row == sink_diagonal) // Leave the diagonal of the sink only within the band.
+                next_column = sink_diagonal - 1 < lower_diagonal;
+            if (path_column == columns || path_row == rows)
+                next_column = path_row == rows;
+
+            if (next_column)
+            {
+                ++path_column;
+                score += (path_row == 0) ? first_gap_difference(path_column)
+                                         : horizontal_differences[path_column + padding];
+            }
+            else
+            {
+                ++path_row;
+                score += (path_column == 0) ? first_gap_difference(path_row)
+                                            : vertical_differences[path_column + padding];
+            }
+        }
+
+        return score;
+    }
+
+    /*!\brief Computes the trace segments of the alignment computed by the last call to
+     *        seqan3::detail::difference_affine_gap_policy::compute_difference_score.
+     * \param[out] trace_segments The trace directions and their span in order from the begin to the end of the
+     *                            alignment.
+     *
+     * \details
+     *
+     * The last computation must have stored the trace.
+     */
+    void compute_trace_segments(std::vector<trace_segment_type> & trace_segments) const
+    {
+        trace_segments.clear();
+
+        auto append = [&] (trace_directions const direction)
+        {
+            if (!trace_segments.empty() && trace_segments.back().first == direction)
+                ++trace_segments.back().second;
+            else
+                trace_segments.emplace_back(direction, 1);
+        };
+
+        size_t column = column_count;
+        size_t row = row_count;
+        difference_t state = trace_diagonal;
+
+        while (column > 0 && row > 0)
+        {
+            size_t const anti_diagonal = column + row;
+            difference_t const trace = trace_buffer[trace_begin[anti_diagonal] + padding + column -
+                                                    trace_first_column[anti_diagonal]];
+
+            if (state == trace_diagonal)
+            {
+                state = trace & 3;
+                if (state == trace_diagonal)
+                {
+                    append(trace_directions::diagonal);
+                    --column;
+                    --row;
+                }
+            }
+            else if (state == trace_vertical)
+            {
+                append(trace_directions::up);
+                state = (trace & trace_vertical_extension) ? trace_vertical : trace_diagonal;
+                --row;
+            }
+            else
+            {
+                append(trace_directions::left);
+                state = (trace & trace_horizontal_extension) ? trace_horizontal : trace_diagonal;
+                --column;
+            }
+        }
+
+        for (; column > 0; --column)
+            append(trace_directions::left);
+        for (; row > 0; --row)
+            append(trace_directions::up);
+
+        std::ranges::reverse(trace_segments);
+    }
+
+    /*!\brief Computes the substitution scores of all symbols of the first sequence's alphabet against the reversed
+     *        second sequence and stores the ranks of the first sequence.
+     * \returns The largest absolute substitution score.
+     */
+    template <typename sequence1_t, typename sequence2_t, typename scoring_scheme_t>
+    int32_t initialise_profile(sequence1_t && sequence1,
+                               sequence2_t && sequence2,
+                               scoring_scheme_t const & scoring_scheme)
+    {
+        using alphabet1_t = std::ranges::range_value_t<sequence1_t>;
+
+        profile_row_size = row_count + 2 * padding;
+        profile.assign(alphabet_size<alphabet1_t> * profile_row_size, 0);
+
+        int32_t substitution_bound = 0;
+        for (size_t rank = 0; rank < alphabet_size<alphabet1_t>; ++rank)
+        {
+            alphabet1_t const symbol = seqan3::assign_rank_to(rank, alphabet1_t{});
+            difference_t * profile_row = profile.data() + rank * profile_row_size + padding;
+
+            size_t row = row_count;
+            for (auto && symbol2 : sequence2)
+            {
+                int32_t const score = scoring_scheme.score(symbol, symbol2);
+                substitution_bound = std::max(substitution_bound, std::abs(score));
+                // Clamped, since the profile is not used if the scores do not fit.
+                profile_row[--row] = static_cast<difference_t>(std::clamp<int32_t>(score, -127, 127));
+            }
+        }
+
+        first_sequence_ranks.assign(column_count + 1 + padding, -1);
+        size_t column = padding;
+        for (auto && symbol : sequence1)
+            first_sequence_ranks[++column] = static_cast<difference_t>(seqan3::to_rank(symbol));
+
+        return substitution_bound;
+    }
+
+    /*!\brief Initialises the differences of the first row, which are read by the inner cells of the second row.
+     * \param[in] columns        The number of columns of the matrix without the first column.
+     * \param[in] upper_diagonal The highest diagonal of the band.
+     * \param[in] outside        The difference to a cell outside of the band.
+     */
+    void initialise_first_row(int64_t const columns, int64_t const upper_diagonal, difference_t const outside)
+    {
+        horizontal_differences.assign(columns + 1 + padding, 0);
+        vertical_differences.assign(columns + 1 + padding, outside);
+        vertical_gap_differences.assign(columns + 1 + padding, static_cast<difference_t>(m_gap_open_score));
+        horizontal_gap_differences.assign(columns + 1 + padding, static_cast<difference_t>(m_gap_open_score));
+
+        for (int64_t column = 1; column <= columns; ++column)
+        {
+            horizontal_differences[column + padding] = (column <= upper_diagonal)
+                                                   ? static_cast<difference_t>(first_gap_difference(column))
+                                                   : static_cast<difference_t>(-outside);
+        }
+    }
+
+    /*!\brief Sets the differences of the cell left of the first computed cell of the anti-diagonal.
+     * \param[in] anti_diagonal  The anti-diagonal to compute.
+     * \param[in] first_column   The first computed column of the anti-diagonal.
+     * \param[in] lower_diagonal The lowest diagonal of the band.
+     * \param[in] outside        The difference to a cell outside of the band.
+     *
+     * \details
+     *
+     * The left cell is either a cell of the first column or a cell below the band, which both were not computed
+     * by the previous anti-diagonal. All other cells read by the anti-diagonal were computed before or are
+     * initialised by seqan3::detail::difference_affine_gap_policy::initialise_first_row.
+     */
+    void initialise_lower_border(int64_t const anti_diagonal,
+                                 int64_t const first_column,
+                                 int64_t const lower_diagonal,
+                                 difference_t const outside)
+    {
+        int64_t const column = first_column - 1;
+        int64_t const row = anti_diagonal - first_column;
+        size_t const slot = column + padding;
+
+        if (column == 0)
+        {
+            vertical_differences[slot] = (-row >= lower_diagonal)
+                                       ? static_cast<difference_t>(first_gap_difference(row))
+                                       : static_cast<difference_t>(-outside);
+        }
+        else if (column - row < lower_diagonal)
+        {
+            vertical_differences[slot] = -outside;
+        }
+        else
+        {
+            return;
+        }
+
+        horizontal_differences[slot] = outside;
+        horizontal_gap_differences[slot] = static_cast<difference_t>(m_gap_open_score);
+    }
+
+    //!\brief Returns the difference between two adjacent cells of the first row or column.
+    int32_t first_gap_difference(int64_t const position) const noexcept
+    {
+        return (position == 1) ? m_gap_open_score : m_gap_extension_score;
+    }
+
+    /*!\name Simd helpers
+     * \brief The helpers take and modify the simd vectors by reference.
+     *
+     * \details
+     *
+     * Simd vectors wider than the ones enabled by the compiler flags must not be passed or returned by value, since
+     * this changes the ABI of the function (-Wpsabi). See seqan3::detail::invoke_simd_kernel.
+     * \{
+     */
+    //!\brief Loads the substitution scores of the cells of the anti-diagonal starting at the given column.
+    template <typename simd_t>
+    void profile_scores(simd_t & scores, int64_t const chunk_column, int64_t const anti_diagonal) const noexcept
+    {
+        simd_t ranks;
+        load(ranks, first_sequence_ranks, chunk_column + padding);
+        // The cell in column i of the anti-diagonal k aligns the second sequence at the reversed position m - k + i.
+        size_t const profile_offset = static_cast<int64_t>(row_count) - anti_diagonal + chunk_column + padding;
+        size_t const profile_rank_count = profile.size() / profile_row_size;
+
+        scores = simd_t{};
+        for (size_t rank = 0; rank < profile_rank_count; ++rank)
+        {
+            simd_t rank_scores;
+            load(rank_scores, profile, rank * profile_row_size + profile_offset);
+            scores = (ranks == static_cast<difference_t>(rank)) ? rank_scores : scores;
+        }
+    }
+
+    //!\brief Loads the simd vector from the given buffer starting at the given position.
+    template <typename simd_t, typename buffer_t>
+    static void load(simd_t & vector, buffer_t const & buffer, size_t const position) noexcept
+    {
+        assert(position + simd_traits<simd_t>::length <= buffer.size());
+        std::memcpy(&vector, buffer.data() + position, sizeof(simd_t));
+    }
+
+    //!\brief Stores the simd vector in the given buffer starting at the given position.
+    template <typename buffer_t, typename simd_t>
+    static void store(buffer_t & buffer, size_t const position, simd_t const & vector) noexcept
+    {
+        assert(position + simd_traits<simd_t>::length <= buffer.size());
+        std::memcpy(buffer.data() + position, &vector, sizeof(simd_t));
+    }
+
+    //!\brief Assigns the lane-wise maximum of both simd vectors to the left operand.
+    template <typename simd_t>
+    static void assign_max(simd_t & lhs, simd_t const & rhs) noexcept
+    {
+        lhs = (lhs < rhs) ? rhs : lhs;
+    }
+    //!\}
+
+    //!\brief The score for opening a gap including the score of its first extension.
+    int32_t m_gap_open_score{};
+    //!\brief The score for extending a gap.
+    int32_t m_gap_extension_score{};
+    //!\brief The length of the first sequence.
+    size_t column_count{};
+    //!\brief The length of the second sequence.
+    size_t row_count{};
+
+    //!\brief The substitution scores of every symbol of the first alphabet against the reversed second sequence.
+    std::vector<difference_t> profile{};
+    //!\brief The size of one row of the profile including the padding.
+    size_t profile_row_size{};
+    //!\brief The ranks of the first sequence stored at the slot of their column.
+    std::vector<difference_t> first_sequence_ranks{};
+
+    //!\brief The differences \f$u\f$ of the last computed cell of every column.
+    std::vector<difference_t> horizontal_differences{};
+    //!\brief The differences \f$v\f$ of the last computed cell of every column.
+    std::vector<difference_t> vertical_differences{};
+    //!\brief The vertical gap differences \f$e\f$ of the last computed cell of every column.
+    std::vector<difference_t> vertical_gap_differences{};
+    //!\brief The horizontal gap differences \f$f\f$ of the last computed cell of every column.
+    std::vector<difference_t> horizontal_gap_differences{};
+
+    //!\brief The trace of all computed cells, stored by anti-diagonal.
+    std::vector<difference_t> trace_buffer{};
+    //!\brief The position of the trace of every anti-diagonal in the trace buffer.
+    std::vector<size_t> trace_begin{};
+    //!\brief The first computed column of every anti-diagonal.
+    std::vector<size_t> trace_first_column{};
+};
+
+} // namespace seqan3::detail
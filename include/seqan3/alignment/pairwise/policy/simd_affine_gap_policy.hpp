@@ -142,6 +142,63 @@ private:
                                    : convert_to_simd(trace_directions::left);
     }
 
+    /*!\brief Computes the score of the first simd cell within the band.
+     * \tparam cell_t The type of the current cell [for detailed information on the type see below].
+     * \param[in,out] current_cell The current cell in the dynamic programming matrix.
+     * \param[in,out] state        The state storing hot helper variables.
+     * \param[in]     score        The score of comparing the respective letters of the first and the second sequence.
+     *
+     * \details
+     *
+     * `cell_t` is the result type of dereferencing the zipped iterator over the respective alignment score matrix and
+     * the alignment trace matrix used inside of the seqan3::detail::alignment_matrix_policy. The first parameter
+     * stored in the zipped tuple is the seqan3::detail::alignment_score_matrix_proxy and the second value is the
+     * seqan3::detail::alignment_trace_matrix_proxy.
+     *
+     * All sequence pairs of the simd vector share the same band, hence the first cell of the band lies in the same row
+     * for every lane.
+     */
+    template <typename cell_t>
+    constexpr void compute_first_band_cell(cell_t && current_cell,
+                                           alignment_algorithm_state<score_t> & state,
+                                           score_t const score) const noexcept
+    {
+        // score_cell = seqan3::detail::alignment_score_matrix_proxy
+        // trace_cell = seqan3::detail::alignment_trace_matrix_proxy
+        auto & [score_cell, trace_cell] = current_cell;
+        constexpr bool with_trace = !decays_to_ignore_v<std::remove_reference_t<decltype(trace_cell.current)>>;
+        // Precompute the diagonal score.
+        score_t tmp = score_cell.diagonal + score;
+
+        if constexpr (with_trace)
+        {
+            auto mask = tmp < score_cell.r_left;
+            tmp = (mask) ? score_cell.r_left : tmp;
+            trace_cell.current = (mask) ? trace_cell.r_left : convert_to_simd(trace_directions::diagonal);
+        }
+        else
+        {
+            tmp = (tmp < score_cell.r_left) ? score_cell.r_left : tmp;
+        }
+
+        if constexpr (align_local_t::value)
+        {
+            tmp = (tmp < simd::fill<score_t>(0))
+            /*then*/ ? (trace_cell.current = convert_to_simd(trace_directions::none), simd::fill<score_t>(0))
+            /*else*/ : tmp;
+        }
+
+        // Store the current max score.
+        score_cell.current = tmp;
+        // Check if this was the optimum. Possibly a noop.
+        static_cast<alignment_algorithm_t const &>(*this).check_score_of_cell(current_cell, state);
+
+        // At the top of the band we can not come from up but only diagonal or left, so the next vertical must be a
+        // gap open.
+        score_cell.up = tmp + state.gap_open_score;
+        trace_cell.up = convert_to_simd(trace_directions::up_open);
+    }
+
     /*!\brief Initialise the alignment state for affine gap computation.
      * \tparam alignment_configuration_t The type of alignment configuration.
      * \param[in] config The alignment configuration.
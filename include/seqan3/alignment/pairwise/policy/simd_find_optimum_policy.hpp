@@ -14,6 +14,7 @@
 
 #include <type_traits>
 
+#include <seqan3/alignment/band/static_band.hpp>
 #include <seqan3/alignment/matrix/alignment_optimum.hpp>
 #include <seqan3/alignment/pairwise/detail/alignment_algorithm_state.hpp>
 #include <seqan3/alignment/pairwise/policy/find_optimum_policy.hpp>
@@ -42,6 +43,8 @@ struct simd_global_alignment_state
     simd_t score_offset{};
     //!\brief A coordinate offset that needs to be subtracted for every alignment to get the correct end position.
     simd_t coordinate_offset{};
+    //!\brief The offset that needs to be subtracted from the row index; zero for the band relative row indices.
+    simd_t row_coordinate_offset{};
     //!\brief A mask vector storing the row indices for alignments that end in the last column of the global matrix.
     simd_t last_column_mask{};
     //!\brief A mask vector storing the column indices for alignments that end in the last row of the global matrix.
@@ -234,10 +237,69 @@ protected:
                     this->score_offset[simd_index] = padding_score * this->coordinate_offset[simd_index];
                 }
             }
+
+            this->row_coordinate_offset = this->coordinate_offset;
         }
         // else no-op
     }
 
+    /*!\brief Initialises the global alignment state for the current batch of sequences in a banded matrix.
+     *
+     * \tparam sequence1_collection_t The type of the first collection; must model std::ranges::forward_range and
+     *                                the value type must model std::ranges::forward_range.
+     * \tparam sequence2_collection_t The type of the second collection; must model std::ranges::forward_range and
+     *                                the value type must model std::ranges::forward_range.
+     * \tparam score_t The type of the scoring scheme's padding score; must model seqan3::arithmetic.
+     *
+     * \param[in] sequence1_collection The first collection used for initialisation.
+     * \param[in] sequence2_collection The second collection used for initialisation.
+     * \param[in] padding_score The padding match score used for determining the resulting score offset.
+     * \param[in] band The band shared by all sequence pairs of the batch.
+     *
+     * \details
+     *
+     * The row indices of the banded matrix are relative to the band (see
+     * seqan3::detail::alignment_trace_matrix_full_banded). The row indices stored for the alignments ending in the last
+     * column are translated accordingly. Moving along a diagonal does not change the row index within the band, hence
+     * the coordinate offset is only subtracted from the column index.
+     */
+    template <std::ranges::forward_range sequence1_collection_t,
+              std::ranges::forward_range sequence2_collection_t,
+              arithmetic score_t>
+    void initialise_find_optimum_policy(sequence1_collection_t && sequence1_collection,
+                                        sequence2_collection_t && sequence2_collection,
+                                        score_t const padding_score,
+                                        [[maybe_unused]] static_band const & band)
+    {
+        initialise_find_optimum_policy(sequence1_collection, sequence2_collection, padding_score);
+
+        if constexpr (is_global_alignment)
+        {
+            std::ptrdiff_t max_sequence1_size{};
+            std::ptrdiff_t max_sequence2_size{};
+            for (auto && [sequence1, sequence2] : views::zip(sequence1_collection, sequence2_collection))
+            {
+                max_sequence1_size = std::max<std::ptrdiff_t>(std::ranges::distance(sequence1), max_sequence1_size);
+                max_sequence2_size = std::max<std::ptrdiff_t>(std::ranges::distance(sequence2), max_sequence2_size);
+            }
+
+            // The column of the banded matrix where the upper bound of the band passes through the first row.
+            std::ptrdiff_t const band_column_index = std::min<std::ptrdiff_t>(std::max<std::ptrdiff_t>(band.upper_bound,
+                                                                                                     0),
+                                                                            max_sequence1_size);
+
+            for (size_t simd_index = 0; simd_index < simd_traits<simd_t>::length; ++simd_index)
+            {
+                if (this->last_column_mask[simd_index] <= max_sequence2_size) // Translate row into the band.
+                    this->last_column_mask[simd_index] += band_column_index - max_sequence1_size;
+                else // Mask a row that does not exist within the band.
+                    this->last_column_mask[simd_index] = -1;
+            }
+
+            this->row_coordinate_offset = simd::fill<simd_t>(0);
+        }
+    }
+
 private:
     /*!\brief Tests if the score in the current cell is greater than the current alignment optimum.
      * \tparam cell_t The type of the alignment matrix cell. The cell type corresponds to the value type of the range
@@ -297,7 +359,7 @@ private:
         state.optimum.score = mask ? score_cell.current - this->score_offset : state.optimum.score;
         state.optimum.column_index = mask ? column_positions - this->coordinate_offset
                                           : state.optimum.column_index;
-        state.optimum.row_index = mask ? row_positions - this->coordinate_offset
+        state.optimum.row_index = mask ? row_positions - this->row_coordinate_offset
                                        : state.optimum.row_index;
     }
 };
@@ -0,0 +1,437 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::striped_affine_gap_policy.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_gap.hpp>
+#include <seqan3/alignment/matrix/alignment_optimum.hpp>
+#include <seqan3/alignment/scoring/gap_scheme.hpp>
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/algorithm/configuration.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/core/simd/simd.hpp>
+#include <seqan3/range/container/aligned_allocator.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+// ----------------------------------------------------------------------------
+// striped_affine_gap_policy
+// ----------------------------------------------------------------------------
+
+/*!\brief The CRTP-policy that computes the score of a single sequence pair with the striped simd layout.
+ * \ingroup alignment_policy
+ * \tparam alignment_algorithm_t The derived type (seqan3::detail::striped_alignment_algorithm) to be augmented with
+ *                               this CRTP-policy.
+ * \tparam score_t The scalar score type of the dynamic programming matrix; must model std::signed_integral.
+ * \tparam align_local_t A std::bool_constant to switch between local and global alignment.
+ *
+ * \details
+ *
+ * This CRTP-policy implements the recursion for the alignment algorithm with affine gaps using an intra-sequence
+ * vectorisation scheme. In contrast to seqan3::detail::simd_affine_gap_policy, which computes one sequence pair
+ * per simd lane, the lanes of one simd vector hold cells of the same column of a single alignment matrix.
+ * See `Farrar, M. Striped Smith–Waterman speeds database searches six times over other SIMD implementations.
+ * Bioinformatics 23.2 (2007): 156-161.` for more information.
+ *
+ * The second sequence (the query) with length \f$m\f$ is split into \f$p\f$ stripes of \f$k = \lceil m/p \rceil\f$
+ * rows, where \f$p\f$ is the number of lanes. The query row \f$i\f$ is stored in the segment \f$i \bmod k\f$ in the
+ * lane \f$\lfloor i/k \rfloor\f$. Hence, the cells of one segment do not depend on each other and the diagonal and
+ * horizontal dependencies can be computed for the entire segment at once. The scores of all symbols of the first
+ * sequence against the query are precomputed in a query profile before the matrix is computed.
+ * The vertical dependency between the last row of a stripe and the first row of the next stripe is resolved
+ * afterwards in the lazy-F loop, which usually terminates after the first pass over the column.
+ *
+ * The alignment is computed with the same recursion and initialisation as the scalar alignment algorithm for
+ * global alignments without free end-gaps and local alignments. The score and the cell of the optimum are computed,
+ * but no trace is stored. In local alignments the column with the optimum is copied whenever the optimum improves,
+ * such that its row can be looked up after the matrix was computed. Among cells with the same score, the cell that
+ * is found first in column-major order is reported, like in the scalar alignment algorithm.
+ */
+template <typename alignment_algorithm_t, std::signed_integral score_t, typename align_local_t = std::false_type>
+class striped_affine_gap_policy
+{
+private:
+    //!\brief Befriends the derived class to grant it access to the private members.
+    friend alignment_algorithm_t;
+
+    //!\brief The type of the buffers storing the scores of all segments; aligned for the widest simd vectors.
+    using segment_buffer_t = std::vector<score_t,
+                                         aligned_allocator<score_t, static_cast<size_t>(simd_instruction_set::avx512)>>;
+
+    //!\brief The value representing minus infinity; halved such that adding scores cannot overflow.
+    static constexpr score_t minus_infinity = std::numeric_limits<score_t>::lowest() / 2;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    striped_affine_gap_policy() = default; //!< Defaulted.
+    striped_affine_gap_policy(striped_affine_gap_policy const &) = default; //!< Defaulted.
+    striped_affine_gap_policy(striped_affine_gap_policy &&) = default; //!< Defaulted.
+    striped_affine_gap_policy & operator=(striped_affine_gap_policy const &) = default; //!< Defaulted.
+    striped_affine_gap_policy & operator=(striped_affine_gap_policy &&) = default; //!< Defaulted.
+    ~striped_affine_gap_policy() = default; //!< Defaulted.
+
+    /*!\brief Initialises the gap scores from the given configuration.
+     * \tparam configuration_t The type of the alignment configuration.
+     * \param[in] config The alignment configuration.
+     */
+    template <typename configuration_t>
+    explicit striped_affine_gap_policy(configuration_t const & config)
+    {
+        auto scheme = config.template value_or<align_cfg::gap>(gap_scheme{gap_score{-1}, seqan3::gap_open_score{-10}});
+
+        gap_extension_score = static_cast<score_t>(scheme.get_gap_score());
+        gap_open_score = static_cast<score_t>(scheme.get_gap_score() + scheme.get_gap_open_score());
+    }
+    //!\}
+
+    /*!\brief Computes the optimum of the alignment of the given sequence pair.
+     * \tparam track_position   Whether the row of the local optimum is needed.
+     * \tparam sequence1_t      The type of the first sequence; must model std::ranges::forward_range.
+     * \tparam sequence2_t      The type of the second sequence; must model std::ranges::forward_range.
+     * \tparam scoring_scheme_t The type of the scoring scheme.
+     * \param[in] sequence1      The first sequence, which is iterated column-wise.
+     * \param[in] sequence2      The second sequence, which is stored in the query profile; must not be empty.
+     * \param[in] scoring_scheme The scoring scheme used to compute the query profile.
+     * \returns The score of the optimal global or local alignment and the indices of the alignment matrix cell, in
+     *          which the alignment ends. The row index of a local alignment is only set if `track_position` is `true`.
+     *
+     * \details
+     *
+     * The score is computed with the simd vectors of the widest instruction set supported by the executing CPU.
+     * See seqan3::detail::invoke_simd_kernel.
+     */
+    template <bool track_position,
+              std::ranges::forward_range sequence1_t,
+              std::ranges::forward_range sequence2_t,
+              typename scoring_scheme_t>
+    alignment_optimum<score_t> compute_striped_optimum(sequence1_t && sequence1,
+                                                       sequence2_t && sequence2,
+                                                       scoring_scheme_t const & scoring_scheme)
+    {
+        return invoke_simd_kernel<score_t>([&] (auto simd_type)
+        {
+            using simd_t = typename decltype(simd_type)::type;
+            return compute_striped_optimum_for<simd_t, track_position>(sequence1, sequence2, scoring_scheme);
+        });
+    }
+
+    /*!\brief Computes the optimum of the alignment of the given sequence pair with the given simd vector type.
+     * \tparam simd_t The simd vector type used to compute one segment of the column.
+     * \copydetails compute_striped_optimum
+     */
+    template <typename simd_t,
+              bool track_position,
+              std::ranges::forward_range sequence1_t,
+              std::ranges::forward_range sequence2_t,
+              typename scoring_scheme_t>
+    alignment_optimum<score_t> compute_striped_optimum_for(sequence1_t && sequence1,
+                                                           sequence2_t && sequence2,
+                                                           scoring_scheme_t const & scoring_scheme)
+    {
+        constexpr size_t lanes = simd_traits<simd_t>::length;
+
+        size_t const query_size = std::ranges::distance(sequence2);
+        assert(query_size > 0);
+
+        size_t const segment_count = (query_size + lanes - 1) / lanes;
+
+        initialise_query_profile<std::ranges::range_value_t<sequence1_t>, lanes>(sequence2,
+                                                                                 scoring_scheme,
+                                                                                 segment_count);
+        initialise_first_column<lanes>(segment_count);
+
+        simd_t const gap_open_vector = simd_t{} + gap_open_score;
+        simd_t const gap_extension_vector = simd_t{} + gap_extension_score;
+        simd_t const zero_vector{};
+
+        // The local optimum starts in the origin of the matrix, whose score is 0.
+        alignment_optimum<score_t> optimum{};
+        optimum.score = 0;
+        size_t column_index = 0;
+
+        score_t last_top_row_score = 0; // The score of the cell in the first row of the previous column.
+        score_t top_row_score = gap_open_score; // The score of the cell in the first row of the current column.
+
+        for (auto && symbol : sequence1)
+        {
+            ++column_index;
+            simd_t column_max{};
+
+            if constexpr (align_local_t::value)
+                top_row_score = 0;
+
+            score_t const * profile = query_profile.data() + seqan3::to_rank(symbol) * segment_count * lanes;
+
+            // The diagonal of the first segment is the last segment of the previous column shifted by one lane.
+            simd_t diagonal;
+            load(diagonal, score_column.data() + (segment_count - 1) * lanes);
+            shift_lanes(diagonal, last_top_row_score);
+            simd_t vertical = simd_t{} + minus_infinity;
+            vertical[0] = top_row_score + gap_open_score;
+
+            for (size_t segment = 0; segment < segment_count; ++segment)
+            {
+                score_t * segment_scores = score_column.data() + segment * lanes;
+                score_t * segment_horizontal = horizontal_column.data() + segment * lanes;
+                simd_t horizontal;
+                load(horizontal, segment_horizontal);
+                simd_t substitution;
+                load(substitution, profile + segment * lanes);
+
+                simd_t score = diagonal + substitution;
+                assign_max(score, horizontal);
+                assign_max(score, vertical);
+
+                if constexpr (align_local_t::value)
+                {
+                    assign_max(score, zero_vector);
+                    assign_max(column_max, score);
+                }
+
+                load(diagonal, segment_scores);
+                store(segment_scores, score);
+
+                simd_t const open_score = score + gap_open_vector;
+                horizontal += gap_extension_vector;
+                assign_max(horizontal, open_score);
+                store(segment_horizontal, horizontal);
+                vertical += gap_extension_vector;
+                assign_max(vertical, open_score);
+            }
+
+            // Lazy-F loop: propagate the vertical gaps across the stripe boundaries until no cell changes anymore.
+            // A vertical gap reaches every lane after at most `lanes` passes over the column.
+            for (size_t pass = 0; pass < lanes; ++pass)
+            {
+                shift_lanes(vertical, minus_infinity);
+
+                bool changed = true;
+                for (size_t segment = 0; segment < segment_count && changed; ++segment)
+                {
+                    score_t * segment_scores = score_column.data() + segment * lanes;
+                    score_t * segment_horizontal = horizontal_column.data() + segment * lanes;
+
+                    simd_t score;
+                    load(score, segment_scores);
+                    assign_max(score, vertical);
+                    store(segment_scores, score);
+
+                    if constexpr (align_local_t::value)
+                        assign_max(column_max, score);
+
+                    simd_t const open_score = score + gap_open_vector;
+                    simd_t horizontal;
+                    load(horizontal, segment_horizontal);
+                    assign_max(horizontal, open_score);
+                    store(segment_horizontal, horizontal);
+                    vertical += gap_extension_vector;
+                    // With linear gaps a changed cell equals the open score, hence the comparison is not strict.
+                    changed = any_greater_equal(vertical, open_score);
+                }
+
+                if (!changed)
+                    break;
+            }
+
+            // The scores before the lazy-F loop are lower bounds of the final scores, hence the maximum over both
+            // loops is the maximum of the column.
+            if constexpr (align_local_t::value)
+            {
+                score_t column_best = 0;
+                for (size_t lane = 0; lane < lanes; ++lane)
+                    column_best = std::max<score_t>(column_best, column_max[lane]);
+
+                if (column_best > optimum.score)
+                {
+                    optimum.score = column_best;
+                    optimum.column_index = column_index;
+
+                    if constexpr (track_position)
+                        optimum_column.assign(score_column.begin(), score_column.end());
+                }
+            }
+
+            last_top_row_score = top_row_score;
+            top_row_score += gap_extension_score;
+        }
+
+        auto score_of_row = [&] (segment_buffer_t const & column, size_t const row)
+        {
+            return column[(row % segment_count) * lanes + row / segment_count];
+        };
+
+        if constexpr (align_local_t::value)
+        {
+            if constexpr (track_position)
+            {
+                for (size_t row = 0; optimum.column_index > 0 && row < query_size; ++row)
+                {
+                    if (score_of_row(optimum_column, row) == optimum.score)
+                    {
+                        optimum.row_index = row + 1;
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            optimum.score = score_of_row(score_column, query_size - 1);
+            optimum.column_index = column_index;
+            optimum.row_index = query_size;
+        }
+
+        return optimum;
+    }
+
+    /*!\brief Computes the scores of all symbols of the first sequence's alphabet against the query in striped layout.
+     * \tparam alphabet1_t The alphabet type of the first sequence.
+     * \tparam lanes       The number of query rows computed in one simd vector.
+     * \param[in] sequence2      The query sequence.
+     * \param[in] scoring_scheme The scoring scheme.
+     * \param[in] segment_count  The number of segments per column.
+     *
+     * \details
+     *
+     * The rows that pad the query to a multiple of the lane count are never part of a reported alignment.
+     * In local alignments their score is set to minus infinity such that they cannot contribute to the optimum.
+     */
+    template <typename alphabet1_t, size_t lanes, typename sequence2_t, typename scoring_scheme_t>
+    void initialise_query_profile(sequence2_t && sequence2,
+                                  scoring_scheme_t const & scoring_scheme,
+                                  size_t const segment_count)
+    {
+        constexpr score_t padding_score = align_local_t::value ? minus_infinity : 0;
+
+        query_profile.assign(alphabet_size<alphabet1_t> * segment_count * lanes, padding_score);
+
+        for (size_t rank = 0; rank < alphabet_size<alphabet1_t>; ++rank)
+        {
+            alphabet1_t const symbol = seqan3::assign_rank_to(rank, alphabet1_t{});
+            score_t * profile = query_profile.data() + rank * segment_count * lanes;
+
+            size_t row = 0;
+            for (auto && query_symbol : sequence2)
+            {
+                profile[(row % segment_count) * lanes + row / segment_count] =
+                    static_cast<score_t>(scoring_scheme.score(symbol, query_symbol));
+                ++row;
+            }
+        }
+    }
+
+    /*!\brief Initialises the first column and the horizontal gap scores of the second column.
+     * \tparam lanes The number of query rows computed in one simd vector.
+     * \param[in] segment_count The number of segments per column.
+     */
+    template <size_t lanes>
+    void initialise_first_column(size_t const segment_count)
+    {
+        score_column.resize(segment_count * lanes);
+        horizontal_column.resize(segment_count * lanes);
+
+        for (size_t segment = 0; segment < segment_count; ++segment)
+        {
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                size_t const row = lane * segment_count + segment;
+                score_t score = 0;
+
+                if constexpr (!align_local_t::value)
+                    score = gap_open_score + static_cast<score_t>(row) * gap_extension_score;
+
+                score_column[segment * lanes + lane] = score;
+                horizontal_column[segment * lanes + lane] = score + gap_open_score;
+            }
+        }
+    }
+
+    /*!\name Simd helpers
+     * \brief The helpers take and modify the simd vectors by reference.
+     *
+     * \details
+     *
+     * Simd vectors wider than the ones enabled by the compiler flags must not be passed or returned by value, since
+     * this changes the ABI of the function (-Wpsabi). See seqan3::detail::invoke_simd_kernel.
+     * \{
+     */
+    //!\brief Loads the simd vector from the given segment.
+    template <typename simd_t>
+    static void load(simd_t & vector, score_t const * const segment) noexcept
+    {
+        std::memcpy(&vector, segment, sizeof(simd_t));
+    }
+
+    //!\brief Stores the simd vector in the given segment.
+    template <typename simd_t>
+    static void store(score_t * const segment, simd_t const & vector) noexcept
+    {
+        std::memcpy(segment, &vector, sizeof(simd_t));
+    }
+
+    //!\brief Assigns the lane-wise maximum of both simd vectors to the left operand.
+    template <typename simd_t>
+    static void assign_max(simd_t & lhs, simd_t const & rhs) noexcept
+    {
+        lhs = (lhs < rhs) ? rhs : lhs;
+    }
+
+    //!\brief Shifts every lane of the vector to the next lane and inserts the given value into the first lane.
+    template <typename simd_t>
+    static void shift_lanes(simd_t & vector, score_t const first) noexcept
+    {
+        for (size_t lane = simd_traits<simd_t>::length - 1; lane > 0; --lane)
+            vector[lane] = vector[lane - 1];
+
+        vector[0] = first;
+    }
+
+    //!\brief Returns `true` if any lane of the left operand is greater than or equal to the right operand.
+    template <typename simd_t>
+    static bool any_greater_equal(simd_t const & lhs, simd_t const & rhs) noexcept
+    {
+        auto const mask = lhs >= rhs;
+
+        for (size_t lane = 0; lane < simd_traits<simd_t>::length; ++lane)
+            if (mask[lane])
+                return true;
+
+        return false;
+    }
+    //!\}
+
+    //!\brief The cost of opening a gap including the cost of its first extension.
+    score_t gap_open_score{};
+    //!\brief The cost of extending a gap.
+    score_t gap_extension_score{};
+    //!\brief The query profile storing `alphabet_size * segment_count` segments.
+    segment_buffer_t query_profile{};
+    //!\brief The scores of the current column.
+    segment_buffer_t score_column{};
+    //!\brief The horizontal gap scores of the next column.
+    segment_buffer_t horizontal_column{};
+    //!\brief The scores of the column containing the local optimum.
+    segment_buffer_t optimum_column{};
+};
+
+} // namespace seqan3::detail
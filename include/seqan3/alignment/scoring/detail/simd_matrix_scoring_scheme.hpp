@@ -12,12 +12,21 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
 #include <seqan3/alignment/configuration/align_config_mode.hpp>
 #include <seqan3/alignment/scoring/scoring_scheme_concept.hpp>
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/concept/cereal.hpp>
 #include <seqan3/core/simd/concept.hpp>
+#include <seqan3/core/simd/detail/builtin_simd.hpp>
+#include <seqan3/core/simd/simd.hpp>
 #include <seqan3/core/simd/simd_algorithm.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
 #include <seqan3/std/concepts>
 
 namespace seqan3::detail
@@ -37,6 +46,15 @@ namespace seqan3::detail
  * When scoring two seqan3::detail::simd vectors, this performs element-wise lookups of the compared simd vectors
  * using the underlying scoring matrix and returns the result in another seqan3::detail::simd vector.
  *
+ * The scoring matrix is copied into a flat table of the scalar type of the simd vector with one additional row and
+ * column for the padding symbols. Thus, a score needs no call to the scalar scoring scheme. If the table is small
+ * compared to the number of lanes, e.g. for nucleotides with 8 or 16 bit scores, the table is loaded as a profile
+ * of simd vectors and the scores of all lanes are looked up with byte shuffles (`pshufb`), one per pair of vectors.
+ * Otherwise, every lane is looked up with an indexed load.
+ *
+ * The lookup only depends on the simd vector type. Within a kernel invoked by seqan3::detail::invoke_simd_kernel the
+ * shuffles are compiled for the instruction set selected at runtime.
+ *
  * \note Note that the alphabet type information is lost during the conversion to the simd vectors and
  * only the ranks of the alphabet are used.
  */
@@ -95,25 +113,46 @@ public:
      */
     constexpr simd_score_t score(simd_score_t const & lhs, simd_score_t const & rhs) const noexcept
     {
-        simd_score_t result{};
-
-        for (size_t i = 0; i < simd_traits<simd_score_t>::length; ++i)
+        if constexpr (use_profile_lookup)
         {
-            if (is_padded(lhs[i]) || is_padded(rhs[i]))
-            {
-                if constexpr (std::same_as<alignment_t, detail::global_alignment_type>)
-                    result[i] = 1;
-                else
-                    result[i] = -1;
-            }
-            else
+            using unsigned_scalar_t = std::make_unsigned_t<scalar_type>;
+            using index_t = simd_type_t<unsigned_scalar_t, length>;
+
+            // Padded symbols are negative and thus larger than the alphabet size when compared as unsigned values.
+            index_t const padding_index = simd::fill<index_t>(alphabet_size<alphabet_t>);
+            index_t row = reinterpret_cast<index_t const &>(lhs);
+            index_t column = reinterpret_cast<index_t const &>(rhs);
+            row = (row < padding_index) ? row : padding_index;
+            column = (column < padding_index) ? column : padding_index;
+
+            simd_score_t result{};
+            for (size_t chunk = 0; chunk < profile_chunk_count; ++chunk)
             {
-                result[i] = internal_scoring_scheme.score(assign_rank_to(lhs[i], alphabet_t{}),
-                                                          assign_rank_to(rhs[i], alphabet_t{}));
+                scalar_type const * const profile = score_table.data() + chunk * profile_chunk_rows * table_dimension;
+                simd_score_t low;
+                simd_score_t high;
+                std::memcpy(&low, profile, sizeof(simd_score_t));
+                std::memcpy(&high, profile + length, sizeof(simd_score_t));
+
+                // Rows before the chunk wrap around and are thus not smaller than the number of rows of the chunk.
+                index_t const chunk_row = row - static_cast<unsigned_scalar_t>(chunk * profile_chunk_rows);
+                index_t const index = chunk_row * static_cast<unsigned_scalar_t>(table_dimension) + column;
+                result = (chunk_row < static_cast<unsigned_scalar_t>(profile_chunk_rows))
+                       ? __builtin_shuffle(low, high, index)
+                       : result;
             }
+
+            return result;
         }
+        else
+        {
+            simd_score_t result{};
+
+            for (size_t i = 0; i < length; ++i)
+                result[i] = score_table[table_index(lhs[i]) * table_dimension + table_index(rhs[i])];
 
-        return result;
+            return result;
+        }
     }
     //!\}
 
@@ -124,26 +163,72 @@ public:
     }
 
 private:
-    //!\brief Internally stores the given scalar scoring scheme matrix.
-    scoring_scheme_t internal_scoring_scheme;
+    //!\brief The scalar type of the simd vector.
+    using scalar_type = typename simd_traits<simd_score_t>::scalar_type;
+
+    //!\brief The number of lanes of the simd vector.
+    static constexpr size_t length = simd_traits<simd_score_t>::length;
+
+    //!\brief The number of rows and columns of the score table, including the row and column for padded symbols.
+    static constexpr size_t table_dimension = alphabet_size<alphabet_t> + 1;
 
-    /*!\brief Store the given scoring scheme matrix into a private member variable.
-     * \param[in] scoring_scheme The scoring scheme to initialise the vectorised match and mismatch score with.
+    //!\brief The number of rows of the score table that fit into two simd vectors, i.e. that one shuffle looks up.
+    static constexpr size_t profile_chunk_rows = std::max<size_t>(1, 2 * length / table_dimension);
+
+    //!\brief The number of shuffles needed to look up a score in every row of the score table.
+    static constexpr size_t profile_chunk_count = (table_dimension + profile_chunk_rows - 1) / profile_chunk_rows;
+
+    /*!\brief Whether the scores are looked up with shuffles of the score table instead of one load per lane.
+     *
+     * \details
+     *
+     * Every shuffle needs a compare and a blend, so the profile lookup is only used if it needs at most one shuffle
+     * for four lanes, e.g. for nucleotide alphabets with 8 and 16 bit scores or for amino acids with 8 bit scores on
+     * AVX-512.
+     */
+    static constexpr bool use_profile_lookup = is_builtin_simd_v<simd_score_t> &&
+                                               table_dimension <= 2 * length &&
+                                               profile_chunk_count * 4 <= length;
+
+    //!\brief The size of the score table; padded such that the last shuffle does not read past its end.
+    static constexpr size_t table_size =
+        std::max(table_dimension * table_dimension,
+                 use_profile_lookup ? (profile_chunk_count - 1) * profile_chunk_rows * table_dimension + 2 * length
+                                    : 0);
+
+    //!\brief The scores of the scoring matrix stored row-wise, followed by the scores of the padded symbols.
+    std::array<scalar_type, table_size> score_table{};
+
+    /*!\brief Copies the given scoring scheme matrix into the score table.
+     * \param[in] scoring_scheme The scoring scheme to initialise the score table with.
+     *
+     * \throws std::invalid_argument if a score cannot be represented by the scalar type of the simd vector.
      */
     constexpr void initialise_from_scalar_scoring_scheme(scoring_scheme_t const & scoring_scheme)
     {
         using score_t = decltype(std::declval<scoring_scheme_t const &>().score(alphabet_t{}, alphabet_t{}));
-        using simd_scalar_t = typename simd_traits<simd_score_t>::scalar_type;
 
         // Check if the scoring scheme match and mismatch scores do not overflow with the respective scalar type.
-        if constexpr (sizeof(simd_scalar_t) < sizeof(score_t))
+        if constexpr (sizeof(scalar_type) < sizeof(score_t))
         {
-            if (min_or_max_exceeded<score_t, simd_scalar_t>(scoring_scheme))
+            if (min_or_max_exceeded<score_t, scalar_type>(scoring_scheme))
                 throw std::invalid_argument{"The selected scoring scheme score overflows "
                                             "for the selected scalar type of the simd type."};
         }
 
-        internal_scoring_scheme = scoring_scheme;
+        // In global alignment padded symbols always match and in local alignment they always mismatch.
+        constexpr scalar_type padding_score = std::same_as<alignment_t, detail::global_alignment_type> ? 1 : -1;
+        score_table.fill(padding_score);
+
+        for (size_t i = 0; i < alphabet_size<alphabet_t>; ++i)
+        {
+            for (size_t j = 0; j < alphabet_size<alphabet_t>; ++j)
+            {
+                score_table[i * table_dimension + j] =
+                    static_cast<scalar_type>(scoring_scheme.score(assign_rank_to(i, alphabet_t{}),
+                                                                  assign_rank_to(j, alphabet_t{})));
+            }
+        }
     }
 
     /*!\brief Check if any score in the scoring scheme matrix exceeds the min or max value allowed by the simd vector.
@@ -174,18 +259,18 @@ private:
         return false;
     }
 
-    /*!\brief Checks whether the given value is a padded value or not.
-     * \param[in] value The value to check if it is padded.
-     * \returns Returns `true` if the value is padded and `false` otherwise.
+    /*!\brief Returns the row or column of the score table for the given value.
+     * \param[in] value The rank of a symbol or a padded value.
+     * \returns The given value if it is a rank of the alphabet, otherwise the row or column of the padded symbols.
      *
-     * \details This check is done by casting the scalar type of the value into an unsigned value, and then checking
-     *          to see if this is larger than the alphabet size, which would imply that it is a padded value.
+     * \details The scalar type of the value is cast into an unsigned value, such that all padded values are larger
+     *          than the alphabet size.
      */
-    constexpr bool is_padded(typename simd_traits<simd_score_t>::scalar_type const & value) const
+    static constexpr size_t table_index(scalar_type const value) noexcept
     {
-        using unsigned_scalar_t = typename std::make_unsigned<typename simd_traits<simd_score_t>::scalar_type>::type;
+        using unsigned_scalar_t = std::make_unsigned_t<scalar_type>;
 
-        return static_cast<unsigned_scalar_t>(value) >= alphabet_size<alphabet_t>;
+        return std::min<size_t>(static_cast<unsigned_scalar_t>(value), alphabet_size<alphabet_t>);
     }
 };
 
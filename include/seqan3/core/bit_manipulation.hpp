@@ -20,6 +20,10 @@
 #include <climits>
 #include <utility>
 
+#if defined(__BMI2__)
+    #include <immintrin.h>
+#endif // defined(__BMI2__)
+
 // Find correct header for byte-order conversion functions.
 #if __has_include(<endian.h>) // unix GLIBC
     #include <endian.h>
@@ -235,6 +239,62 @@ constexpr uint8_t most_significant_bit_set(unsigned_t const n) noexcept
 #endif
 }
 
+/*!\brief Gathers the bits of a value selected by a mask into the low-order bits of the result.
+ * \ingroup core
+ *
+ * \param[in] value An unsigned integer.
+ * \param[in] mask  The bits of `value` to extract.
+ *
+ * \returns The selected bits of `value`, stored contiguously in the least significant bits in their original order.
+ *
+ * \details
+ *
+ * This is the parallel bits extract (`pext`) operation. If the BMI2 instruction set is available, the respective
+ * instruction is used. Otherwise, the bits are gathered run by run, i.e. consecutive set bits of the mask are moved
+ * with a single shift.
+ *
+ * ### Example
+ *
+ * \include test/snippet/core/detail/extract_bits.cpp
+ *
+ * ### Exception
+ *
+ * No-throw guarantee.
+ *
+ * ### Thread-safety
+ *
+ * Thread safe.
+ *
+ * ### Complexity
+ *
+ * Constant with BMI2, otherwise linear in the number of runs of set bits in `mask`.
+ */
+template <std::unsigned_integral unsigned_t>
+inline unsigned_t extract_bits(unsigned_t const value, unsigned_t mask) noexcept
+{
+#if defined(__BMI2__)
+    if constexpr (sizeof(unsigned_t) == sizeof(unsigned long long))
+        return _pext_u64(value, mask);
+    else
+        return static_cast<unsigned_t>(_pext_u32(value, mask));
+#else
+    unsigned_t result{0};
+    uint8_t result_position{0};
+
+    while (mask != 0)
+    {
+        unsigned_t const lowest_bit = mask & static_cast<unsigned_t>(~mask + 1u);
+        unsigned_t const run = mask & static_cast<unsigned_t>(~(mask + lowest_bit)); // lowest run of set bits
+
+        result |= static_cast<unsigned_t>((value & run) >> (count_trailing_zeros(lowest_bit) - result_position));
+        result_position += popcount(run);
+        mask ^= run;
+    }
+
+    return result;
+#endif
+}
+
 /*!\brief Convert the byte encoding of integer values to little-endian byte order.
  * \ingroup core
  * \tparam type The type of the value to convert; must model std::integral.
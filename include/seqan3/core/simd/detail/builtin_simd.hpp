@@ -158,7 +158,11 @@ constexpr auto default_simd_max_length<builtin_simd> = []()
  * A builtin simd type is native if the following conditions are true:
  * * the default simd max length is not equal to `0`.
  * * the max length of the simd type is at least 16 (SSE4)
- * * the max length of the simd type is at most 64 (AVX512)
+ * * the max length of the simd type is at most the default simd max length, i.e. the instructions for the simd
+ *   type are enabled by the compiler flags.
+ *
+ * Wider simd types, e.g. the ones used by seqan3::detail::invoke_simd_kernel, use the generic implementation of the
+ * simd algorithms.
  */
 template <typename builtin_simd_t>
 struct is_native_builtin_simd :
@@ -166,7 +170,8 @@ struct is_native_builtin_simd :
                        ((builtin_simd_traits_helper<builtin_simd_t>::length *
                             sizeof(typename builtin_simd_traits_helper<builtin_simd_t>::scalar_type)) >= 16) &&
                        ((builtin_simd_traits_helper<builtin_simd_t>::length *
-                            sizeof(typename builtin_simd_traits_helper<builtin_simd_t>::scalar_type)) <= 64)>
+                            sizeof(typename builtin_simd_traits_helper<builtin_simd_t>::scalar_type)) <=
+                        default_simd_max_length<builtin_simd>)>
 {};
 
 
@@ -0,0 +1,269 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::invoke_simd_kernel and the runtime detection of the simd instruction set.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+#include <seqan3/core/simd/detail/builtin_simd.hpp>
+#include <seqan3/core/simd/simd.hpp>
+
+/*!\def SEQAN3_WITH_SIMD_DISPATCH
+ * \brief Whether the simd kernels use the widest instruction set supported by the CPU at runtime.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * Enabled by default for x86-64 targets. If set to `0`, the simd kernels only use the instruction set enabled by the
+ * compiler flags, e.g. `-mavx2`.
+ */
+#ifndef SEQAN3_WITH_SIMD_DISPATCH
+#   if defined(__x86_64__)
+#       define SEQAN3_WITH_SIMD_DISPATCH 1
+#   else
+#       define SEQAN3_WITH_SIMD_DISPATCH 0
+#   endif
+#endif
+
+namespace seqan3::detail
+{
+
+/*!\brief The simd instruction sets a simd kernel can be compiled for.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * The value of an instruction set is the size of its simd vectors in bytes.
+ */
+enum struct simd_instruction_set : uint8_t
+{
+    generic = 0, //!< No simd instructions. The simd vectors hold a single value.
+    sse4 = 16,   //!< SSE4.2 with 16 byte vectors.
+    avx2 = 32,   //!< AVX2 with 32 byte vectors.
+    avx512 = 64  //!< AVX-512 (F and BW) with 64 byte vectors.
+};
+
+//!\brief The simd instruction set enabled by the compiler flags.
+//!\ingroup simd
+inline constexpr simd_instruction_set compile_time_simd_instruction_set =
+    static_cast<simd_instruction_set>(default_simd_max_length<builtin_simd>);
+
+/*!\brief Returns the widest simd instruction set supported by the executing CPU.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * The instruction set is detected once and is never narrower than the one enabled by the compiler flags. If
+ * #SEQAN3_WITH_SIMD_DISPATCH is `0`, always returns seqan3::detail::compile_time_simd_instruction_set.
+ */
+inline simd_instruction_set runtime_simd_instruction_set() noexcept
+{
+#if SEQAN3_WITH_SIMD_DISPATCH
+    static simd_instruction_set const instruction_set = [] ()
+    {
+        __builtin_cpu_init();
+
+        simd_instruction_set detected = simd_instruction_set::generic;
+        if (__builtin_cpu_supports("avx512bw"))
+            detected = simd_instruction_set::avx512;
+        else if (__builtin_cpu_supports("avx2"))
+            detected = simd_instruction_set::avx2;
+        else if (__builtin_cpu_supports("sse4.2"))
+            detected = simd_instruction_set::sse4;
+
+        return std::max(detected, compile_time_simd_instruction_set);
+    }();
+
+    return instruction_set;
+#else
+    return compile_time_simd_instruction_set;
+#endif
+}
+
+//!\brief The number of values of the given scalar type in a simd vector of the given instruction set.
+//!\ingroup simd
+template <typename scalar_t>
+constexpr size_t simd_length_for(simd_instruction_set const instruction_set) noexcept
+{
+    return std::max<size_t>(1u, static_cast<size_t>(instruction_set) / sizeof(scalar_t));
+}
+
+//!\brief The simd vector type of the given scalar type for the given instruction set.
+//!\ingroup simd
+template <typename scalar_t, simd_instruction_set instruction_set>
+using simd_type_for_t = simd_type_t<scalar_t, simd_length_for<scalar_t>(instruction_set)>;
+
+//!\brief The narrowest simd instruction set whose registers hold a vector of the given simd type.
+//!\ingroup simd
+template <typename simd_t>
+inline constexpr simd_instruction_set simd_instruction_set_of = (sizeof(simd_t) > 32) ? simd_instruction_set::avx512 :
+                                                                (sizeof(simd_t) > 16) ? simd_instruction_set::avx2 :
+                                                                (sizeof(simd_t) > 1)  ? simd_instruction_set::sse4 :
+                                                                                        simd_instruction_set::generic;
+
+#if SEQAN3_WITH_SIMD_DISPATCH
+/*!\name Instruction set specific entry points
+ * \brief Invoke the kernel with the given simd type in a function compiled for the respective instruction set.
+ * \ingroup simd
+ *
+ * \details
+ *
+ * Every function called by the kernel is inlined (`flatten`), such that the entire kernel is compiled for the
+ * instruction set and no simd vector is passed between functions compiled for different instruction sets.
+ * \{
+ */
+template <typename simd_t, typename kernel_t>
+[[gnu::target("sse4.2"), gnu::flatten]] decltype(auto) invoke_simd_kernel_sse4(kernel_t & kernel)
+{
+    return kernel(std::type_identity<simd_t>{});
+}
+
+template <typename simd_t, typename kernel_t>
+[[gnu::target("avx2"), gnu::flatten]] decltype(auto) invoke_simd_kernel_avx2(kernel_t & kernel)
+{
+    return kernel(std::type_identity<simd_t>{});
+}
+
+template <typename simd_t, typename kernel_t>
+[[gnu::target("avx512bw"), gnu::flatten]] decltype(auto) invoke_simd_kernel_avx512(kernel_t & kernel)
+{
+    return kernel(std::type_identity<simd_t>{});
+}
+//!\}
+#endif // SEQAN3_WITH_SIMD_DISPATCH
+
+//!\brief Invokes the kernel with the given simd type in a function compiled for the given instruction set.
+//!\ingroup simd
+template <simd_instruction_set instruction_set, typename simd_t, typename kernel_t>
+decltype(auto) invoke_simd_kernel_with(kernel_t & kernel)
+{
+    if constexpr (instruction_set <= compile_time_simd_instruction_set)
+        return kernel(std::type_identity<simd_t>{});
+#if SEQAN3_WITH_SIMD_DISPATCH
+    else if constexpr (instruction_set == simd_instruction_set::sse4)
+        return invoke_simd_kernel_sse4<simd_t>(kernel);
+    else if constexpr (instruction_set == simd_instruction_set::avx2)
+        return invoke_simd_kernel_avx2<simd_t>(kernel);
+    else
+        return invoke_simd_kernel_avx512<simd_t>(kernel);
+#else
+    else
+        return kernel(std::type_identity<simd_t>{});
+#endif // SEQAN3_WITH_SIMD_DISPATCH
+}
+
+//!\brief Invokes the kernel with the simd type of the given instruction set.
+//!\ingroup simd
+template <simd_instruction_set instruction_set, typename scalar_t, typename kernel_t>
+decltype(auto) invoke_simd_kernel_for(kernel_t & kernel)
+{
+    if constexpr (!SEQAN3_WITH_SIMD_DISPATCH && instruction_set > compile_time_simd_instruction_set)
+        return invoke_simd_kernel_for<compile_time_simd_instruction_set, scalar_t>(kernel);
+    else
+        return invoke_simd_kernel_with<instruction_set, simd_type_for_t<scalar_t, instruction_set>>(kernel);
+}
+
+/*!\brief Invokes the kernel with the given simd type in a function compiled for the instruction set of the simd type.
+ * \ingroup simd
+ * \tparam simd_t   The simd vector type.
+ * \tparam kernel_t The type of the kernel; must be invocable with std::type_identity over `simd_t`.
+ * \param[in] kernel The kernel to invoke.
+ * \returns The result of the kernel.
+ *
+ * \details
+ *
+ * Simd types that are wider than the instruction set enabled by the compiler flags are emulated with narrower
+ * instructions. If the executing CPU supports the instruction set of `simd_t`
+ * (see seqan3::detail::simd_instruction_set_of), the kernel is compiled for it instead. Otherwise, and if
+ * #SEQAN3_WITH_SIMD_DISPATCH is `0`, the kernel is invoked directly. The same restrictions as for
+ * seqan3::detail::invoke_simd_kernel apply to the kernel.
+ */
+template <typename simd_t, typename kernel_t>
+decltype(auto) invoke_simd_kernel_of(kernel_t && kernel)
+{
+    constexpr simd_instruction_set instruction_set = simd_instruction_set_of<simd_t>;
+
+    if constexpr (instruction_set <= compile_time_simd_instruction_set)
+    {
+        return kernel(std::type_identity<simd_t>{});
+    }
+    else
+    {
+        if (instruction_set <= runtime_simd_instruction_set())
+            return invoke_simd_kernel_with<instruction_set, simd_t>(kernel);
+        else
+            return kernel(std::type_identity<simd_t>{});
+    }
+}
+
+/*!\brief Invokes the callable with the given instruction set as std::integral_constant.
+ * \ingroup simd
+ * \tparam callable_t The type of the callable; must be invocable with a std::integral_constant over every
+ *                    seqan3::detail::simd_instruction_set and must return the same type for all of them.
+ * \param[in] callable        The callable to invoke.
+ * \param[in] instruction_set The instruction set to pass. Defaults to the widest instruction set supported by the
+ *                            executing CPU.
+ * \returns The result of the callable.
+ *
+ * \details
+ *
+ * Converts the instruction set into a compile-time constant, e.g. to configure an algorithm with the simd types of
+ * the instruction set. In contrast to seqan3::detail::invoke_simd_kernel, the callable itself is not compiled for the
+ * instruction set.
+ */
+template <typename callable_t>
+decltype(auto) visit_simd_instruction_set(callable_t && callable,
+                                          simd_instruction_set const instruction_set = runtime_simd_instruction_set())
+{
+    using set_t = simd_instruction_set;
+
+    switch (instruction_set)
+    {
+        case set_t::avx512: return callable(std::integral_constant<set_t, set_t::avx512>{});
+        case set_t::avx2: return callable(std::integral_constant<set_t, set_t::avx2>{});
+        case set_t::sse4: return callable(std::integral_constant<set_t, set_t::sse4>{});
+        default: return callable(std::integral_constant<set_t, set_t::generic>{});
+    }
+}
+
+/*!\brief Invokes the kernel with the simd vector type of the widest instruction set supported at runtime.
+ * \ingroup simd
+ * \tparam scalar_t The scalar type of the simd vectors.
+ * \tparam kernel_t The type of the kernel; must be invocable with a std::type_identity over a simd vector type of
+ *                  `scalar_t` and must return the same type for all simd vector types.
+ * \param[in] kernel          The kernel to invoke.
+ * \param[in] instruction_set The instruction set to use. Defaults to the widest instruction set supported by the
+ *                            executing CPU.
+ * \returns The result of the kernel.
+ *
+ * \details
+ *
+ * The kernel is compiled for every instruction set. The instruction sets that are wider than the one enabled by the
+ * compiler flags are only used if #SEQAN3_WITH_SIMD_DISPATCH is enabled. This way a binary compiled for a common
+ * instruction set uses the wider simd vectors of newer CPUs. Instruction sets wider than the ones supported by the
+ * executing CPU must not be requested.
+ *
+ * The kernel must not pass or return simd vectors by value to or from other functions, since the ABI of these
+ * functions differs between the instruction sets (-Wpsabi). Simd vectors should be passed by reference instead.
+ */
+template <typename scalar_t, typename kernel_t>
+decltype(auto) invoke_simd_kernel(kernel_t && kernel,
+                                  simd_instruction_set const instruction_set = runtime_simd_instruction_set())
+{
+    return visit_simd_instruction_set([&] (auto instruction_set_constant) -> decltype(auto)
+    {
+        return invoke_simd_kernel_for<decltype(instruction_set_constant)::value, scalar_t>(kernel);
+    }, instruction_set);
+}
+
+} // namespace seqan3::detail
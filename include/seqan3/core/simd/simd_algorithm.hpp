@@ -13,6 +13,7 @@
 #pragma once
 
 #include <array>
+#include <type_traits>
 #include <utility>
 
 #include <seqan3/core/simd/concept.hpp>
@@ -20,6 +21,7 @@
 #include <seqan3/core/simd/detail/simd_algorithm_sse4.hpp>
 #include <seqan3/core/simd/detail/simd_algorithm_avx2.hpp>
 #include <seqan3/core/simd/detail/simd_algorithm_avx512.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
 #include <seqan3/core/simd/simd_traits.hpp>
 #include <seqan3/std/concepts>
 
@@ -68,6 +70,46 @@ constexpr simd_t extract_impl(simd_t const & src, uint8_t const mask)
     return dst;
 }
 
+/*!\brief Transposes the given simd vector matrix with the generic shuffles of the builtin simd types.
+ * \ingroup simd
+ * \tparam simd_t The simd type; must be a builtin simd type over an integral scalar type.
+ * \param[in,out] matrix The matrix that is transposed in place.
+ *
+ * \details
+ *
+ * Interleaves the first half of the rows with the second half of the rows in log2(length) rounds, which the compiler
+ * translates into the unpack or permute instructions of the instruction set the calling function is compiled for.
+ */
+template <simd::simd_concept simd_t>
+constexpr void transpose_matrix_shuffle(std::array<simd_t, simd_traits<simd_t>::length> & matrix)
+{
+    constexpr size_t length = simd_traits<simd_t>::length;
+    using index_t = simd_type_t<std::make_unsigned_t<typename simd_traits<simd_t>::scalar_type>, length>;
+
+    // The indices interleaving the first or the second half of two vectors.
+    index_t first_half{};
+    index_t second_half{};
+    for (size_t i = 0; i < length / 2; ++i)
+    {
+        first_half[2 * i] = i;
+        first_half[2 * i + 1] = i + length;
+        second_half[2 * i] = i + length / 2;
+        second_half[2 * i + 1] = i + length / 2 + length;
+    }
+
+    std::array<simd_t, length> tmp{};
+    for (size_t round = length; round > 1; round /= 2)
+    {
+        for (size_t row = 0; row < length / 2; ++row)
+        {
+            tmp[2 * row] = __builtin_shuffle(matrix[row], matrix[row + length / 2], first_half);
+            tmp[2 * row + 1] = __builtin_shuffle(matrix[row], matrix[row + length / 2], second_half);
+        }
+
+        std::swap(tmp, matrix);
+    }
+}
+
 /*!\brief Upcasts the given vector into the target vector using signed extension of packed values.
  * \tparam target_simd_t The target simd type; must model seqan3::simd::simd_concept and must be a native builtin simd
  *                       type.
@@ -385,7 +427,22 @@ constexpr void transpose(std::array<simd_t, simd_traits<simd_t>::length> & matri
     else if constexpr (simd_traits<simd_t>::length == 32) // AVX2 implementation
         detail::transpose_matrix_avx2(matrix);
     else
-        transpose(matrix);
+        detail::transpose_matrix_shuffle(matrix);
+}
+
+// Implementation for seqan builtin simd that is wider than the instruction set enabled by the compiler flags.
+template <simd::simd_concept simd_t>
+    requires detail::is_builtin_simd_v<simd_t> &&
+             !detail::is_native_builtin_simd_v<simd_t> &&
+             std::integral<typename simd_traits<simd_t>::scalar_type> &&
+             (simd_traits<simd_t>::max_length == simd_traits<simd_t>::length) &&
+             (simd_traits<simd_t>::length >= 16)
+void transpose(std::array<simd_t, simd_traits<simd_t>::length> & matrix)
+{
+    detail::invoke_simd_kernel_of<simd_t>([&] (auto)
+    {
+        detail::transpose_matrix_shuffle(matrix);
+    });
 }
 //!\endcond
 
@@ -437,6 +494,30 @@ constexpr target_simd_t upcast(source_simd_t const & src)
         return detail::upcast_unsigned<target_simd_t>(src);
     }
 }
+
+// Implementation for seqan builtin simd that is wider than the instruction set enabled by the compiler flags.
+template <simd::simd_concept target_simd_t, simd::simd_concept source_simd_t>
+    requires detail::is_builtin_simd_v<target_simd_t> &&
+             detail::is_builtin_simd_v<source_simd_t> &&
+             !detail::is_native_builtin_simd_v<source_simd_t> &&
+             (simd_traits<source_simd_t>::max_length >= 16)
+target_simd_t upcast(source_simd_t const & src)
+{
+    static_assert(simd_traits<target_simd_t>::length <= simd_traits<source_simd_t>::length,
+                  "The length of the target simd type must be greater or equal than the length of the source simd "
+                  "type.");
+
+    // The result is not returned from the kernel, since the simd vectors must not be passed by value between functions
+    // compiled for different instruction sets.
+    target_simd_t tmp{};
+    detail::invoke_simd_kernel_of<source_simd_t>([&] (auto)
+    {
+        for (unsigned i = 0; i < simd_traits<target_simd_t>::length; ++i)
+            tmp[i] = static_cast<typename simd_traits<target_simd_t>::scalar_type>(src[i]);
+    });
+
+    return tmp;
+}
 //!\endcond
 
 } // inline namespace simd
@@ -15,6 +15,7 @@
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/core/detail/pack_algorithm.hpp>
 #include <seqan3/core/simd/concept.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
 #include <seqan3/core/simd/simd_algorithm.hpp>
 #include <seqan3/core/simd/simd_traits.hpp>
 #include <seqan3/core/simd/simd.hpp>
@@ -552,8 +553,13 @@ private:
         if (final_chunk)
             update_final_chunk_position(iterators_before_update);
 
-        simd::transpose(matrix);
-        split_into_sub_matrices(std::move(matrix));
+        // If the simd type is wider than the instruction set enabled by the compiler flags, the matrix is transposed
+        // and unpacked in a function compiled for the instruction set of the simd type.
+        invoke_simd_kernel_of<max_simd_type>([&] (auto)
+        {
+            simd::transpose(matrix);
+            split_into_sub_matrices(std::move(matrix));
+        });
     }
 
     //!\overload
@@ -31,6 +31,7 @@
  * BLAST format (e.g. seqan3::field::bit_score). Please see the corresponding formats for more details.
  */
 
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
@@ -0,0 +1,250 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::cigar_alignment.
+ */
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+
+#include <seqan3/alphabet/cigar/cigar.hpp>
+#include <seqan3/core/type_traits/basic.hpp>
+#include <seqan3/io/alignment_file/detail.hpp>
+#include <seqan3/range/decorator/gap_decorator.hpp>
+#include <seqan3/range/views/slice.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3
+{
+
+/*!\brief A pairwise alignment that is stored as a packed CIGAR and yields the gapped sequences on demand.
+ * \ingroup alignment_file
+ *
+ * \details
+ *
+ * The alignment stores the CIGAR operations in the packed 32 bit representation of the BAM format together with the
+ * aligned positions within the reference and the query sequence. It neither copies nor references any sequence, such
+ * that reading it from a SAM/BAM file neither slices the reference nor allocates gapped sequences. Reusing the same
+ * object for many records, e.g. within the record of seqan3::alignment_file_input, keeps the memory of the CIGAR.
+ *
+ * The gapped sequences are only computed on calling seqan3::cigar_alignment::alignment with the reference and the
+ * query sequence, i.e. the reference sequence the record is aligned to and seqan3::field::seq.
+ *
+ * \include test/snippet/io/alignment_file/cigar_alignment.cpp
+ *
+ * \sa seqan3::alignment_file_input_default_traits
+ */
+class cigar_alignment
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    cigar_alignment() = default; //!< Defaulted.
+    cigar_alignment(cigar_alignment const &) = default; //!< Defaulted.
+    cigar_alignment(cigar_alignment &&) = default; //!< Defaulted.
+    cigar_alignment & operator=(cigar_alignment const &) = default; //!< Defaulted.
+    cigar_alignment & operator=(cigar_alignment &&) = default; //!< Defaulted.
+    ~cigar_alignment() = default; //!< Defaulted.
+
+    /*!\brief Constructs the alignment from CIGAR operations.
+     * \tparam cigar_range_t The type of the CIGAR operations; must model std::ranges::input_range over seqan3::cigar.
+     * \param[in] operations      The CIGAR operations.
+     * \param[in] reference_begin The 0-based position of the first aligned reference character.
+     */
+    template <std::ranges::input_range cigar_range_t>
+    //!\cond
+        requires std::same_as<remove_cvref_t<std::ranges::range_reference_t<cigar_range_t>>, cigar>
+    //!\endcond
+    cigar_alignment(cigar_range_t && operations, int32_t const reference_begin)
+    {
+        assign(std::forward<cigar_range_t>(operations), reference_begin);
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Replaces the stored alignment by the given CIGAR operations.
+     * \tparam cigar_range_t The type of the CIGAR operations; must model std::ranges::input_range over seqan3::cigar.
+     * \param[in] operations      The CIGAR operations.
+     * \param[in] reference_begin The 0-based position of the first aligned reference character.
+     *
+     * \details
+     *
+     * Leading and trailing soft clipping is not part of the alignment but moves the aligned part of the query.
+     */
+    template <std::ranges::input_range cigar_range_t>
+    //!\cond
+        requires std::same_as<remove_cvref_t<std::ranges::range_reference_t<cigar_range_t>>, cigar>
+    //!\endcond
+    void assign(cigar_range_t && operations, int32_t const reference_begin)
+    {
+        clear();
+        ref_begin = reference_begin;
+
+        for (auto [count, operation] : operations)
+        {
+            char const op = operation.to_char();
+            int32_t const length = static_cast<int32_t>(count);
+
+            packed_operations.push_back((count << 4) | packed_code(op));
+
+            if (op == 'M' || op == '=' || op == 'X')
+            {
+                ref_length += length;
+                query_length += length;
+            }
+            else if (op == 'D' || op == 'N')
+            {
+                ref_length += length;
+            }
+            else if (op == 'I')
+            {
+                query_length += length;
+            }
+            else if (op == 'S' && ref_length == 0 && query_length == 0) // only leading clipping moves the query
+            {
+                query_clipped_begin += length;
+            }
+        }
+    }
+
+    //!\brief Removes all CIGAR operations, but keeps the allocated memory.
+    void clear() noexcept
+    {
+        packed_operations.clear();
+        ref_begin = 0;
+        ref_length = 0;
+        query_clipped_begin = 0;
+        query_length = 0;
+    }
+    //!\}
+
+    /*!\name Observers
+     * \{
+     */
+    //!\brief Returns whether no CIGAR operations are stored.
+    bool empty() const noexcept
+    {
+        return packed_operations.empty();
+    }
+
+    //!\brief Returns the CIGAR operations in the packed representation of the BAM format.
+    std::vector<uint32_t> const & packed_cigar() const noexcept
+    {
+        return packed_operations;
+    }
+
+    //!\brief Returns a view over the CIGAR operations as seqan3::cigar.
+    auto cigar_view() const
+    {
+        return packed_operations | std::views::transform([] (uint32_t const packed)
+        {
+            return cigar{packed >> 4, cigar_op{}.assign_char(packed_chars[packed & 0x0f])};
+        });
+    }
+
+    //!\brief Returns the 0-based position of the first aligned reference character.
+    int32_t reference_begin() const noexcept
+    {
+        return ref_begin;
+    }
+
+    //!\brief Returns the 0-based position behind the last aligned reference character.
+    int32_t reference_end() const noexcept
+    {
+        return ref_begin + ref_length;
+    }
+
+    //!\brief Returns the 0-based position of the first aligned query character, i.e. the leading soft clipping.
+    int32_t query_begin() const noexcept
+    {
+        return query_clipped_begin;
+    }
+
+    //!\brief Returns the 0-based position behind the last aligned query character.
+    int32_t query_end() const noexcept
+    {
+        return query_clipped_begin + query_length;
+    }
+
+    /*!\brief Computes the gapped reference and query sequence of the alignment.
+     * \tparam reference_t The type of the reference; must model std::ranges::viewable_range and
+     *                     std::ranges::random_access_range.
+     * \tparam query_t     The type of the query; must model std::ranges::viewable_range and
+     *                     std::ranges::random_access_range.
+     * \param[in] reference The entire reference sequence the query is aligned to.
+     * \param[in] query     The entire query sequence including soft clipped characters, i.e. seqan3::field::seq.
+     * \returns A std::tuple of two seqan3::gap_decorator over the aligned parts of the reference and the query.
+     *
+     * \details
+     *
+     * The gap decorators refer to the given sequences and are only valid as long as the sequences are. If no CIGAR
+     * operations are stored, both gapped sequences are empty.
+     */
+    template <std::ranges::viewable_range reference_t, std::ranges::viewable_range query_t>
+    //!\cond
+        requires std::ranges::random_access_range<reference_t> && std::ranges::random_access_range<query_t>
+    //!\endcond
+    auto alignment(reference_t && reference, query_t && query) const
+    {
+        std::tuple gapped{gap_decorator{std::forward<reference_t>(reference) | views::slice(reference_begin(),
+                                                                                             reference_end())},
+                          gap_decorator{std::forward<query_t>(query) | views::slice(query_begin(), query_end())}};
+
+        detail::alignment_from_cigar(gapped, cigar_view());
+        return gapped;
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Returns whether both alignments store the same CIGAR operations at the same reference position.
+    friend bool operator==(cigar_alignment const & lhs, cigar_alignment const & rhs) noexcept
+    {
+        return lhs.ref_begin == rhs.ref_begin && lhs.packed_operations == rhs.packed_operations;
+    }
+
+    //!\brief Returns whether the alignments differ.
+    friend bool operator!=(cigar_alignment const & lhs, cigar_alignment const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+private:
+    //!\brief The CIGAR characters in the order of their packed codes in the BAM format.
+    static constexpr char const * packed_chars = "MIDNSHP=X";
+
+    //!\brief Returns the packed code of the BAM format for the given CIGAR character.
+    static constexpr uint32_t packed_code(char const op) noexcept
+    {
+        uint32_t code{0};
+        while (packed_chars[code] != op)
+            ++code;
+        return code;
+    }
+
+    //!\brief The CIGAR operations, each packed as `count << 4 | code`.
+    std::vector<uint32_t> packed_operations{};
+    //!\brief The 0-based position of the first aligned reference character.
+    int32_t ref_begin{};
+    //!\brief The number of aligned reference characters.
+    int32_t ref_length{};
+    //!\brief The number of soft clipped query characters at the beginning.
+    int32_t query_clipped_begin{};
+    //!\brief The number of aligned query characters.
+    int32_t query_length{};
+};
+
+} // namespace seqan3
@@ -305,14 +305,16 @@ template <std::ranges::forward_range ref_seq_type, std::ranges::forward_range qu
     return get_cigar_string(std::tie(ref_seq, query_seq), query_start_pos, query_end_pos, extended_cigar);
 }
 
-/*!\brief Transforms a std::vector of operation-count pairs (representing the cigar string).
+/*!\brief Transforms a range of operation-count pairs (representing the cigar string).
  * \ingroup alignment_file
  *
- * \tparam alignment_type The type of alignment; must model seqan3::tuple_like and all tuple element types
- *                        must model seqan3::aligned_sequence.
+ * \tparam alignment_type   The type of alignment; must model seqan3::tuple_like and all tuple element types
+ *                          must model seqan3::aligned_sequence.
+ * \tparam cigar_range_type The type of the cigar information; must model std::ranges::input_range over
+ *                          seqan3::cigar.
  *
  * \param[in,out] alignment    The alignment to fill with gaps according to the cigar information.
- * \param[in]     cigar_vector The cigar information given as a std::vector over seqan3::cigar.
+ * \param[in]     cigar_vector The cigar information given as a range over seqan3::cigar, e.g. a std::vector.
  *
  * \details
  *
@@ -328,12 +330,13 @@ template <std::ranges::forward_range ref_seq_type, std::ranges::forward_range qu
  * ATGCCCCGTTG--C
  * ```
  */
-template <tuple_like alignment_type>
+template <tuple_like alignment_type, std::ranges::input_range cigar_range_type>
 //!\cond
     requires (std::tuple_size_v<remove_cvref_t<alignment_type>> == 2) &&
-             detail::all_satisfy_aligned_seq<detail::tuple_type_list_t<alignment_type>>
+             detail::all_satisfy_aligned_seq<detail::tuple_type_list_t<alignment_type>> &&
+             std::same_as<remove_cvref_t<std::ranges::range_reference_t<cigar_range_type>>, cigar>
 //!\endcond
-inline void alignment_from_cigar(alignment_type & alignment, std::vector<cigar> const & cigar_vector)
+inline void alignment_from_cigar(alignment_type & alignment, cigar_range_type && cigar_vector)
 {
     using std::get;
     auto current_ref_pos  = std::ranges::begin(get<0>(alignment));
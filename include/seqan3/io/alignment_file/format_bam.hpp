@@ -25,6 +25,7 @@
 #include <seqan3/core/detail/to_string.hpp>
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/core/type_traits/template_inspection.hpp>
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
 #include <seqan3/io/alignment_file/detail.hpp>
 #include <seqan3/io/alignment_file/format_sam_base.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
@@ -153,6 +154,12 @@ private:
     //!\brief Local buffer to read into while avoiding reallocation.
     std::string string_buffer{};
 
+    //!\brief Local buffer to write the binary tag fields into while avoiding reallocation.
+    std::string tag_dict_buffer{};
+
+    //!\brief The CIGAR of the current record; reused for every record to avoid reallocations.
+    std::vector<cigar> cigar_buffer{};
+
     //!\brief Stores all fixed length variables which can be read/written directly by reinterpreting the binary stream.
     struct alignment_record_core
     {   // naming corresponds to official SAM/BAM specifications
@@ -257,9 +264,11 @@ private:
     void read_field(stream_view_type && stream_view, sam_tag_dictionary & target);
 
     template <typename cigar_input_type>
-    auto parse_binary_cigar(cigar_input_type && cigar_input, uint16_t n_cigar_op) const;
+    auto parse_binary_cigar(cigar_input_type && cigar_input,
+                            uint16_t n_cigar_op,
+                            std::vector<cigar> & operations) const;
 
-    static std::string get_tag_dict_str(sam_tag_dictionary const & tag_dict);
+    std::string const & get_tag_dict_str(sam_tag_dictionary const & tag_dict);
 };
 
 //!\copydoc alignment_file_input_format::read_alignment_record
@@ -312,6 +321,10 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     static_assert(detail::decays_to_ignore_v<flag_type> || std::same_as<flag_type, sam_flag>,
                   "The type of field::flag must be seqan3::sam_flag.");
 
+    // a seqan3::cigar_alignment only stores the cigar, all other alignments store the gapped sequences
+    [[maybe_unused]] constexpr bool construct_gapped_alignment = !detail::decays_to_ignore_v<align_type> &&
+                                                                 !std::same_as<align_type, cigar_alignment>;
+
     using stream_buf_t = std::istreambuf_iterator<typename stream_type::char_type>;
     auto stream_view = std::ranges::subrange<decltype(stream_buf_t{stream}), decltype(stream_buf_t{})>
                            {stream_buf_t{stream}, stream_buf_t{}};
@@ -319,7 +332,8 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     // these variables need to be stored to compute the ALIGNMENT
     [[maybe_unused]] int32_t offset_tmp{};
     [[maybe_unused]] int32_t soft_clipping_end{};
-    [[maybe_unused]] std::vector<cigar> tmp_cigar_vector{};
+    [[maybe_unused]] std::vector<cigar> & tmp_cigar_vector = cigar_buffer; // keeps its memory across records
+    tmp_cigar_vector.clear();
     [[maybe_unused]] int32_t ref_length{0}, seq_length{0}; // length of aligned part for ref and query
 
     // Header
@@ -417,7 +431,7 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     // -------------------------------------------------------------------------------------------------------------
     if constexpr (!detail::decays_to_ignore_v<align_type> || !detail::decays_to_ignore_v<cigar_type>)
     {
-        std::tie(tmp_cigar_vector, ref_length, seq_length) = parse_binary_cigar(stream_view, core.n_cigar_op);
+        std::tie(ref_length, seq_length) = parse_binary_cigar(stream_view, core.n_cigar_op, tmp_cigar_vector);
         transfer_soft_clipping_to(tmp_cigar_vector, offset_tmp, soft_clipping_end);
         // the actual cigar_vector is swapped with tmp_cigar_vector at the end to avoid copying
     }
@@ -442,7 +456,7 @@ inline void format_bam::read_alignment_record(stream_type & stream,
 
         if constexpr (detail::decays_to_ignore_v<seq_type>)
         {
-            if constexpr (!detail::decays_to_ignore_v<align_type>)
+            if constexpr (construct_gapped_alignment)
             {
                 static_assert(sequence_container<std::remove_reference_t<decltype(get<1>(align))>>,
                               "If you want to read ALIGNMENT but not SEQ, the alignment"
@@ -512,7 +526,7 @@ inline void format_bam::read_alignment_record(stream_type & stream,
                 std::ranges::next(std::ranges::begin(stream_view));
             }
 
-            if constexpr (!detail::decays_to_ignore_v<align_type>)
+            if constexpr (construct_gapped_alignment)
             {
                 assign_unaligned(get<1>(align),
                                  seq | views::slice(static_cast<std::ranges::range_difference_t<seq_type>>(offset_tmp),
@@ -563,12 +577,12 @@ inline void format_bam::read_alignment_record(stream_type & stream,
                                    "record.")};
 
                 auto cigar_view = std::views::all(std::get<std::string>(it->second));
-                std::tie(tmp_cigar_vector, ref_length, seq_length) = parse_cigar(cigar_view);
+                std::tie(ref_length, seq_length) = parse_cigar(cigar_view, tmp_cigar_vector);
                 offset_tmp = soft_clipping_end = 0;
                 transfer_soft_clipping_to(tmp_cigar_vector, offset_tmp, soft_clipping_end);
                 tag_dict.erase(it); // remove redundant information
 
-                if constexpr (!detail::decays_to_ignore_v<align_type>)
+                if constexpr (construct_gapped_alignment)
                 {
                     assign_unaligned(get<1>(align),
                                      seq | views::slice(static_cast<std::ranges::range_difference_t<seq_type>>(offset_tmp),
@@ -579,8 +593,17 @@ inline void format_bam::read_alignment_record(stream_type & stream,
     }
 
     // Alignment object construction
-    if constexpr (!detail::decays_to_ignore_v<align_type>)
+    if constexpr (std::same_as<align_type, cigar_alignment>)
+    {
+        if (core.refID > -1 && core.pos > -1) // read is mapped
+            align.assign(tmp_cigar_vector, core.pos);
+        else
+            align.clear();
+    }
+    else if constexpr (!detail::decays_to_ignore_v<align_type>)
+    {
         construct_alignment(align, tmp_cigar_vector, core.refID, ref_seqs, core.pos, ref_length); // inherited from SAM
+    }
 
     if constexpr (!detail::decays_to_ignore_v<cigar_type>)
         std::swap(cigar_vector, tmp_cigar_vector);
@@ -765,7 +788,7 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
             cigar_vector[1] = cigar{static_cast<uint32_t>(std::ranges::distance(get<1>(align))), 'N'_cigar_op};
         }
 
-        std::string tag_dict_binary_str = get_tag_dict_str(tag_dict);
+        std::string const & tag_dict_binary_str = get_tag_dict_str(tag_dict);
 
         // Compute the value for the l_read_name field for the bam record.
         // This value is stored including a trailing `0`, so at most 254 characters of the id can be stored, since
@@ -911,7 +934,18 @@ inline void format_bam::write_alignment_record([[maybe_unused]] stream_type &  s
     } // if constexpr (!detail::decays_to_ignore_v<header_type>)
 }
 
-//!\copydoc seqan3::format_sam::read_sam_dict_vector
+/*!\brief Reads a list of values as it is the case for SAM tag arrays.
+ * \tparam stream_view_type The type of the stream as a view.
+ * \tparam value_type       The type of values to be stored in the tag array.
+ *
+ * \param[in, out] variant      A std::variant object to store the tag arrays.
+ * \param[in, out] stream_view  The stream view to iterate over.
+ * \param[in]      value        A temporary value that determines the underlying type of the tag array.
+ *
+ * \details
+ *
+ * In the BAM format, the array is stored as its length (int32_t) followed by the binary values.
+ */
 template <typename stream_view_type, typename value_type>
 inline void format_bam::read_sam_dict_vector(seqan3::detail::sam_tag_variant & variant,
                                              stream_view_type && stream_view,
@@ -1085,19 +1119,22 @@ inline void format_bam::read_field(stream_view_type && stream_view, sam_tag_dict
  *                          std::ranges::input_range.
  * \param[in] cigar_input The single pass input view over the cigar string to parse.
  * \param[in] n_cigar_op  The number of cigar elements to read from the cigar_input.
+ * \param[out] operations The vector over seqan3::cigar that describes the alignment; it is cleared first, such that
+ *                        a vector that is reused for every record keeps its memory.
  *
- * \returns A tuple of size three containing (1) std::vector over seqan3::cigar, that describes
- *          the alignment, (2) the aligned reference length, (3) the aligned query sequence length.
+ * \returns A tuple of size two containing (1) the aligned reference length, (2) the aligned query sequence length.
  *
  * \details
  *
- * For example, the view over the cigar string "1H4M1D2M2S" will return
- * `{[(H,1), (M,4), (D,1), (M,2), (S,2)], 7, 6}`.
+ * For example, the view over the cigar string "1H4M1D2M2S" will fill `operations` with
+ * `[(H,1), (M,4), (D,1), (M,2), (S,2)]` and return `{7, 6}`.
  */
 template <typename cigar_input_type>
-inline auto format_bam::parse_binary_cigar(cigar_input_type && cigar_input, uint16_t n_cigar_op) const
+inline auto format_bam::parse_binary_cigar(cigar_input_type && cigar_input,
+                                           uint16_t n_cigar_op,
+                                           std::vector<cigar> & operations) const
 {
-    std::vector<cigar> operations{};
+    operations.clear();
     char operation{'\0'};
     uint32_t count{};
     int32_t ref_length{}, seq_length{};
@@ -1106,7 +1143,7 @@ inline auto format_bam::parse_binary_cigar(cigar_input_type && cigar_input, uint
     constexpr uint32_t cigar_mask = 0x0f; // 0000000000001111
 
     if (n_cigar_op == 0) // [[unlikely]]
-        return std::tuple{operations, ref_length, seq_length};
+        return std::tuple{ref_length, seq_length};
 
     // parse the rest of the cigar
     // -------------------------------------------------------------------------------------------------------------
@@ -1123,15 +1160,17 @@ inline auto format_bam::parse_binary_cigar(cigar_input_type && cigar_input, uint
         --n_cigar_op;
     }
 
-    return std::tuple{operations, ref_length, seq_length};
+    return std::tuple{ref_length, seq_length};
 }
 
 /*!\brief Writes the optional fields of the seqan3::sam_tag_dictionary.
  * \param[in] tag_dict The tag dictionary to print.
+ * \returns The binary representation of the tag fields, which is valid until the next call of this function.
  */
-inline std::string format_bam::get_tag_dict_str(sam_tag_dictionary const & tag_dict)
+inline std::string const & format_bam::get_tag_dict_str(sam_tag_dictionary const & tag_dict)
 {
-    std::string result{};
+    std::string & result = tag_dict_buffer;
+    result.clear();
 
     auto stream_variant_fn = [&result] (auto && arg) // helper to print an std::variant
     {
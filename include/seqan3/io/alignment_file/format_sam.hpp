@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <array>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <seqan3/core/char_operations/predicate.hpp>
@@ -22,6 +24,7 @@
 #include <seqan3/core/detail/to_string.hpp>
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/core/type_traits/template_inspection.hpp>
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
 #include <seqan3/io/alignment_file/detail.hpp>
 #include <seqan3/io/alignment_file/format_sam_base.hpp>
 #include <seqan3/io/alignment_file/header.hpp>
@@ -248,6 +251,12 @@ private:
     //!\brief Tracks whether reference information (\@SR tag) were found in the SAM header
     bool ref_info_present_in_header{false};
 
+    //!\brief The line of the current record; reused for every record to avoid reallocations.
+    std::string record_line{};
+
+    //!\brief The CIGAR of the current record; reused for every record to avoid reallocations.
+    std::vector<cigar> cigar_buffer{};
+
     //!brief Returns a reference to dummy if passed a std::ignore.
     std::string_view const & default_or(detail::ignore_t) const noexcept
     {
@@ -263,13 +272,12 @@ private:
 
     using format_sam_base::read_field; // inherit read_field functions from format_base explicitly
 
-    template <typename stream_view_type, typename value_type>
-    void read_sam_dict_vector(seqan3::detail::sam_tag_variant & variant,
-                              stream_view_type && stream_view,
-                              value_type value);
+    std::string_view split_record_line(std::array<std::string_view, 11> & fields) const;
 
-    template <typename stream_view_type>
-    void read_field(stream_view_type && stream_view, sam_tag_dictionary & target);
+    template <typename value_type>
+    void read_sam_dict_vector(seqan3::detail::sam_tag_variant & variant, std::string_view values, value_type value);
+
+    void read_field(std::string_view const tag_field, sam_tag_dictionary & target);
 
     template <typename stream_it_t, std::ranges::forward_range field_type>
     void write_range(stream_it_t & stream_it, field_type && field_value);
@@ -406,15 +414,19 @@ inline void format_sam::read_alignment_record(stream_type & stream,
                   detail::is_type_specialisation_of_v<ref_offset_type, std::optional>,
                   "The ref_offset must be a specialisation of std::optional.");
 
+    // a seqan3::cigar_alignment only stores the cigar, all other alignments store the gapped sequences
+    [[maybe_unused]] constexpr bool construct_gapped_alignment = !detail::decays_to_ignore_v<align_type> &&
+                                                                 !std::same_as<align_type, cigar_alignment>;
+
     auto stream_view = views::istreambuf(stream);
-    auto field_view = stream_view | views::take_until_or_throw_and_consume(is_char<'\t'>);
 
     // these variables need to be stored to compute the ALIGNMENT
     int32_t ref_offset_tmp{};
     std::ranges::range_value_t<decltype(header.ref_ids())> ref_id_tmp{};
     [[maybe_unused]] int32_t offset_tmp{};
     [[maybe_unused]] int32_t soft_clipping_end{};
-    [[maybe_unused]] std::vector<cigar> tmp_cigar_vector{};
+    [[maybe_unused]] std::vector<cigar> & tmp_cigar_vector = cigar_buffer; // keeps its memory across records
+    tmp_cigar_vector.clear();
     [[maybe_unused]] int32_t ref_length{0}, seq_length{0}; // length of aligned part for ref and query
 
     // Header
@@ -427,18 +439,27 @@ inline void format_sam::read_alignment_record(stream_type & stream,
             return;
     }
 
+    // Read the record line at once and split it into its fields
+    // -------------------------------------------------------------------------------------------------------------
+    record_line.clear();
+    std::ranges::begin(stream_view).read_line(record_line);
+    detail::consume(stream_view | views::take_until(!(is_char<'\r'> || is_char<'\n'>))); // consume empty lines
+
+    std::array<std::string_view, 11> fields{};
+    [[maybe_unused]] std::string_view tag_fields = split_record_line(fields);
+
     // Fields 1-5: ID FLAG REF_ID REF_OFFSET MAPQ
     // -------------------------------------------------------------------------------------------------------------
-    read_field(field_view, id);
+    read_field(fields[0], id);
 
     uint16_t flag_integral{};
-    read_field(field_view, flag_integral);
+    read_field(fields[1], flag_integral);
     flag = sam_flag{flag_integral};
 
-    read_field(field_view, ref_id_tmp);
+    read_field(fields[2], ref_id_tmp);
     check_and_assign_ref_id(ref_id, ref_id_tmp, header, ref_seqs);
 
-    read_field(field_view, ref_offset_tmp);
+    read_field(fields[3], ref_offset_tmp);
     --ref_offset_tmp; // SAM format is 1-based but SeqAn operates 0-based
 
     if (ref_offset_tmp == -1)
@@ -448,26 +469,18 @@ inline void format_sam::read_alignment_record(stream_type & stream,
     else if (ref_offset_tmp < -1)
         throw format_error{"No negative values are allowed for field::ref_offset."};
 
-    read_field(field_view, mapq);
+    read_field(fields[4], mapq);
 
     // Field 6: CIGAR
     // -------------------------------------------------------------------------------------------------------------
     if constexpr (!detail::decays_to_ignore_v<align_type> || !detail::decays_to_ignore_v<cigar_type>)
     {
-        if (!is_char<'*'>(*std::ranges::begin(stream_view))) // no cigar information given
+        if (fields[5] != "*") // cigar information given
         {
-            std::tie(tmp_cigar_vector, ref_length, seq_length) = parse_cigar(field_view);
+            std::tie(ref_length, seq_length) = parse_cigar(fields[5], tmp_cigar_vector);
             transfer_soft_clipping_to(tmp_cigar_vector, offset_tmp, soft_clipping_end);
             // the actual cigar_vector is swapped with tmp_cigar_vector at the end to avoid copying
         }
-        else
-        {
-            std::ranges::next(std::ranges::begin(field_view)); // skip '*'
-        }
-    }
-    else
-    {
-        detail::consume(field_view);
     }
 
     offset = offset_tmp;
@@ -477,7 +490,7 @@ inline void format_sam::read_alignment_record(stream_type & stream,
     if constexpr (!detail::decays_to_ignore_v<mate_type>)
     {
         std::ranges::range_value_t<decltype(header.ref_ids())> tmp_mate_ref_id{};
-        read_field(field_view, tmp_mate_ref_id); // RNEXT
+        read_field(fields[6], tmp_mate_ref_id); // RNEXT
 
         if (tmp_mate_ref_id == "=") // indicates "same as ref id"
         {
@@ -492,7 +505,7 @@ inline void format_sam::read_alignment_record(stream_type & stream,
         }
 
         int32_t tmp_pnext{};
-        read_field(field_view, tmp_pnext); // PNEXT
+        read_field(fields[7], tmp_pnext); // PNEXT
 
         if (tmp_pnext > 0)
             get<1>(mate) = --tmp_pnext; // SAM format is 1-based but SeqAn operates 0-based.
@@ -500,34 +513,24 @@ inline void format_sam::read_alignment_record(stream_type & stream,
             throw format_error{"No negative values are allowed at the mate mapping position."};
         // tmp_pnext == 0 indicates an unmapped mate -> do not fill std::optional get<1>(mate)
 
-        read_field(field_view, get<2>(mate)); // TLEN
-    }
-    else
-    {
-        for (size_t i = 0; i < 3u; ++i)
-        {
-            detail::consume(field_view);
-        }
+        read_field(fields[8], get<2>(mate)); // TLEN
     }
 
     // Field 10: Sequence
     // -------------------------------------------------------------------------------------------------------------
-    if (!is_char<'*'>(*std::ranges::begin(stream_view))) // sequence information is given
+    std::string_view const seq_field = fields[9];
+
+    if (seq_field != "*") // sequence information is given
     {
+        // enforce the legal alphabet on the whole field before converting it at once
         auto constexpr is_legal_alph = is_in_alphabet<seq_legal_alph_type>;
-        auto seq_stream = field_view | std::views::transform([is_legal_alph] (char const c) // enforce legal alphabet
-                                       {
-                                           if (!is_legal_alph(c))
-                                               throw parse_error{std::string{"Encountered an unexpected letter: "} +
-                                                                 is_legal_alph.msg +
-                                                                 " evaluated to false on " +
-                                                                 detail::make_printable(c)};
-                                           return c;
-                                       });
+        if (auto it = std::ranges::find_if_not(seq_field, is_legal_alph); it != std::ranges::end(seq_field))
+            throw parse_error{std::string{"Encountered an unexpected letter: "} + is_legal_alph.msg +
+                              " evaluated to false on " + detail::make_printable(*it)};
 
         if constexpr (detail::decays_to_ignore_v<seq_type>)
         {
-            if constexpr (!detail::decays_to_ignore_v<align_type>)
+            if constexpr (construct_gapped_alignment)
             {
                 static_assert(sequence_container<std::remove_reference_t<decltype(get<1>(align))>>,
                               "If you want to read ALIGNMENT but not SEQ, the alignment"
@@ -535,33 +538,26 @@ inline void format_sam::read_alignment_record(stream_type & stream,
 
                 if (!tmp_cigar_vector.empty()) // only parse alignment if cigar information was given
                 {
-
-                    auto tmp_iter = std::ranges::begin(seq_stream);
-                    std::ranges::advance(tmp_iter, offset_tmp);
-
-                    for (; seq_length > 0; --seq_length) // seq_length is not needed anymore
-                    {
-                        get<1>(align).push_back(std::ranges::range_value_t<decltype(get<1>(align))>{}.assign_char(*tmp_iter));
-                        ++tmp_iter;
-                    }
-
-                    std::ranges::advance(tmp_iter, soft_clipping_end);
+                    if (static_cast<size_t>(offset_tmp) + seq_length > seq_field.size())
+                        throw format_error{"The CIGAR string covers more query characters than the SEQ field has."};
+
+                    using query_alphabet_t = std::ranges::range_value_t<decltype(get<1>(align))>;
+                    auto aligned_query = seq_field.substr(offset_tmp, seq_length) | views::char_to<query_alphabet_t>;
+                    get<1>(align).insert(std::ranges::end(get<1>(align)),
+                                         std::ranges::begin(aligned_query),
+                                         std::ranges::end(aligned_query));
                 }
                 else
                 {
                     get<1>(align) = std::remove_reference_t<decltype(get<1>(align))>{}; // empty container
                 }
             }
-            else
-            {
-                detail::consume(seq_stream);
-            }
         }
         else
         {
-            read_field(seq_stream, seq);
+            read_field(seq_field, seq);
 
-            if constexpr (!detail::decays_to_ignore_v<align_type>)
+            if constexpr (construct_gapped_alignment)
             {
                 if (!tmp_cigar_vector.empty()) // if no alignment info is given, the field::alignment should remain empty
                 {
@@ -572,15 +568,10 @@ inline void format_sam::read_alignment_record(stream_type & stream,
             }
         }
     }
-    else
-    {
-        std::ranges::next(std::ranges::begin(field_view)); // skip '*'
-    }
 
     // Field 11:  Quality
     // -------------------------------------------------------------------------------------------------------------
-    auto const tab_or_end = is_char<'\t'> || is_char<'\r'> || is_char<'\n'>;
-    read_field(stream_view | views::take_until_or_throw(tab_or_end), qual);
+    read_field(fields[10], qual);
 
     if constexpr (!detail::decays_to_ignore_v<seq_type> && !detail::decays_to_ignore_v<qual_type>)
     {
@@ -595,19 +586,28 @@ inline void format_sam::read_alignment_record(stream_type & stream,
 
     // All remaining optional fields if any: SAM tags dictionary
     // -------------------------------------------------------------------------------------------------------------
-    while (is_char<'\t'>(*std::ranges::begin(stream_view))) // read all tags if present
+    if constexpr (!detail::decays_to_ignore_v<tag_dict_type>)
     {
-        std::ranges::next(std::ranges::begin(stream_view)); // skip tab
-        read_field(stream_view | views::take_until_or_throw(tab_or_end), tag_dict);
+        while (!tag_fields.empty()) // read all tags if present
+        {
+            size_t const tab_position = tag_fields.find('\t');
+            read_field(tag_fields.substr(0, tab_position), tag_dict);
+            tag_fields.remove_prefix((tab_position == std::string_view::npos) ? tag_fields.size() : tab_position + 1);
+        }
     }
 
-    detail::consume(stream_view | views::take_until(!(is_char<'\r'> || is_char<'\n'>))); // consume new line
-
     // DONE READING - wrap up
     // -------------------------------------------------------------------------------------------------------------
     // Alignment object construction
     // Note that the query sequence in get<1>(align) has already been filled while reading Field 10.
-    if constexpr (!detail::decays_to_ignore_v<align_type>)
+    if constexpr (std::same_as<align_type, cigar_alignment>)
+    {
+        if (!ref_id_tmp.empty() && ref_offset_tmp > -1) // read is mapped
+            align.assign(tmp_cigar_vector, ref_offset_tmp);
+        else
+            align.clear();
+    }
+    else if constexpr (!detail::decays_to_ignore_v<align_type>)
     {
         int32_t ref_idx{(ref_id_tmp.empty()/*unmapped read?*/) ? -1 : 0};
 
@@ -902,45 +902,80 @@ inline void format_sam::write_alignment_record(stream_type & stream,
 }
 
 
+/*!\brief Splits seqan3::format_sam::record_line into the 11 mandatory fields and the optional tag fields.
+ * \param[out] fields The 11 mandatory fields of the record.
+ * \returns The remaining tab separated tag fields; empty if the record has none.
+ *
+ * \throws seqan3::format_error if the record has less than 11 fields.
+ *
+ * \details
+ *
+ * A trailing `'\r'` is removed. The tabs are located with std::string_view::find, i.e. `memchr`, which scans the
+ * line in vectorised chunks instead of inspecting one character after the other.
+ */
+inline std::string_view format_sam::split_record_line(std::array<std::string_view, 11> & fields) const
+{
+    std::string_view line{record_line};
+
+    if (!line.empty() && line.back() == '\r')
+        line.remove_suffix(1);
+
+    for (size_t i = 0; i < fields.size(); ++i)
+    {
+        size_t const tab_position = line.find('\t');
+
+        if (tab_position == std::string_view::npos)
+        {
+            if (i + 1 != fields.size())
+                throw format_error{detail::to_string("[CORRUPTED SAM FILE] The record has only ", i + 1,
+                                                     " of the 11 mandatory fields.")};
+
+            fields[i] = line;
+            return {};
+        }
+
+        fields[i] = line.substr(0, tab_position);
+        line.remove_prefix(tab_position + 1);
+    }
+
+    return line;
+}
+
 /*!\brief Reads a list of values separated by comma as it is the case for SAM tag arrays.
- * \tparam stream_view_type The type of the stream as a view.
- * \tparam value_type       The type of values to be stored in the tag array.
+ * \tparam value_type The type of values to be stored in the tag array.
  *
- * \param[in, out] variant      A std::variant object to store the tag arrays.
- * \param[in, out] stream_view  The stream view to iterate over.
- * \param[in]      value        A temporary value that determines the underlying type of the tag array.
+ * \param[in, out] variant A std::variant object to store the tag arrays.
+ * \param[in]      values  The comma separated values of the tag array.
+ * \param[in]      value   A temporary value that determines the underlying type of the tag array.
  *
  * \details
  *
  * Reading the tags is done according to the official
  * [SAM format specifications](https://samtools.github.io/hts-specs/SAMv1.pdf).
  *
- * The function throws a seqan3::format_error if any unknown tag type was encountered. It will also fail if the
- * format is not in a correct state (e.g. required fields are not given), but throwing might occur downstream of
- * the actual error.
+ * The function throws a seqan3::format_error if any value cannot be converted to value_type.
  */
-template <typename stream_view_type, typename value_type>
+template <typename value_type>
 inline void format_sam::read_sam_dict_vector(seqan3::detail::sam_tag_variant & variant,
-                                             stream_view_type && stream_view,
+                                             std::string_view values,
                                              value_type value)
 {
     std::vector<value_type> tmp_vector;
-    while (std::ranges::begin(stream_view) != ranges::end(stream_view)) // not fully consumed yet
+
+    while (!values.empty()) // not fully consumed yet
     {
-        read_field(stream_view | views::take_until(is_char<','>), value);
+        size_t const comma_position = values.find(',');
+        read_field(values.substr(0, comma_position), value);
         tmp_vector.push_back(value);
-
-        if (is_char<','>(*std::ranges::begin(stream_view)))
-            std::ranges::next(std::ranges::begin(stream_view)); // skip ','
+        values.remove_prefix((comma_position == std::string_view::npos) ? values.size() : comma_position + 1);
     }
+
     variant = std::move(tmp_vector);
 }
 
-/*!\brief Reads the optional tag fields into the seqan3::sam_tag_dictionary.
- * \tparam stream_view_type   The type of the stream as a view.
- *
- * \param[in, out] stream_view  The stream view to iterate over.
- * \param[in, out] target       The seqan3::sam_tag_dictionary to store the tag information.
+/*!\brief Reads a single optional tag field into the seqan3::sam_tag_dictionary.
+ * \param[in]      tag_field The tag field of the current line, i.e. without the separating tabs.
+ * \param[in, out] target    The seqan3::sam_tag_dictionary to store the tag information.
  *
  * \throws seqan3::format_error if any unexpected character or format is encountered.
  *
@@ -953,48 +988,49 @@ inline void format_sam::read_sam_dict_vector(seqan3::detail::sam_tag_variant & v
  * format is not in a correct state (e.g. required fields are not given), but throwing might occur downstream of
  * the actual error.
  */
-template <typename stream_view_type>
-inline void format_sam::read_field(stream_view_type && stream_view, sam_tag_dictionary & target)
+inline void format_sam::read_field(std::string_view const tag_field, sam_tag_dictionary & target)
 {
     /* Every SAM tag has the format "[TAG]:[TYPE_ID]:[VALUE]", where TAG is a two letter
        name tag which is converted to a unique integer identifier and TYPE_ID is one character in [A,i,Z,H,B,f]
        describing the type for the upcoming VALUES. If TYPE_ID=='B' it signals an array of comma separated
        VALUE's and the inner value type is identified by the character following ':', one of [cCsSiIf].
     */
-    uint16_t tag = static_cast<uint16_t>(*std::ranges::begin(stream_view)) << 8;
-    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
-    tag += static_cast<uint16_t>(*std::ranges::begin(stream_view));
-    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
-    std::ranges::next(std::ranges::begin(stream_view)); // skip ':'
-    char type_id = *std::ranges::begin(stream_view);
-    std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
-    std::ranges::next(std::ranges::begin(stream_view)); // skip ':'
+    if (tag_field.size() < 5 || tag_field[2] != ':' || tag_field[4] != ':')
+        throw format_error{std::string("The SAM tag '") + std::string{tag_field} + "' is not of the format "
+                           "[TAG]:[TYPE_ID]:[VALUE]."};
+
+    uint16_t const tag = (static_cast<uint16_t>(tag_field[0]) << 8) + static_cast<uint16_t>(tag_field[1]);
+    char const type_id = tag_field[3];
+    std::string_view value = tag_field.substr(5);
 
     switch (type_id)
     {
         case 'A' : // char
         {
-            target[tag] = static_cast<char>(*std::ranges::begin(stream_view));
-            std::ranges::next(std::ranges::begin(stream_view)); // skip char that has been read
+            if (value.size() != 1)
+                throw format_error{std::string("The value of the SAM tag '") + std::string{tag_field} +
+                                   "' must be a single character."};
+
+            target[tag] = value[0];
             break;
         }
         case 'i' : // int32_t
         {
             int32_t tmp;
-            read_field(stream_view, tmp);
+            read_field(value, tmp);
             target[tag] = tmp;
             break;
         }
         case 'f' : // float
         {
             float tmp;
-            read_field(stream_view, tmp);
+            read_field(value, tmp);
             target[tag] = tmp;
             break;
         }
         case 'Z' : // string
         {
-            target[tag] = stream_view | views::to<std::string>;
+            target[tag] = std::string{value};
             break;
         }
         case 'H' :
@@ -1004,32 +1040,31 @@ inline void format_sam::read_field(stream_view_type && stream_view, sam_tag_dict
         }
         case 'B' : // Array. Value type depends on second char [cCsSiIf]
         {
-            char array_value_type_id = *std::ranges::begin(stream_view);
-            std::ranges::next(std::ranges::begin(stream_view)); // skip char read before
-            std::ranges::next(std::ranges::begin(stream_view)); // skip first ','
+            char const array_value_type_id = value.empty() ? '\0' : value[0];
+            value.remove_prefix(std::min<size_t>(2, value.size())); // skip value type id and first ','
 
             switch (array_value_type_id)
             {
                 case 'c' : // int8_t
-                    read_sam_dict_vector(target[tag], stream_view, int8_t{});
+                    read_sam_dict_vector(target[tag], value, int8_t{});
                     break;
                 case 'C' : // uint8_t
-                    read_sam_dict_vector(target[tag], stream_view, uint8_t{});
+                    read_sam_dict_vector(target[tag], value, uint8_t{});
                     break;
                 case 's' : // int16_t
-                    read_sam_dict_vector(target[tag], stream_view, int16_t{});
+                    read_sam_dict_vector(target[tag], value, int16_t{});
                     break;
                 case 'S' : // uint16_t
-                    read_sam_dict_vector(target[tag], stream_view, uint16_t{});
+                    read_sam_dict_vector(target[tag], value, uint16_t{});
                     break;
                 case 'i' : // int32_t
-                    read_sam_dict_vector(target[tag], stream_view, int32_t{});
+                    read_sam_dict_vector(target[tag], value, int32_t{});
                     break;
                 case 'I' : // uint32_t
-                    read_sam_dict_vector(target[tag], stream_view, uint32_t{});
+                    read_sam_dict_vector(target[tag], value, uint32_t{});
                     break;
                 case 'f' : // float
-                    read_sam_dict_vector(target[tag], stream_view, float{});
+                    read_sam_dict_vector(target[tag], value, float{});
                     break;
                 default:
                     throw format_error{std::string("The first character in the numerical ") +
@@ -34,6 +34,7 @@
 #include <seqan3/io/detail/misc.hpp>
 #include <seqan3/io/stream/iterator.hpp>
 #include <seqan3/io/sequence_file/output_options.hpp>
+#include <seqan3/range/container/concept.hpp>
 #include <seqan3/range/detail/misc.hpp>
 #include <seqan3/range/views/char_to.hpp>
 #include <seqan3/range/views/istreambuf.hpp>
@@ -110,7 +111,7 @@ protected:
     void transfer_soft_clipping_to(std::vector<cigar> const & cigar_vector, int32_t & sc_begin, int32_t & sc_end) const;
 
     template <typename cigar_input_type>
-    std::tuple<std::vector<cigar>, int32_t, int32_t> parse_cigar(cigar_input_type && cigar_input) const;
+    std::tuple<int32_t, int32_t> parse_cigar(cigar_input_type && cigar_input, std::vector<cigar> & operations) const;
 
     template <typename stream_view_type>
     void read_field(stream_view_type && stream_view, detail::ignore_t const & SEQAN3_DOXYGEN_ONLY(target));
@@ -244,46 +245,75 @@ inline void format_sam_base::transfer_soft_clipping_to(std::vector<cigar> const
 }
 
 /*!\brief Parses a cigar string into a vector of operation-count pairs (e.g. (M, 3)).
- * \tparam cigar_input_type The type of a single pass input view over the cigar string; must model
- *                          std::ranges::input_range.
- * \param[in]  cigar_input  The single pass input view over the cigar string to parse.
+ * \tparam cigar_input_type The type of the view over the cigar string; must model std::ranges::input_range.
+ * \param[in]  cigar_input  The view over the cigar string to parse.
+ * \param[out] operations   The vector over seqan3::cigar that describes the alignment; it is cleared first, such that
+ *                          a vector that is reused for every record keeps its memory.
  *
- * \returns A tuple of size three containing (1) std::vector over seqan3::cigar, that describes
- *          the alignment, (2) the aligned reference length, (3) the aligned query sequence length.
+ * \returns A tuple of size two containing (1) the aligned reference length, (2) the aligned query sequence length.
  *
  * \details
  *
- * For example, the view over the cigar string "1H4M1D2M2S" will return
- * `{[(H,1), (M,4), (D,1), (M,2), (S,2)], 7, 6}`.
+ * For example, the view over the cigar string "1H4M1D2M2S" will fill `operations` with
+ * `[(H,1), (M,4), (D,1), (M,2), (S,2)]` and return `{7, 6}`.
+ *
+ * A contiguous range of characters, e.g. a std::string_view, is parsed in-place with std::from_chars, any other
+ * range is consumed as a single pass input view.
  */
 template <typename cigar_input_type>
-inline std::tuple<std::vector<cigar>, int32_t, int32_t> format_sam_base::parse_cigar(cigar_input_type && cigar_input) const
+inline std::tuple<int32_t, int32_t> format_sam_base::parse_cigar(cigar_input_type && cigar_input,
+                                                                 std::vector<cigar> & operations) const
 {
-    std::vector<cigar> operations{};
-    std::array<char, 20> buffer{}; // buffer to parse numbers with from_chars. Biggest number should fit in uint64_t
+    operations.clear();
     char cigar_operation{};
     uint32_t cigar_count{};
     int32_t ref_length{}, seq_length{}; // length of aligned part for ref and query
 
-    // transform input into a single input view if it isn't already
-    auto cigar_view = cigar_input | views::single_pass_input;
+    if constexpr (std::ranges::contiguous_range<cigar_input_type> && std::ranges::sized_range<cigar_input_type> &&
+                  std::same_as<std::ranges::range_value_t<cigar_input_type>, char>)
+    {
+        // parse the counts in-place if the cigar string is a field of the current line
+        char const * it = std::ranges::data(cigar_input);
+        char const * const end = it + std::ranges::size(cigar_input);
+
+        while (it != end)
+        {
+            std::from_chars_result res = std::from_chars(it, end, cigar_count);
+
+            if (res.ec != std::errc{} || res.ptr == end)
+                throw format_error{"Corrupted cigar string encountered"};
+
+            cigar_operation = *res.ptr;
+            it = res.ptr + 1;
 
-    // parse the rest of the cigar
-    // -------------------------------------------------------------------------------------------------------------
-    while (std::ranges::begin(cigar_view) != std::ranges::end(cigar_view)) // until stream is not empty
+            update_alignment_lengths(ref_length, seq_length, cigar_operation, cigar_count);
+            operations.emplace_back(cigar_count, cigar_op{}.assign_char(cigar_operation));
+        }
+    }
+    else
     {
-        auto buff_end = (std::ranges::copy(cigar_view | views::take_until_or_throw(!is_digit), buffer.data())).out;
-        cigar_operation = *std::ranges::begin(cigar_view);
-        std::ranges::next(std::ranges::begin(cigar_view));
+        std::array<char, 20> buffer{}; // buffer to parse numbers with from_chars. Biggest number should fit in uint64_t
+
+        // transform input into a single input view if it isn't already
+        auto cigar_view = cigar_input | views::single_pass_input;
+
+        // parse the rest of the cigar
+        // ---------------------------------------------------------------------------------------------------------
+        while (std::ranges::begin(cigar_view) != std::ranges::end(cigar_view)) // until stream is not empty
+        {
+            auto buff_end = (std::ranges::copy(cigar_view | views::take_until_or_throw(!is_digit), buffer.data())).out;
+            cigar_operation = *std::ranges::begin(cigar_view);
+            std::ranges::next(std::ranges::begin(cigar_view));
 
-        if (std::from_chars(buffer.begin(), buff_end, cigar_count).ec != std::errc{})
-            throw format_error{"Corrupted cigar string encountered"};
+            if (std::from_chars(buffer.begin(), buff_end, cigar_count).ec != std::errc{})
+                throw format_error{"Corrupted cigar string encountered"};
 
-        update_alignment_lengths(ref_length, seq_length, cigar_operation, cigar_count);
-        operations.emplace_back(cigar_count, cigar_op{}.assign_char(cigar_operation));
+            update_alignment_lengths(ref_length, seq_length, cigar_operation, cigar_count);
+            operations.emplace_back(cigar_count, cigar_op{}.assign_char(cigar_operation));
+        }
     }
 
-    return {operations, ref_length, seq_length};
+    return {ref_length, seq_length};
 }
 
 /*!\brief Construct the field::alignment depending on the given information.
@@ -370,11 +400,27 @@ inline void format_sam_base::read_field(stream_view_type && stream_view,
 template <typename stream_view_type, std::ranges::forward_range target_range_type>
 inline void format_sam_base::read_field(stream_view_type && stream_view, target_range_type & target)
 {
+    if constexpr (std::ranges::sized_range<stream_view_type>) // e.g. a field of the current line
+    {
+        if (std::ranges::empty(stream_view))
+            return;
+    }
+
     if (!is_char<'*'>(*std::ranges::begin(stream_view)))
-        std::ranges::copy(stream_view | views::char_to<std::ranges::range_value_t<target_range_type>>,
-                          std::ranges::back_inserter(target));
+    {
+        auto converted = stream_view | views::char_to<std::ranges::range_value_t<target_range_type>>;
+
+        // the size of the field is known, so the target is enlarged at once
+        if constexpr (std::ranges::forward_range<stream_view_type> && std::ranges::sized_range<stream_view_type> &&
+                      sequence_container<target_range_type>)
+            target.insert(std::ranges::end(target), std::ranges::begin(converted), std::ranges::end(converted));
+        else
+            std::ranges::copy(converted, std::ranges::back_inserter(target));
+    }
     else
+    {
         std::ranges::next(std::ranges::begin(stream_view)); // skip '*'
+    }
 }
 
 /*!\brief Reads arithmetic fields using std::from_chars.
@@ -386,23 +432,41 @@ inline void format_sam_base::read_field(stream_view_type && stream_view, target_
  *
  * \throws seqan3::format_error if the character sequence in stream_view cannot be successfully converted to a value
  *         of type arithmetic_target_type.
+ *
+ * \details
+ *
+ * If stream_view is a contiguous range of characters, e.g. a std::string_view over a field of the current line,
+ * the value is parsed in-place. Otherwise the characters are copied into seqan3::format_sam_base::arithmetic_buffer
+ * first.
  */
 template <typename stream_view_t, arithmetic arithmetic_target_type>
 inline void format_sam_base::read_field(stream_view_t && stream_view, arithmetic_target_type & arithmetic_target)
 {
-    // unfortunately std::from_chars only accepts char const * so we need a buffer.
-    auto [ignore, end] = std::ranges::copy(stream_view, arithmetic_buffer.data());
-    (void) ignore;
-    std::from_chars_result res = std::from_chars(arithmetic_buffer.begin(), end, arithmetic_target);
+    char const * begin{};
+    char const * end{};
+
+    if constexpr (std::ranges::contiguous_range<stream_view_t> && std::ranges::sized_range<stream_view_t> &&
+                  std::same_as<std::ranges::range_value_t<stream_view_t>, char>)
+    {
+        begin = std::ranges::data(stream_view);
+        end = begin + std::ranges::size(stream_view);
+    }
+    else
+    {
+        // unfortunately std::from_chars only accepts char const * so we need a buffer.
+        begin = arithmetic_buffer.data();
+        end = std::ranges::copy(stream_view, arithmetic_buffer.data()).out;
+    }
+
+    std::from_chars_result res = std::from_chars(begin, end, arithmetic_target);
 
     if (res.ec == std::errc::invalid_argument || res.ptr != end)
-        throw format_error{std::string("[CORRUPTED SAM FILE] The string '") +
-                                       std::string(arithmetic_buffer.begin(), end) +
+        throw format_error{std::string("[CORRUPTED SAM FILE] The string '") + std::string(begin, end) +
                                        "' could not be cast into type " +
                                        detail::type_name_as_string<arithmetic_target_type>};
 
     if (res.ec == std::errc::result_out_of_range)
-        throw format_error{std::string("[CORRUPTED SAM FILE] Casting '") + std::string(arithmetic_buffer.begin(), end) +
+        throw format_error{std::string("[CORRUPTED SAM FILE] Casting '") + std::string(begin, end) +
                                        "' into type " + detail::type_name_as_string<arithmetic_target_type> +
                                        " would cause an overflow."};
 }
@@ -28,6 +28,7 @@
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/core/type_list/traits.hpp>
 #include <seqan3/core/type_traits/transformation_trait_or.hpp>
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
 #include <seqan3/io/alignment_file/input_format_concept.hpp>
 #include <seqan3/io/alignment_file/format_bam.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
@@ -37,6 +38,7 @@
 #include <seqan3/io/detail/record.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/io/record.hpp>
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/stream/concept.hpp>
 #include <seqan3/range/decorator/gap_decorator.hpp>
 #include <seqan3/range/views/repeat_n.hpp>
@@ -108,6 +110,15 @@ namespace seqan3
  *            configured in order to allow for automatic type deduction from reference information input on
  *            construction.
  */
+/*!\typedef using alignment_type
+ * \brief Optional. If set to seqan3::cigar_alignment, seqan3::field::alignment stores the CIGAR and computes the
+ *        gapped sequences only on demand.
+ *
+ * \details
+ *
+ * If not given, seqan3::field::alignment is a std::tuple of the two gapped sequences, which are constructed for every
+ * record.
+ */
 //!\}
 //!\cond
 template <typename t>
@@ -149,7 +160,8 @@ SEQAN3_CONCEPT alignment_file_input_traits = requires (t v)
     // field::mate is fixed to std::tuple<ref_id_container<ref_id_alphabet>, ref_offset_type, int32_t>
 
     // field::alignment
-    // the alignment type cannot be configured.
+    // the alignment type can only be configured to seqan3::cigar_alignment via an optional member type alignment_type.
+    // Otherwise it is a tuple of two gapped sequences:
     // Type of tuple entry 1 (reference) is set to
     // 1) a std::ranges::subrange over std::ranges::range_value_t<typename t::ref_sequences> if reference information was given
     // or 2) a "dummy" sequence type:
@@ -216,6 +228,21 @@ struct alignment_file_input_default_traits
     //!\}
 };
 
+//!\cond
+namespace detail
+{
+
+//!\brief Whether the traits type selects seqan3::cigar_alignment as the type of seqan3::field::alignment.
+template <typename traits_type>
+SEQAN3_CONCEPT cigar_alignment_traits = requires
+{
+    typename traits_type::alignment_type;
+    requires std::same_as<typename traits_type::alignment_type, cigar_alignment>;
+};
+
+} // namespace detail
+//!\endcond
+
 // ---------------------------------------------------------------------------------------------------------------------
 // alignment_file_input
 // ---------------------------------------------------------------------------------------------------------------------
@@ -445,8 +472,14 @@ private:
                                          gapped<typename traits_type::sequence_alphabet>>>;
 
 public:
-    //!\brief The type of field::alignment (default: std::pair<std::vector<gapped<dna5>>, std::vector<gapped<dna5>>>).
-    using alignment_type = std::tuple<gap_decorator<ref_sequence_type>, alignment_query_type>;
+    /*!\brief The type of field::alignment (default: std::pair<std::vector<gapped<dna5>>, std::vector<gapped<dna5>>>).
+     *
+     * If the traits type defines the member type `alignment_type` as seqan3::cigar_alignment, the alignment is
+     * stored as CIGAR and the gapped sequences are computed on demand.
+     */
+    using alignment_type = std::conditional_t<detail::cigar_alignment_traits<traits_type>,
+                                              cigar_alignment,
+                                              std::tuple<gap_decorator<ref_sequence_type>, alignment_query_type>>;
 
     //!\brief The previously defined types aggregated in a seqan3::type_list.
     using field_types = type_list<sequence_type,
@@ -563,6 +596,7 @@ public:
     /*!\brief Construct from filename.
      * \param[in] filename    Path to the file you wish to open.
      * \param[in] fields_tag  A seqan3::fields tag. [optional]
+     * \param[in] buffer_options Configures the stream buffer, see seqan3::stream_buffer_options. [optional]
      * \throws seqan3::file_open_error If the file could not be opened, e.g. non-existent, non-readable, unknown format.
      *
      * \details
@@ -578,8 +612,10 @@ public:
      * See the section on \link io_compression compression and decompression \endlink for more information.
      */
     alignment_file_input(std::filesystem::path filename,
-                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{}, stream_deleter_default}
+                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{},
+                         stream_buffer_options const & buffer_options = stream_buffer_options{}) :
+        stream_buffer{buffer_options},
+        primary_stream{stream_buffer.open_input(filename).release(), stream_deleter_default}
     {
         init_by_filename(std::move(filename));
     }
@@ -633,6 +669,7 @@ public:
      * \param[in] ref_ids         A range containing the reference ids that correspond to the SAM/BAM file.
      * \param[in] ref_sequences   A range containing the reference sequences that correspond to the SAM/BAM file.
      * \param[in] fields_tag      A seqan3::fields tag. [optional]
+     * \param[in] buffer_options  Configures the stream buffer, see seqan3::stream_buffer_options. [optional]
      * \throws seqan3::file_open_error If the file could not be opened, e.g. non-existent, non-readable, unknown format.
      *
      * \details
@@ -654,8 +691,10 @@ public:
     alignment_file_input(std::filesystem::path filename,
                          typename traits_type::ref_ids & ref_ids,
                          typename traits_type::ref_sequences & ref_sequences,
-                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{}, stream_deleter_default}
+                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{},
+                         stream_buffer_options const & buffer_options = stream_buffer_options{}) :
+        stream_buffer{buffer_options},
+        primary_stream{stream_buffer.open_input(filename).release(), stream_deleter_default}
     {
         // initialize reference information
         set_references(ref_ids, ref_sequences);
@@ -845,9 +884,6 @@ protected:
     //!/brief Initialisation based on a filename.
     void init_by_filename(std::filesystem::path filename)
     {
-        primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
-        static_cast<std::basic_ifstream<char> *>(primary_stream.get())->open(filename,
-                                                                             std::ios_base::in | std::ios::binary);
         // open stream
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
@@ -875,8 +911,8 @@ protected:
      */
     //!\brief Buffer for a single record.
     record_type record_buffer;
-    //!\brief A larger (compared to stl default) stream buffer to use when reading from a file.
-    std::vector<char> stream_buffer{std::vector<char>(1'000'000)};
+    //!\brief The stream buffer used when reading from a file, see seqan3::stream_buffer_options.
+    detail::file_stream_buffer stream_buffer{};
     //!\}
 
     /*!\name Stream / file access
@@ -33,6 +33,7 @@
 #include <seqan3/io/exception.hpp>
 #include <seqan3/std/filesystem>
 #include <seqan3/io/record.hpp>
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/stream/concept.hpp>
 #include <seqan3/std/ranges>
 
@@ -245,6 +246,7 @@ public:
     /*!\brief Construct from filename.
      * \param[in] filename      Path to the file you wish to open.
      * \param[in] fields_tag    A seqan3::fields tag. [optional]
+     * \param[in] buffer_options Configures the stream buffer, see seqan3::stream_buffer_options. [optional]
      *
      * \details
      *
@@ -268,10 +270,12 @@ public:
      * \include test/snippet/io/alignment_file/alignment_file_output_format_construction.cpp
      */
     alignment_file_output(std::filesystem::path filename,
-                          selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
+                          selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{},
+                          stream_buffer_options const & buffer_options = stream_buffer_options{}) :
+        stream_buffer{buffer_options},
         primary_stream{new std::ofstream{}, stream_deleter_default}
     {
-        primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
+        stream_buffer.set_on(*primary_stream->rdbuf());
         static_cast<std::basic_ofstream<char> *>(primary_stream.get())->open(filename,
                                                                              std::ios_base::out | std::ios::binary);
 
@@ -341,6 +345,7 @@ public:
      * \param[in] ref_ids       A range over reference ids.
      * \param[in] ref_lengths   A range over lengths of reference sequences (same order as ref_ids).
      * \param[in] fields_tag    A seqan3::fields tag. [optional]
+     * \param[in] buffer_options Configures the stream buffer, see seqan3::stream_buffer_options. [optional]
      *
      * \details
      *
@@ -370,8 +375,9 @@ public:
     alignment_file_output(std::filesystem::path const & filename,
                           ref_ids_type_              && ref_ids,
                           ref_lengths_type           && ref_lengths,
-                          selected_field_ids    const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        alignment_file_output{filename, selected_field_ids{}}
+                          selected_field_ids    const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{},
+                          stream_buffer_options const & buffer_options = stream_buffer_options{}) :
+        alignment_file_output{filename, selected_field_ids{}, buffer_options}
 
     {
         initialise_header_information(ref_ids, ref_lengths);
@@ -700,8 +706,8 @@ public:
 
 protected:
     //!\privatesection
-    //!\brief A larger (compared to stl default) stream buffer to use when reading from a file.
-    std::vector<char> stream_buffer{std::vector<char>(1'000'000)};
+    //!\brief The stream buffer used when writing to a file, see seqan3::stream_buffer_options.
+    detail::file_stream_buffer stream_buffer{};
 
     /*!\name Stream / file access
      * \{
@@ -12,8 +12,12 @@
 
 #pragma once
 
-#include <map>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include <seqan3/core/char_operations/predicate.hpp>
 #include <seqan3/core/concept/core_language.hpp>
@@ -316,21 +320,226 @@ template <> struct sam_tag_type<"UQ"_tag> { using type = int32_t; };
  * for the tag "XZ" or learn more about an std::variant at
  * https://en.cppreference.com/w/cpp/utility/variant.
  *
+ * ### Storage
+ *
+ * The dictionary stores its entries in a vector that is sorted by the tag id. The few tags of a SAM/BAM record are
+ * found faster than in a node based map, and seqan3::sam_tag_dictionary::clear keeps the allocated memory, such that
+ * a dictionary that is reused for many records, e.g. by seqan3::alignment_file_input, does not allocate memory for
+ * its entries anymore. The interface resembles the one of std::map and the tag of an entry cannot be modified, but
+ * inserting or erasing an entry invalidates all iterators and references into the dictionary.
+ *
  * \sa seqan3::sam_tag_type
  * \sa https://en.cppreference.com/w/cpp/utility/variant
  * \sa https://samtools.github.io/hts-specs/SAMv1.pdf
  * \sa https://samtools.github.io/hts-specs/SAMtags.pdf
  */
-class sam_tag_dictionary : public std::map<uint16_t, detail::sam_tag_variant>
+class sam_tag_dictionary
 {
-private:
-    //!\brief The base type.
-    using base_type = std::map<uint16_t, detail::sam_tag_variant>;
-
 public:
     //!\brief The variant type defining all valid SAM tag field types.
     using variant_type = detail::sam_tag_variant;
 
+    /*!\name Associated types
+     * \{
+     */
+    using key_type = uint16_t; //!< The type of the tag ids.
+    using mapped_type = variant_type; //!< The type of the tag values.
+    using value_type = std::pair<key_type const, mapped_type>; //!< The type of an entry.
+    using reference = value_type &; //!< The reference type.
+    using const_reference = value_type const &; //!< The const reference type.
+    using iterator = typename std::vector<value_type>::iterator; //!< The iterator type.
+    using const_iterator = typename std::vector<value_type>::const_iterator; //!< The const iterator type.
+    using size_type = size_t; //!< The size type.
+    using difference_type = ptrdiff_t; //!< The difference type.
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    sam_tag_dictionary() = default; //!< Defaulted.
+    sam_tag_dictionary(sam_tag_dictionary const &) = default; //!< Defaulted.
+    sam_tag_dictionary(sam_tag_dictionary &&) = default; //!< Defaulted.
+    sam_tag_dictionary & operator=(sam_tag_dictionary &&) = default; //!< Defaulted.
+    ~sam_tag_dictionary() = default; //!< Defaulted.
+
+    //!\brief Copy assignment, which copies the entries one by one because their tags cannot be assigned.
+    sam_tag_dictionary & operator=(sam_tag_dictionary const & other)
+    {
+        if (this != &other)
+        {
+            storage.clear();
+            storage.reserve(other.size());
+
+            for (value_type const & entry : other.storage)
+                storage.push_back(entry);
+        }
+
+        return *this;
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \brief The entries in ascending order of their tag ids.
+     * \{
+     */
+    iterator begin() noexcept { return storage.begin(); } //!< Returns an iterator to the first entry.
+    const_iterator begin() const noexcept { return storage.begin(); } //!< Returns an iterator to the first entry.
+    const_iterator cbegin() const noexcept { return storage.cbegin(); } //!< Returns an iterator to the first entry.
+    iterator end() noexcept { return storage.end(); } //!< Returns an iterator behind the last entry.
+    const_iterator end() const noexcept { return storage.end(); } //!< Returns an iterator behind the last entry.
+    const_iterator cend() const noexcept { return storage.cend(); } //!< Returns an iterator behind the last entry.
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief Returns the number of entries.
+    size_type size() const noexcept
+    {
+        return storage.size();
+    }
+
+    //!\brief Returns whether the dictionary has no entries.
+    bool empty() const noexcept
+    {
+        return storage.empty();
+    }
+
+    //!\brief Removes all entries, but keeps the allocated memory.
+    void clear() noexcept
+    {
+        storage.clear();
+    }
+    //!\}
+
+    /*!\name Lookup
+     * \{
+     */
+    //!\brief Returns an iterator to the entry of the given tag or end() if the tag is not set.
+    iterator find(key_type const tag) noexcept
+    {
+        iterator it = lower_bound(tag);
+        return (it != end() && it->first == tag) ? it : end();
+    }
+
+    //!\copydoc find
+    const_iterator find(key_type const tag) const noexcept
+    {
+        const_iterator it = lower_bound(tag);
+        return (it != end() && it->first == tag) ? it : end();
+    }
+
+    //!\brief Returns `1` if the tag is set and `0` otherwise.
+    size_type count(key_type const tag) const noexcept
+    {
+        return contains(tag) ? 1u : 0u;
+    }
+
+    //!\brief Returns whether the tag is set.
+    bool contains(key_type const tag) const noexcept
+    {
+        return find(tag) != end();
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    //!\brief Returns the value of the given tag and default initialises the value if the tag is not set.
+    mapped_type & operator[](key_type const tag)
+    {
+        iterator it = lower_bound(tag);
+
+        if (it == end() || it->first != tag)
+            it = insert_at(it, value_type{tag, mapped_type{}});
+
+        return it->second;
+    }
+
+    //!\brief Returns the value of the given tag.
+    //!\throws std::out_of_range if the tag is not set.
+    mapped_type & at(key_type const tag)
+    {
+        iterator it = find(tag);
+
+        if (it == end())
+            throw std::out_of_range{"The SAM tag is not set in the seqan3::sam_tag_dictionary."};
+
+        return it->second;
+    }
+
+    //!\copydoc at
+    mapped_type const & at(key_type const tag) const
+    {
+        const_iterator it = find(tag);
+
+        if (it == end())
+            throw std::out_of_range{"The SAM tag is not set in the seqan3::sam_tag_dictionary."};
+
+        return it->second;
+    }
+    //!\}
+
+    /*!\name Modifiers
+     * \{
+     */
+    /*!\brief Inserts the entry if its tag is not set.
+     * \returns An iterator to the entry of the tag and whether the entry was inserted.
+     */
+    std::pair<iterator, bool> insert(value_type value)
+    {
+        iterator it = lower_bound(value.first);
+
+        if (it != end() && it->first == value.first)
+            return {it, false};
+
+        return {insert_at(it, std::move(value)), true};
+    }
+
+    //!\brief Constructs an entry from the arguments and inserts it if its tag is not set.
+    template <typename ...args_t>
+    std::pair<iterator, bool> emplace(args_t && ...args)
+    {
+        return insert(value_type{std::forward<args_t>(args)...});
+    }
+
+    //!\brief Removes the entry at the given position and returns an iterator to the following entry.
+    iterator erase(const_iterator const position)
+    {
+        size_type const index = position - storage.cbegin();
+
+        if (index + 1 == storage.size())
+        {
+            storage.pop_back();
+            return end();
+        }
+
+        // The entries cannot be assigned, so all entries except the erased one are moved into the spare storage.
+        spare_storage.clear();
+        spare_storage.reserve(storage.capacity());
+
+        for (size_type i = 0; i < storage.size(); ++i)
+            if (i != index)
+                spare_storage.push_back(std::move(storage[i]));
+
+        std::swap(storage, spare_storage);
+        spare_storage.clear();
+        return begin() + index;
+    }
+
+    //!\brief Removes the entry of the given tag and returns the number of removed entries.
+    size_type erase(key_type const tag)
+    {
+        iterator it = find(tag);
+
+        if (it == end())
+            return 0u;
+
+        erase(it);
+        return 1u;
+    }
+    //!\}
+
     /*!\name Getter function for the seqan3::sam_tag_dictionary.
      *\brief Gets the value of known SAM tags by its correct type instead of the std::variant.
      * \tparam tag The unique tag id of a SAM tag.
@@ -346,7 +555,7 @@ public:
      * \{
      */
 
-    //!\brief Uses std::map::operator[] for access and default initializes new keys.
+    //!\brief Uses operator[] for access and default initializes new keys.
     template <uint16_t tag>
     //!\cond
         requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
@@ -359,7 +568,7 @@ public:
         return std::get<sam_tag_type_t<tag>>((*this)[tag]);
     }
 
-    //!\brief Uses std::map::operator[] for access and default initializes new keys.
+    //!\brief Uses operator[] for access and default initializes new keys.
     template <uint16_t tag>
     //!\cond
         requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
@@ -372,8 +581,8 @@ public:
         return std::get<sam_tag_type_t<tag>>(std::move((*this)[tag]));
     }
 
-    //!\brief Uses std::map::at() for access and throws when the key is unknown.
-    //!\throws std::out_of_range if map has no key `tag`.
+    //!\brief Uses at() for access and throws when the key is unknown.
+    //!\throws std::out_of_range if the dictionary has no key `tag`.
     template <uint16_t tag>
     //!\cond
         requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
@@ -383,8 +592,8 @@ public:
         return std::get<sam_tag_type_t<tag>>((*this).at(tag));
     }
 
-    //!\brief Uses std::map::at() for access and throws when the key is unknown.
-    //!\throws std::out_of_range if map has no key `tag`.
+    //!\brief Uses at() for access and throws when the key is unknown.
+    //!\throws std::out_of_range if the dictionary has no key `tag`.
     template <uint16_t tag>
     //!\cond
         requires (!std::same_as<sam_tag_type_t<tag>, variant_type>)
@@ -394,6 +603,79 @@ public:
         return std::get<sam_tag_type_t<tag>>(std::move((*this).at(tag)));
     }
     //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Returns whether both dictionaries have the same entries.
+    friend bool operator==(sam_tag_dictionary const & lhs, sam_tag_dictionary const & rhs)
+    {
+        return lhs.storage == rhs.storage;
+    }
+
+    //!\brief Returns whether the dictionaries have different entries.
+    friend bool operator!=(sam_tag_dictionary const & lhs, sam_tag_dictionary const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+    //!\}
+
+private:
+    //!\brief Returns whether the tag of the entry is less than the given tag.
+    static bool tag_less(value_type const & entry, key_type const tag) noexcept
+    {
+        return entry.first < tag;
+    }
+
+    //!\brief Returns an iterator to the first entry whose tag is not less than the given tag.
+    iterator lower_bound(key_type const tag) noexcept
+    {
+        return std::lower_bound(storage.begin(), storage.end(), tag, tag_less);
+    }
+
+    //!\copydoc lower_bound
+    const_iterator lower_bound(key_type const tag) const noexcept
+    {
+        return std::lower_bound(storage.begin(), storage.end(), tag, tag_less);
+    }
+
+    /*!\brief Inserts the entry before the given position and returns an iterator to it.
+     * \details
+     *
+     * The tags of the entries cannot be assigned, so the entries cannot be shifted within the storage. An entry
+     * behind the last one is appended, otherwise all entries are moved into the spare storage, which keeps its
+     * memory, such that a reused dictionary does not allocate memory either way.
+     */
+    iterator insert_at(const_iterator const position, value_type && value)
+    {
+        size_type const index = position - storage.cbegin();
+
+        if (index == storage.size())
+        {
+            storage.push_back(std::move(value));
+            return begin() + index;
+        }
+
+        spare_storage.clear();
+        spare_storage.reserve(std::max<size_type>(storage.capacity(), storage.size() + 1));
+
+        for (size_type i = 0; i < index; ++i)
+            spare_storage.push_back(std::move(storage[i]));
+
+        spare_storage.push_back(std::move(value));
+
+        for (size_type i = index; i < storage.size(); ++i)
+            spare_storage.push_back(std::move(storage[i]));
+
+        std::swap(storage, spare_storage);
+        spare_storage.clear();
+        return begin() + index;
+    }
+
+    //!\brief The entries sorted by their tag ids.
+    std::vector<value_type> storage{};
+    //!\brief Spare memory that the entries are moved into when an entry is inserted or erased in the middle.
+    std::vector<value_type> spare_storage{};
 };
 
 } // namespace seqan3
@@ -0,0 +1,681 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::sequence_file_batch_view.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <seqan3/contrib/parallel/buffer_queue.hpp>
+#include <seqan3/core/char_operations/predicate.hpp>
+#include <seqan3/io/alignment_file/format_sam.hpp>
+#include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/sequence_file/format_embl.hpp>
+#include <seqan3/io/sequence_file/format_fasta.hpp>
+#include <seqan3/io/sequence_file/format_fastq.hpp>
+#include <seqan3/io/sequence_file/format_genbank.hpp>
+#include <seqan3/io/stream/iterator.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+#include <seqan3/std/iterator>
+#include <seqan3/std/ranges>
+
+//-----------------------------------------------------------------------------
+// This is the path a record takes when using this view:
+//   file stream
+// → reader thread: lines are appended to slot.bytes until a batch is full     [window of slots]
+// → parser thread: slot.bytes are parsed into slot.batch
+// → sequence_file_batch_iterator.current_batch (swapped with slot.batch)     [size 1]
+// → user
+//-----------------------------------------------------------------------------
+
+namespace seqan3::detail
+{
+
+/*!\brief Decides for every line of a sequence file whether it begins a new record.
+ * \ingroup io
+ * \tparam format_type The format of the file; must be derived from one of the sequence file formats.
+ *
+ * \details
+ *
+ * The lines are passed in the order in which they appear in the file, without the trailing newline.
+ *
+ * * FASTA: every line starting with `>` or `;` is an ID line that begins a record.
+ * * FASTQ: the ID line beginning with `@` is followed by sequence lines up to the `+` line and then as many
+ *   quality characters as there were sequence characters. Counting the characters (instead of looking at the first
+ *   character of the line) handles multi-line records and quality lines that begin with `@`.
+ * * SAM: every line that is neither a header line (beginning with `@`) nor blank is a record.
+ * * EMBL and GenBank: the first non-blank line after a `//` line begins a record.
+ */
+template <typename format_type>
+class record_start_detector
+{
+    static_assert(std::derived_from<format_type, format_fasta> ||
+                  std::derived_from<format_type, format_fastq> ||
+                  std::derived_from<format_type, format_sam> ||
+                  std::derived_from<format_type, format_embl> ||
+                  std::derived_from<format_type, format_genbank>,
+                  "Splitting a file into batches of records is only supported for the sequence file formats "
+                  "shipped with SeqAn.");
+
+    //!\brief The part of a FASTQ record the last line belonged to.
+    enum class fastq_section : uint8_t
+    {
+        id,
+        sequence,
+        quality
+    };
+
+    //!\brief The part of the current FASTQ record.
+    fastq_section section{fastq_section::id};
+    //!\brief The number of sequence characters of the current FASTQ record.
+    size_t sequence_size{};
+    //!\brief The number of quality characters of the current FASTQ record.
+    size_t quality_size{};
+    //!\brief Whether the last line belonged to an EMBL or GenBank record that was not terminated yet.
+    bool in_record{false};
+
+    //!\brief Returns the number of characters in the line that are not whitespace.
+    static size_t count_non_space(std::string_view const line) noexcept
+    {
+        return std::ranges::count_if(line, [] (char const c) { return !is_space(c); });
+    }
+
+public:
+    //!\brief Returns `true` if `line` is the first line of a record.
+    bool operator()(std::string_view const line) noexcept
+    {
+        if constexpr (std::derived_from<format_type, format_fasta>)
+        {
+            return !line.empty() && (line[0] == '>' || line[0] == ';');
+        }
+        else if constexpr (std::derived_from<format_type, format_fastq>)
+        {
+            switch (section)
+            {
+                case fastq_section::id:
+                {
+                    if (line.empty() || line[0] != '@')
+                        return false;
+
+                    section = fastq_section::sequence;
+                    sequence_size = 0;
+                    return true;
+                }
+                case fastq_section::sequence:
+                {
+                    if (!line.empty() && line[0] == '+')
+                    {
+                        quality_size = 0;
+                        section = (sequence_size == 0) ? fastq_section::id : fastq_section::quality;
+                    }
+                    else
+                    {
+                        sequence_size += count_non_space(line);
+                    }
+                    return false;
+                }
+                default:
+                {
+                    quality_size += count_non_space(line);
+                    if (quality_size >= sequence_size)
+                        section = fastq_section::id;
+                    return false;
+                }
+            }
+        }
+        else if constexpr (std::derived_from<format_type, format_sam>)
+        {
+            return !line.empty() && line[0] != '@' && count_non_space(line) != 0;
+        }
+        else // EMBL and GenBank
+        {
+            if (line.substr(0, 2) == "//")
+            {
+                in_record = false;
+                return false;
+            }
+
+            if (in_record || count_non_space(line) == 0)
+                return false;
+
+            in_record = true;
+            return true;
+        }
+    }
+};
+
+/*!\brief The type returned by seqan3::sequence_file_input::parallel_batches().
+ * \ingroup io
+ * \tparam file_type The type of the seqan3::sequence_file_input the records are read from.
+ * \implements std::ranges::input_range
+ *
+ * \details
+ *
+ * A reader thread splits the (decompressed) input stream at record boundaries into chunks of a fixed number of
+ * records. The chunks are parsed by a pool of parser threads into seqan3::sequence_record_batch es and the batches
+ * are delivered in the order of the file. At most two chunks per parser thread are in flight, which bounds the memory
+ * consumption independently of the file size.
+ *
+ * All state is shared between copies of this view; the threads are stopped and joined when the last copy is
+ * destroyed.
+ */
+template <typename file_type>
+class sequence_file_batch_view : public std::ranges::view_interface<sequence_file_batch_view<file_type>>
+{
+private:
+    //!\brief The std::variant over the formats of the file.
+    using format_type = typename file_type::format_type;
+    //!\brief The options type of the file.
+    using options_type = std::remove_cvref_t<decltype(std::declval<file_type &>().options)>;
+    //!\brief The record type of the file; used as buffer when parsing a single record.
+    using record_type = typename file_type::record_type;
+    //!\brief The batch type of the file.
+    using batch_type = typename file_type::batch_type;
+
+    //!\brief The stage a slot is in.
+    enum class slot_status : uint8_t
+    {
+        free,   //!< The slot can be filled by the reader.
+        filled, //!< The slot holds the bytes of a chunk that still need to be parsed.
+        parsed  //!< The slot holds a parsed batch (or an error) that waits for being consumed.
+    };
+
+    //!\brief Holds one chunk of the file through all stages.
+    struct slot
+    {
+        //!\brief The stage this slot is in.
+        slot_status status{slot_status::free};
+        //!\brief The bytes of the records of this chunk.
+        std::string bytes{};
+        //!\brief The parsed records of this chunk.
+        batch_type batch{};
+        //!\brief Holds the exception if reading or parsing the chunk failed.
+        std::exception_ptr error{};
+    };
+
+    //!\brief A read-only stream buffer over the bytes of a slot.
+    struct chunk_streambuf : public std::basic_streambuf<char>
+    {
+        //!\brief Construction from the bytes of a slot.
+        explicit chunk_streambuf(std::string & bytes)
+        {
+            this->setg(bytes.data(), bytes.data(), bytes.data() + bytes.size());
+        }
+    };
+
+    //!\brief Slots, threads and synchronisation shared between copies of this type.
+    struct state
+    {
+        //!\brief Construction from the members of the file.
+        state(std::basic_istream<char> & stream_,
+              format_type const & format_,
+              options_type const & options_,
+              size_t const records_per_batch_,
+              size_t const window_size) :
+            stream{stream_},
+            format{format_},
+            options{options_},
+            records_per_batch{records_per_batch_},
+            slots(window_size),
+            chunks{window_size}
+        {}
+
+        //!\brief The (decompressed) stream of the file.
+        std::basic_istream<char> & stream;
+        //!\brief The detected/selected format of the file.
+        format_type format;
+        //!\brief The options of the file.
+        options_type options;
+        //!\brief The maximal number of records per chunk.
+        size_t records_per_batch;
+
+        //!\brief The ring of slots; chunk `i` is stored in slot `i % slots.size()`.
+        std::vector<slot> slots;
+        //!\brief The indices of the filled slots that wait for a parser thread.
+        contrib::fixed_buffer_queue<size_t> chunks;
+
+        //!\brief Guards the slot status, chunk_count, next_chunk and stop.
+        std::mutex mutex{};
+        //!\brief Notified whenever the status of a slot changes.
+        std::condition_variable slot_changed{};
+        //!\brief The number of chunks in the file; only known after the reader reached the end of the stream.
+        size_t chunk_count{std::numeric_limits<size_t>::max()};
+        //!\brief The next chunk to hand to the consumer.
+        size_t next_chunk{};
+        //!\brief Set if the view is destroyed or an error was delivered; tells the reader to stop.
+        bool stop{false};
+
+        //!\brief The thread that splits the stream into chunks.
+        std::thread reader{};
+        //!\brief The threads that parse the chunks.
+        std::vector<std::thread> parsers{};
+    };
+
+    //!\brief Shared holder of the state.
+    std::shared_ptr<state> state_ptr = nullptr;
+
+    //!\brief The iterator of the seqan3::detail::sequence_file_batch_view.
+    class sequence_file_batch_iterator;
+
+    //!\brief Marks the slot as parsed, stores the current exception in it and tells everyone waiting for it.
+    static void fail(state & s, slot & current, size_t const chunk_count)
+    {
+        {
+            std::lock_guard lock{s.mutex};
+            current.error = std::current_exception();
+            current.status = slot_status::parsed;
+            s.chunk_count = chunk_count;
+        }
+        s.slot_changed.notify_all();
+    }
+
+    //!\brief The body of the reader thread; fills the slots in the order of the file.
+    template <typename format_t>
+    static void read_chunks(state & s)
+    {
+        record_start_detector<format_t> starts_record{};
+        fast_istreambuf_iterator<char> stream_it{};
+        std::string line{};
+        bool has_pending_line{false}; // the first line of the first record of the next chunk was read already
+
+        for (size_t chunk = 0; ; ++chunk)
+        {
+            slot & current = s.slots[chunk % s.slots.size()];
+
+            {
+                std::unique_lock lock{s.mutex};
+                s.slot_changed.wait(lock, [&] () { return s.stop || current.status == slot_status::free; });
+                if (s.stop)
+                    break;
+            }
+
+            try
+            {
+                if (chunk == 0)
+                    stream_it = fast_istreambuf_iterator<char>{*s.stream.rdbuf()};
+
+                current.bytes.clear();
+                size_t record_count{0};
+
+                if (has_pending_line)
+                {
+                    current.bytes.append(line);
+                    current.bytes.push_back('\n');
+                    record_count = 1;
+                    has_pending_line = false;
+                }
+
+                while (stream_it != std::ranges::default_sentinel)
+                {
+                    line.clear();
+                    stream_it.read_line(line);
+
+                    if (starts_record(line))
+                    {
+                        if (record_count == s.records_per_batch)
+                        {
+                            has_pending_line = true;
+                            break;
+                        }
+                        ++record_count;
+                    }
+
+                    current.bytes.append(line);
+                    current.bytes.push_back('\n');
+                }
+            }
+            catch (...)
+            {
+                fail(s, current, chunk + 1);
+                break;
+            }
+
+            if (current.bytes.empty()) // end of stream
+            {
+                {
+                    std::lock_guard lock{s.mutex};
+                    s.chunk_count = chunk;
+                }
+                s.slot_changed.notify_all();
+                break;
+            }
+
+            {
+                std::lock_guard lock{s.mutex};
+                current.status = slot_status::filled;
+            }
+
+            if (s.chunks.wait_push(chunk % s.slots.size()) == contrib::queue_op_status::closed)
+                break;
+        }
+
+        s.chunks.close();
+    }
+
+    //!\brief Parses the bytes of a slot into its batch.
+    static void parse_chunk(format_type & format, options_type const & options, record_type & record, slot & current)
+    {
+        current.batch.clear();
+
+        chunk_streambuf buffer{current.bytes};
+        std::basic_istream<char> stream{&buffer};
+
+        assert(!format.valueless_by_exception());
+        std::visit([&] (auto & f)
+        {
+            while (std::istreambuf_iterator<char>{stream} != std::istreambuf_iterator<char>{})
+            {
+                record.clear();
+                f.read_sequence_record(stream,
+                                       options,
+                                       detail::get_or_ignore<field::seq>(record),
+                                       detail::get_or_ignore<field::id>(record),
+                                       detail::get_or_ignore<field::qual>(record));
+                current.batch.push_back(record);
+            }
+        }, format);
+    }
+
+    //!\brief The body of a parser thread; parses filled slots until the reader is done.
+    static void parse_chunks(state & s)
+    {
+        format_type format{s.format}; // formats may keep state between records, every thread gets its own copy
+        record_type record{};
+        size_t index{};
+
+        while (s.chunks.wait_pop(index) != contrib::queue_op_status::closed)
+        {
+            slot & current = s.slots[index];
+
+            try
+            {
+                parse_chunk(format, s.options, record, current);
+            }
+            catch (...)
+            {
+                current.error = std::current_exception();
+            }
+
+            {
+                std::lock_guard lock{s.mutex};
+                current.status = slot_status::parsed;
+            }
+            s.slot_changed.notify_all();
+        }
+    }
+
+public:
+    /*!\name Constructor, destructor, and assignment.
+     * \{
+     */
+    sequence_file_batch_view()                                             = default; //!< Defaulted.
+    sequence_file_batch_view(sequence_file_batch_view const &)             = default; //!< Defaulted.
+    sequence_file_batch_view(sequence_file_batch_view &&)                  = default; //!< Defaulted.
+    sequence_file_batch_view & operator=(sequence_file_batch_view const &) = default; //!< Defaulted.
+    sequence_file_batch_view & operator=(sequence_file_batch_view &&)      = default; //!< Defaulted.
+    ~sequence_file_batch_view()                                            = default; //!< Defaulted.
+
+    /*!\brief Construction from the file; starts the reader and the parser threads.
+     * \param[in] file              The file to read from; must outlive this view.
+     * \param[in] thread_count      The number of parser threads; must be > 0.
+     * \param[in] records_per_batch The maximal number of records per batch; must be > 0.
+     * \throws std::invalid_argument if `thread_count` or `records_per_batch` is 0.
+     */
+    sequence_file_batch_view(file_type & file, size_t const thread_count, size_t const records_per_batch)
+    {
+        if (thread_count == 0)
+            throw std::invalid_argument{"The thread_count parameter to parallel_batches must be > 0."};
+        if (records_per_batch == 0)
+            throw std::invalid_argument{"The records_per_batch parameter to parallel_batches must be > 0."};
+
+        auto deleter = [] (state * p)
+        {
+            if (p != nullptr)
+            {
+                {
+                    std::lock_guard lock{p->mutex};
+                    p->stop = true;
+                }
+                p->slot_changed.notify_all();
+                p->chunks.close();
+
+                if (p->reader.joinable())
+                    p->reader.join();
+                for (std::thread & parser : p->parsers)
+                    parser.join();
+
+                delete p;
+            }
+        };
+
+        state_ptr = std::shared_ptr<state>(new state{*file.secondary_stream,
+                                                     file.format,
+                                                     file.options,
+                                                     records_per_batch,
+                                                     2 * thread_count},
+                                           deleter);
+
+        // threads are started after the state is complete
+        state_ptr->reader = std::thread{[&s = *state_ptr] ()
+        {
+            assert(!s.format.valueless_by_exception());
+            std::visit([&s] (auto const & f) { read_chunks<std::remove_cvref_t<decltype(f)>>(s); }, s.format);
+        }};
+
+        state_ptr->parsers.reserve(thread_count);
+        for (size_t i = 0; i < thread_count; ++i)
+            state_ptr->parsers.emplace_back([&s = *state_ptr] () { parse_chunks(s); });
+    }
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    /*!\brief Returns an iterator to the next batch.
+     *
+     * \details
+     *
+     * ### Thread-Safety
+     *
+     * It is thread-safe to call this function. Subsequent calls to begin will result in different
+     * iterators that each receive different batches. It is thread-safe to operate on different iterators
+     * from different threads (however it is not thread-safe to operate on a single iterator from different
+     * threads).
+     */
+    sequence_file_batch_iterator begin()
+    {
+        assert(state_ptr != nullptr);
+        return sequence_file_batch_iterator{*state_ptr};
+    }
+
+    //!\brief Const-qualified sequence_file_batch_view::begin() is deleted, because iterating changes the view.
+    sequence_file_batch_iterator begin() const = delete;
+
+    //!\brief Returns a sentinel.
+    std::ranges::default_sentinel_t end()
+    {
+        return std::ranges::default_sentinel;
+    }
+
+    //!\brief Const-qualified sequence_file_batch_view::end() is deleted, because iterating changes the view.
+    std::ranges::default_sentinel_t end() const = delete;
+    //!\}
+};
+
+//!\brief The iterator of the seqan3::detail::sequence_file_batch_view.
+template <typename file_type>
+class sequence_file_batch_view<file_type>::sequence_file_batch_iterator
+{
+    //!\brief The state of the associated view.
+    state * state_ptr = nullptr;
+
+    //!\brief The batch this iterator currently points to.
+    mutable batch_type current_batch{};
+
+    //!\brief Whether this iterator is at end (all batches were delivered).
+    bool at_end = false;
+
+public:
+    /*!\name Associated types
+     * \{
+     */
+    //!\brief Difference type.
+    using difference_type   = std::ptrdiff_t;
+    //!\brief Value type.
+    using value_type        = batch_type;
+    //!\brief Pointer type.
+    using pointer           = value_type *;
+    //!\brief Reference type.
+    using reference         = value_type &;
+    //!\brief Iterator category.
+    using iterator_category = void;
+    //!\brief Iterator concept.
+    using iterator_concept  = std::input_iterator_tag;
+    //!\}
+
+    /*!\name Construction, destruction and assignment
+     * \{
+     */
+    sequence_file_batch_iterator()                                                     = default; //!< Defaulted.
+    sequence_file_batch_iterator(sequence_file_batch_iterator const & rhs)             = default; //!< Defaulted.
+    sequence_file_batch_iterator(sequence_file_batch_iterator && rhs)                  = default; //!< Defaulted.
+    sequence_file_batch_iterator & operator=(sequence_file_batch_iterator const & rhs) = default; //!< Defaulted.
+    sequence_file_batch_iterator & operator=(sequence_file_batch_iterator && rhs)      = default; //!< Defaulted.
+    ~sequence_file_batch_iterator()                                                    = default; //!< Defaulted.
+
+    //!\brief Constructing from the state of the underlying seqan3::detail::sequence_file_batch_view.
+    explicit sequence_file_batch_iterator(state & s) : state_ptr{&s}
+    {
+        ++(*this); // fetch the first batch
+    }
+    //!\}
+
+    /*!\name Access operations
+     * \{
+     */
+    //!\brief Return the current batch.
+    reference operator*() const noexcept
+    {
+        return current_batch;
+    }
+
+    //!\brief Returns pointer to the current batch.
+    pointer operator->() const noexcept
+    {
+        return std::addressof(current_batch);
+    }
+    //!\}
+
+    /*!\name Iterator operations
+     * \{
+     */
+    /*!\brief Pre-increment; waits until the next batch of the file is parsed.
+     * \throws seqan3::parse_error or any exception that occurred while reading from the stream; the exception of
+     *         a chunk is thrown when the chunk would have been delivered, and the iterator is at end afterwards.
+     */
+    sequence_file_batch_iterator & operator++()
+    {
+        if (at_end)
+            return *this;
+
+        assert(state_ptr != nullptr);
+        state & s = *state_ptr;
+
+        std::unique_lock lock{s.mutex};
+        s.slot_changed.wait(lock, [&s] ()
+        {
+            return s.next_chunk == s.chunk_count ||
+                   s.slots[s.next_chunk % s.slots.size()].status == slot_status::parsed;
+        });
+
+        if (s.next_chunk == s.chunk_count)
+        {
+            at_end = true;
+            return *this;
+        }
+
+        slot & next = s.slots[s.next_chunk % s.slots.size()];
+
+        if (next.error)
+        {
+            std::exception_ptr error = std::exchange(next.error, nullptr);
+            s.chunk_count = s.next_chunk; // all other iterators are at end, too
+            s.stop = true;
+            at_end = true;
+            lock.unlock();
+            s.slot_changed.notify_all();
+            std::rethrow_exception(error);
+        }
+
+        std::swap(current_batch, next.batch); // the old batch's memory is reused for a later chunk
+        next.status = slot_status::free;
+        ++s.next_chunk;
+
+        lock.unlock();
+        s.slot_changed.notify_all();
+        return *this;
+    }
+
+    //!\brief Post-increment.
+    void operator++(int)
+    {
+        ++(*this);
+    }
+    //!\}
+
+    /*!\name Comparison operators
+     * \{
+     */
+    //!\brief Compares for equality with sentinel.
+    friend constexpr bool operator==(sequence_file_batch_iterator const & lhs,
+                                     std::ranges::default_sentinel_t const &) noexcept
+    {
+        return lhs.at_end;
+    }
+
+    //!\copydoc operator==
+    friend constexpr bool operator==(std::ranges::default_sentinel_t const &,
+                                     sequence_file_batch_iterator const & rhs) noexcept
+    {
+        return rhs == std::ranges::default_sentinel_t{};
+    }
+
+    //!\brief Compares for inequality with sentinel.
+    friend constexpr bool operator!=(sequence_file_batch_iterator const & lhs,
+                                     std::ranges::default_sentinel_t const &) noexcept
+    {
+        return !(lhs == std::ranges::default_sentinel_t{});
+    }
+
+    //!\copydoc operator!=
+    friend constexpr bool operator!=(std::ranges::default_sentinel_t const &,
+                                     sequence_file_batch_iterator const & rhs) noexcept
+    {
+        return rhs != std::ranges::default_sentinel_t{};
+    }
+    //!\}
+};
+
+} // namespace seqan3::detail
@@ -24,3 +24,4 @@
 #include <seqan3/io/sequence_file/input.hpp>
 #include <seqan3/io/sequence_file/output_format_concept.hpp>
 #include <seqan3/io/sequence_file/output.hpp>
+#include <seqan3/io/sequence_file/record_batch.hpp>
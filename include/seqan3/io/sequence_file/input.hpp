@@ -26,17 +26,20 @@
 #include <seqan3/core/detail/pack_algorithm.hpp>
 #include <seqan3/core/type_list/traits.hpp>
 #include <seqan3/io/stream/concept.hpp>
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/std/filesystem>
 #include <seqan3/io/record.hpp>
 #include <seqan3/io/detail/in_file_iterator.hpp>
 #include <seqan3/io/detail/misc_input.hpp>
 #include <seqan3/io/detail/record.hpp>
+#include <seqan3/io/detail/sequence_file_batch_view.hpp>
 #include <seqan3/io/sequence_file/input_format_concept.hpp>
 #include <seqan3/io/sequence_file/format_embl.hpp>
 #include <seqan3/io/sequence_file/format_fasta.hpp>
 #include <seqan3/io/sequence_file/format_fastq.hpp>
 #include <seqan3/io/sequence_file/format_genbank.hpp>
+#include <seqan3/io/sequence_file/record_batch.hpp>
 #include <seqan3/io/alignment_file/format_sam.hpp>
 
 namespace seqan3
@@ -377,6 +380,9 @@ public:
     //!\brief The type of the record, a specialisation of seqan3::record; acts as a tuple of the selected field types.
     using record_type           = record<detail::select_types_with_ids_t<field_types, field_ids, selected_field_ids>,
                                          selected_field_ids>;
+
+    //!\brief The type of a batch of records as returned by read_batch(); stores every field column-wise.
+    using batch_type            = sequence_record_batch<sequence_type, id_type, quality_type>;
     //!\}
 
     /*!\name Range associated types
@@ -420,6 +426,7 @@ public:
     /*!\brief Construct from filename.
      * \param[in] filename      Path to the file you wish to open.
      * \param[in] fields_tag    A seqan3::fields tag. [optional]
+     * \param[in] buffer_options Configures the stream buffer, see seqan3::stream_buffer_options. [optional]
      * \throws seqan3::file_open_error If the file could not be opened, e.g. non-existant, non-readable, unknown format.
      *
      * \details
@@ -434,13 +441,11 @@ public:
      * See the section on \link io_compression compression and decompression \endlink for more information.
      */
     sequence_file_input(std::filesystem::path filename,
-                        selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{}, stream_deleter_default}
+                        selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{},
+                        stream_buffer_options const & buffer_options = stream_buffer_options{}) :
+        stream_buffer{buffer_options},
+        primary_stream{stream_buffer.open_input(filename).release(), stream_deleter_default}
     {
-        primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
-        static_cast<std::basic_ifstream<char> *>(primary_stream.get())->open(filename,
-                                                                             std::ios_base::in | std::ios::binary);
-
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
 
@@ -586,6 +591,104 @@ public:
     }
     //!\}
 
+    /*!\name Batch reading
+     * \brief Provides functions for reading the records column-wise into a seqan3::sequence_record_batch.
+     * \{
+     */
+    /*!\brief Reads the next `record_count` records into the batch buffer of the file.
+     * \param[in] record_count The maximal number of records to read.
+     * \returns A reference to the batch buffer; holds less than `record_count` records only at the end of the file
+     *          and is empty if the file is at end.
+     * \throws seqan3::format_error
+     *
+     * \details
+     *
+     * Instead of one seqan3::record per entry, the records are appended to the seqan3::concatenated_sequences
+     * columns of a seqan3::sequence_record_batch. The batch buffer is cleared at the beginning of every call, but
+     * keeps its memory, so after the first few batches no memory is allocated for reading.
+     *
+     * The function continues at the current position in the file, so record-wise iteration and batch reading can
+     * be mixed. The returned reference is invalidated by the next call to read_batch().
+     * field::seq_qual is not supported.
+     *
+     * \include test/snippet/io/sequence_file/sequence_file_input_read_batch.cpp
+     *
+     * ### Complexity
+     *
+     * Linear in the size of the records read.
+     *
+     * ### Exceptions
+     *
+     * Throws seqan3::format_error if a record could not be read.
+     */
+    batch_type & read_batch(size_t const record_count)
+    {
+        static_assert(!selected_field_ids::contains(field::seq_qual),
+                      "read_batch() does not support field::seq_qual, please select field::seq and "
+                      "field::qual instead.");
+
+        batch_buffer.clear();
+
+        // the record buffer always holds the next record of the file
+        if (!first_record_was_read)
+        {
+            read_next_record();
+            first_record_was_read = true;
+        }
+
+        for (size_t i = 0; i < record_count && !at_end; ++i)
+        {
+            batch_buffer.push_back(record_buffer);
+            read_next_record();
+        }
+
+        return batch_buffer;
+    }
+
+    /*!\brief Returns a range over batches of records that are parsed by a pool of threads.
+     * \param[in] thread_count      The number of threads that parse records; must be > 0.
+     * \param[in] records_per_batch The maximal number of records per batch; must be > 0.
+     * \returns An input range over seqan3::sequence_file_input::batch_type; the batches are delivered in the order of
+     *          the file.
+     * \throws std::invalid_argument if `thread_count` or `records_per_batch` is 0.
+     *
+     * \details
+     *
+     * Iterating the file parses all records on the iterating thread, and seqan3::views::async_input_buffer only
+     * moves this work to a single background thread. This function instead starts one thread that splits the
+     * (decompressed) stream into chunks of `records_per_batch` records at the record boundaries of the format and
+     * `thread_count` threads that parse the chunks. Every chunk is parsed into a seqan3::sequence_record_batch, which
+     * stores the sequences, ids and qualities of the records in seqan3::concatenated_sequences. Only the columns of
+     * the selected fields are filled.
+     *
+     * At most `2 * thread_count` chunks are in flight at any time. Memory of the batches is reused: when the
+     * iterator is incremented, the batch it pointed to is handed back to the pool and is refilled later.
+     *
+     * Parse errors are thrown from the iterator increment that would have delivered the erroneous batch, i.e. all
+     * batches before it are delivered first.
+     *
+     * The returned range reads from the stream of this file; the file must outlive the range and it must not be
+     * iterated in any other way (neither before nor after calling this function). field::seq_qual is not supported.
+     *
+     * \include test/snippet/io/sequence_file/sequence_file_input_parallel_batches.cpp
+     *
+     * ### Thread safety
+     *
+     * Multiple iterators may be obtained from the range and incremented concurrently from different threads;
+     * every batch is delivered to exactly one of them.
+     */
+    detail::sequence_file_batch_view<sequence_file_input> parallel_batches(size_t const thread_count,
+                                                                           size_t const records_per_batch)
+    {
+        static_assert(!selected_field_ids::contains(field::seq_qual),
+                      "parallel_batches() does not support field::seq_qual, please select field::seq and "
+                      "field::qual instead.");
+        assert(!first_record_was_read);
+
+        return {*this, thread_count, records_per_batch};
+    }
+    //!\}
+
     //!\brief The options are public and its members can be set directly.
     sequence_file_input_options<typename traits_type::sequence_legal_alphabet,
                              selected_field_ids::contains(field::seq_qual)> options;
@@ -597,8 +700,10 @@ protected:
      */
     //!\brief Buffer for a single record.
     record_type record_buffer;
-    //!\brief A larger (compared to stl default) stream buffer to use when reading from a file.
-    std::vector<char> stream_buffer{std::vector<char>(1'000'000)};
+    //!\brief Buffer for the records returned by read_batch().
+    batch_type batch_buffer;
+    //!\brief The stream buffer used when reading from a file, see seqan3::stream_buffer_options.
+    detail::file_stream_buffer stream_buffer{};
     //!\}
 
     /*!\name Stream / file access
@@ -668,6 +773,9 @@ protected:
 
     //!\brief Befriend iterator so it can access the buffers.
     friend iterator;
+
+    //!\brief Befriend the batch view so it can access the stream and the format.
+    friend detail::sequence_file_batch_view<sequence_file_input>;
 };
 
 /*!\name Type deduction guides
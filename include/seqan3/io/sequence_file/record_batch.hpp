@@ -0,0 +1,88 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::sequence_record_batch.
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <seqan3/io/record.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+
+namespace seqan3
+{
+
+/*!\brief A column-wise batch of sequence file records.
+ * \ingroup sequence
+ * \tparam sequence_type The type of field::seq, e.g. seqan3::sequence_file_input::sequence_type.
+ * \tparam id_type       The type of field::id, e.g. seqan3::sequence_file_input::id_type.
+ * \tparam quality_type  The type of field::qual, e.g. seqan3::sequence_file_input::quality_type.
+ *
+ * \details
+ *
+ * Instead of storing one seqan3::record per entry of the file, the batch stores every field in its own
+ * seqan3::concatenated_sequences, i.e. the sequences of all records in the batch are kept in one contiguous
+ * buffer. The i-th record of the batch is made up of `sequences[i]`, `ids[i]` and `qualities[i]`.
+ *
+ * Only the columns of the fields that were selected on the file are filled, all other columns are empty.
+ * Clearing the batch keeps the allocated memory, so reusing a batch for the next chunk of records does not
+ * allocate once the buffers have grown to the size of a typical batch.
+ *
+ * Batches are returned by seqan3::sequence_file_input::read_batch() and
+ * seqan3::sequence_file_input::parallel_batches(). Since every column is a random access range over contiguous
+ * memory, the columns can be passed directly to algorithms that expect a range of sequences, e.g.
+ * seqan3::align_pairwise or seqan3::views::minimiser_hash applied per sequence.
+ */
+template <typename sequence_type, typename id_type, typename quality_type>
+struct sequence_record_batch
+{
+    //!\brief The sequences (field::seq) of the records.
+    concatenated_sequences<sequence_type> sequences{};
+    //!\brief The ids (field::id) of the records.
+    concatenated_sequences<id_type> ids{};
+    //!\brief The qualities (field::qual) of the records.
+    concatenated_sequences<quality_type> qualities{};
+
+    //!\brief The number of records in the batch.
+    size_t size() const noexcept
+    {
+        return std::max({sequences.size(), ids.size(), qualities.size()});
+    }
+
+    //!\brief Whether the batch contains no records.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /*!\brief Appends the fields of a record to the respective columns.
+     * \param[in] r The record; only field::seq, field::id and field::qual are appended, if present.
+     */
+    template <typename field_types, typename field_ids>
+    void push_back(record<field_types, field_ids> const & r)
+    {
+        if constexpr (field_ids::contains(field::seq))
+            sequences.push_back(get<field::seq>(r));
+        if constexpr (field_ids::contains(field::id))
+            ids.push_back(get<field::id>(r));
+        if constexpr (field_ids::contains(field::qual))
+            qualities.push_back(get<field::qual>(r));
+    }
+
+    //!\brief Removes all records but keeps the allocated memory.
+    void clear() noexcept
+    {
+        sequences.clear();
+        ids.clear();
+        qualities.clear();
+    }
+};
+
+} // namespace seqan3
@@ -17,5 +17,6 @@
 
 #pragma once
 
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/stream/concept.hpp>
 #include <seqan3/io/stream/iterator.hpp>
@@ -0,0 +1,428 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::stream_buffer_options and seqan3::stream_buffer_pool.
+ */
+
+#pragma once
+
+#include <cerrno>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <streambuf>
+#include <utility>
+#include <vector>
+
+#if __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <unistd.h>
+#define SEQAN3_HAS_POSIX_FILE_DESCRIPTORS 1
+#endif
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/filesystem>
+
+namespace seqan3
+{
+
+/*!\brief A thread-safe pool of stream buffers that are shared by files opened one after another.
+ * \ingroup stream
+ *
+ * \details
+ *
+ * Every file that is opened by file name allocates (and zero-initialises) its stream buffer. When opening many small
+ * files, e.g. thousands of FASTA files with a single sequence, this allocation can dominate the run time. If the files
+ * are given a shared pool via seqan3::stream_buffer_options::pool, the buffer of a closed file is handed back to the
+ * pool and reused by the next file that is opened.
+ *
+ * The pool keeps at most `max_buffers` buffers; further buffers that are handed back are freed.
+ */
+class stream_buffer_pool
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    stream_buffer_pool() = default;                                       //!< Defaulted.
+    stream_buffer_pool(stream_buffer_pool const &) = delete;              //!< Deleted, because of the mutex.
+    stream_buffer_pool(stream_buffer_pool &&) = delete;                   //!< Deleted, because of the mutex.
+    stream_buffer_pool & operator=(stream_buffer_pool const &) = delete;  //!< Deleted, because of the mutex.
+    stream_buffer_pool & operator=(stream_buffer_pool &&) = delete;       //!< Deleted, because of the mutex.
+    ~stream_buffer_pool() = default;                                      //!< Defaulted.
+
+    //!\brief Construction with the maximal number of buffers that are kept in the pool.
+    explicit stream_buffer_pool(size_t const max_buffers) : max_buffers{max_buffers}
+    {}
+    //!\}
+
+    /*!\brief Returns a buffer of the given size; reuses a pooled buffer if one with enough capacity is available.
+     * \param[in] size The size of the buffer.
+     */
+    std::vector<char> acquire(size_t const size)
+    {
+        {
+            std::lock_guard lock{mutex};
+
+            for (auto it = buffers.rbegin(); it != buffers.rend(); ++it)
+            {
+                if (it->capacity() >= size)
+                {
+                    std::vector<char> buffer = std::move(*it);
+                    buffers.erase(std::next(it).base());
+                    buffer.resize(size); // does not allocate
+                    return buffer;
+                }
+            }
+        }
+
+        return std::vector<char>(size);
+    }
+
+    /*!\brief Hands a buffer back to the pool.
+     * \param[in] buffer The buffer; it is freed if the pool is full.
+     */
+    void release(std::vector<char> && buffer)
+    {
+        if (buffer.capacity() == 0)
+            return;
+
+        std::lock_guard lock{mutex};
+
+        if (buffers.size() < max_buffers)
+            buffers.push_back(std::move(buffer));
+    }
+
+    //!\brief The number of buffers that are currently kept in the pool.
+    size_t size() const
+    {
+        std::lock_guard lock{mutex};
+        return buffers.size();
+    }
+
+private:
+    //!\brief Guards the buffers.
+    mutable std::mutex mutex{};
+    //!\brief The buffers that are not in use.
+    std::vector<std::vector<char>> buffers{};
+    //!\brief The maximal number of buffers that are kept.
+    size_t max_buffers{std::numeric_limits<size_t>::max()};
+};
+
+/*!\brief Configures the stream buffer of files that are opened by file name.
+ * \ingroup stream
+ *
+ * \details
+ *
+ * The options are passed as last argument to the file name constructors of the file classes, e.g.
+ * seqan3::sequence_file_input, seqan3::alignment_file_output or seqan3::structure_file_input:
+ *
+ * \include test/snippet/io/stream/stream_buffer_options.cpp
+ *
+ * They have no effect on files that are constructed from a stream, since the buffer of a user provided stream is
+ * managed by the user.
+ */
+struct stream_buffer_options
+{
+    /*!\brief The size of the stream buffer in bytes.
+     *
+     * \details
+     *
+     * A large buffer reduces the number of system calls. Fast local disks usually do not benefit from buffers
+     * larger than a few hundred kilobytes, while network file systems may benefit from buffers of several megabytes.
+     * If the size is 0, the default buffer of std::basic_filebuf is used.
+     */
+    size_t buffer_size{1'000'000};
+
+    /*!\brief Advise the operating system that the file is read sequentially (input files only).
+     *
+     * \details
+     *
+     * If enabled, `posix_fadvise(POSIX_FADV_SEQUENTIAL)` is called on the file after opening it, which enlarges the
+     * read-ahead window of the kernel. This has no effect on systems that do not provide `posix_fadvise`.
+     */
+    bool sequential_read_hint{false};
+
+    /*!\brief Read the file with `O_DIRECT`, i.e. bypass the page cache of the operating system (input files only).
+     *
+     * \details
+     *
+     * Reading a huge file that is only read once through the page cache evicts the cached data of other files.
+     * Direct I/O reads into the stream buffer without caching, which requires the buffer to be aligned to 4 KiB; only
+     * the aligned part of the buffer is used and buffers smaller than 8 KiB are enlarged. If the file system does
+     * not support direct I/O, the file is read through the page cache. This has no effect on systems that do not
+     * provide `O_DIRECT`.
+     */
+    bool direct_io{false};
+
+    //!\brief The pool the stream buffer is taken from and handed back to; if `nullptr`, the buffer is not shared.
+    std::shared_ptr<stream_buffer_pool> pool{};
+};
+
+} // namespace seqan3
+
+namespace seqan3::detail
+{
+
+#ifdef SEQAN3_HAS_POSIX_FILE_DESCRIPTORS
+/*!\brief A stream buffer that reads from a file descriptor it owns into memory it is given.
+ * \ingroup stream
+ *
+ * \details
+ *
+ * seqan3::detail::file_stream_buffer opens the file itself if the operating system is given hints about how the
+ * file is read, because std::basic_filebuf does not expose its file descriptor.
+ */
+class file_descriptor_buffer : public std::basic_streambuf<char>
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    file_descriptor_buffer() = delete;                                            //!< Deleted.
+    file_descriptor_buffer(file_descriptor_buffer const &) = delete;              //!< Deleted.
+    file_descriptor_buffer(file_descriptor_buffer &&) = delete;                   //!< Deleted.
+    file_descriptor_buffer & operator=(file_descriptor_buffer const &) = delete;  //!< Deleted.
+    file_descriptor_buffer & operator=(file_descriptor_buffer &&) = delete;       //!< Deleted.
+
+    //!\brief Closes the file.
+    ~file_descriptor_buffer() override
+    {
+        ::close(file_descriptor);
+    }
+
+    /*!\brief Takes ownership of the file descriptor.
+     * \param[in] file_descriptor The file descriptor of the file that is opened for reading.
+     * \param[in] data            The memory the file is read into; must be aligned if the file is opened with
+     *                            `O_DIRECT`.
+     * \param[in] size            The size of the memory; must be a multiple of the alignment if the file is opened
+     *                            with `O_DIRECT`.
+     */
+    file_descriptor_buffer(int const file_descriptor, char * const data, size_t const size) noexcept :
+        file_descriptor{file_descriptor},
+        data{data},
+        size{size}
+    {
+        setg(data, data, data);
+    }
+    //!\}
+
+protected:
+    //!\brief Reads the next chunk of the file into the memory.
+    int_type underflow() override
+    {
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+
+        ssize_t const count = read_chunk();
+
+        if (count <= 0)
+            return traits_type::eof();
+
+        setg(data, data, data + count);
+        return traits_type::to_int_type(*gptr());
+    }
+
+private:
+    //!\brief Reads at most `size` bytes and returns the number of read bytes, 0 at the end of the file or -1.
+    ssize_t read_chunk() noexcept
+    {
+        while (true)
+        {
+            ssize_t const count = ::read(file_descriptor, data, size);
+
+            if (count >= 0)
+                return count;
+
+            int const error = errno;
+
+            if (error == EINTR)
+                continue;
+
+#ifdef O_DIRECT
+            // A short read that is not at the end of the file leaves the offset unaligned, which O_DIRECT rejects.
+            int const flags = ::fcntl(file_descriptor, F_GETFL);
+
+            if (error == EINVAL && flags >= 0 && (flags & O_DIRECT) &&
+                ::fcntl(file_descriptor, F_SETFL, flags & ~O_DIRECT) == 0)
+                continue;
+#endif
+            return count;
+        }
+    }
+
+    //!\brief The file descriptor of the opened file.
+    int file_descriptor;
+    //!\brief The memory the file is read into.
+    char * data;
+    //!\brief The size of the memory.
+    size_t size;
+};
+#endif // SEQAN3_HAS_POSIX_FILE_DESCRIPTORS
+
+/*!\brief The stream buffer of a file that is opened by file name; hands the buffer back to the pool on destruction.
+ * \ingroup stream
+ *
+ * \details
+ *
+ * Move assignment swaps the buffers, so the buffer of the assigned-to file stays alive until the moved-from file is
+ * destroyed. This is necessary, because the stream that uses the buffer is destroyed after the buffer is assigned.
+ */
+class file_stream_buffer
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    file_stream_buffer() = default;                                       //!< Defaulted.
+    file_stream_buffer(file_stream_buffer const &) = delete;              //!< Deleted.
+    file_stream_buffer & operator=(file_stream_buffer const &) = delete;  //!< Deleted.
+
+    //!\brief Move construction.
+    file_stream_buffer(file_stream_buffer && other) noexcept :
+        buffer{std::move(other.buffer)},
+        pool{std::move(other.pool)},
+        sequential_read_hint{other.sequential_read_hint},
+        direct_io{other.direct_io},
+        descriptor_buffer{std::move(other.descriptor_buffer)}
+    {}
+
+    //!\brief Move assignment; swaps the buffers.
+    file_stream_buffer & operator=(file_stream_buffer && other) noexcept
+    {
+        std::swap(buffer, other.buffer);
+        std::swap(pool, other.pool);
+        std::swap(sequential_read_hint, other.sequential_read_hint);
+        std::swap(direct_io, other.direct_io);
+        std::swap(descriptor_buffer, other.descriptor_buffer);
+        return *this;
+    }
+
+    //!\brief Hands the buffer back to the pool, if there is one.
+    ~file_stream_buffer()
+    {
+        descriptor_buffer.reset(); // closes the file before the memory is handed back
+
+        if (pool == nullptr)
+            return;
+
+        try
+        {
+            pool->release(std::move(buffer));
+        }
+        catch (...) // the buffer is freed instead
+        {}
+    }
+
+    //!\brief Allocates or acquires the buffer as configured by the options.
+    explicit file_stream_buffer(stream_buffer_options const & options) :
+        pool{options.pool},
+        sequential_read_hint{options.sequential_read_hint},
+        direct_io{options.direct_io}
+    {
+        if (options.buffer_size == 0)
+            return;
+
+        buffer = (pool != nullptr) ? pool->acquire(options.buffer_size) : std::vector<char>(options.buffer_size);
+    }
+    //!\}
+
+    //!\brief Sets the buffer on the stream buffer of a file stream; must be called before the file is opened.
+    void set_on(std::basic_streambuf<char> & stream_buffer)
+    {
+        if (!buffer.empty())
+            stream_buffer.pubsetbuf(buffer.data(), buffer.size());
+    }
+
+    /*!\brief Opens the file for reading with the buffer and the hints of the seqan3::stream_buffer_options.
+     * \param[in] filename The path of the file.
+     * \returns The stream of the file; it is not good() if the file could not be opened.
+     *
+     * \details
+     *
+     * If the operating system is given hints, the file is opened by this class and read via a
+     * seqan3::detail::file_descriptor_buffer, otherwise a std::basic_ifstream is returned. The stream reads into the
+     * buffer of this object, so only one file may be opened per object and the object must outlive the stream.
+     */
+    std::unique_ptr<std::basic_istream<char>> open_input(std::filesystem::path const & filename)
+    {
+#ifdef SEQAN3_HAS_POSIX_FILE_DESCRIPTORS
+        if (sequential_read_hint || direct_io)
+            return open_file_descriptor(filename);
+#endif
+
+        auto file = std::make_unique<std::basic_ifstream<char>>();
+        set_on(*file->rdbuf());
+        file->open(filename, std::ios_base::in | std::ios::binary);
+        return file;
+    }
+
+    //!\brief The size of the buffer.
+    size_t size() const noexcept
+    {
+        return buffer.size();
+    }
+
+private:
+#ifdef SEQAN3_HAS_POSIX_FILE_DESCRIPTORS
+    //!\brief Opens the file with `open`, passes the hints on to the operating system and reads it into the buffer.
+    std::unique_ptr<std::basic_istream<char>> open_file_descriptor(std::filesystem::path const & filename)
+    {
+        constexpr size_t alignment = 4096;
+
+        if (buffer.size() < 2 * alignment)
+            buffer.resize(2 * alignment);
+
+        char * data = buffer.data();
+        size_t size = buffer.size();
+        int flags = O_RDONLY;
+
+#ifdef O_DIRECT
+        if (direct_io)
+        {
+            size_t const offset = (alignment - reinterpret_cast<uintptr_t>(data) % alignment) % alignment;
+            data += offset;
+            size = (size - offset) / alignment * alignment;
+            flags |= O_DIRECT;
+        }
+#endif
+
+        int file_descriptor = ::open(filename.c_str(), flags);
+
+        if (file_descriptor < 0 && flags != O_RDONLY) // the file system may not support O_DIRECT
+            file_descriptor = ::open(filename.c_str(), O_RDONLY);
+
+        if (file_descriptor < 0)
+            return std::make_unique<std::basic_istream<char>>(nullptr);
+
+#ifdef POSIX_FADV_SEQUENTIAL
+        if (sequential_read_hint)
+            ::posix_fadvise(file_descriptor, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+        descriptor_buffer = std::make_unique<file_descriptor_buffer>(file_descriptor, data, size);
+        return std::make_unique<std::basic_istream<char>>(descriptor_buffer.get());
+    }
+#endif // SEQAN3_HAS_POSIX_FILE_DESCRIPTORS
+
+    //!\brief The buffer.
+    std::vector<char> buffer{};
+    //!\brief The pool the buffer was acquired from.
+    std::shared_ptr<stream_buffer_pool> pool{};
+    //!\brief Whether the operating system is advised that the file is read sequentially.
+    bool sequential_read_hint{false};
+    //!\brief Whether the file is read with `O_DIRECT`.
+    bool direct_io{false};
+    //!\brief The stream buffer of the file if it is opened by this class.
+    std::unique_ptr<std::basic_streambuf<char>> descriptor_buffer{};
+};
+
+} // namespace seqan3::detail
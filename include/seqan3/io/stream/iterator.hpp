@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <cassert>
 #include <iterator>
+#include <string>
 
 #ifndef __cpp_lib_ranges
 #include <range/v3/iterator/stream_iterators.hpp>
@@ -136,6 +138,40 @@ public:
     }
     //!\}
 
+    /*!\brief Appends all characters up to the next `'\n'` to the given string and skips the `'\n'`.
+     * \param[in,out] line The string to append the characters to.
+     *
+     * \details
+     *
+     * Instead of advancing character by character, the get area of the stream buffer is searched with
+     * `traits_t::find` (i.e. `memchr` for `char`) and the characters are appended chunk-wise. A `'\r'` preceding the
+     * `'\n'` is part of the line. If no `'\n'` is found, all characters until the end of the stream are appended.
+     */
+    void read_line(std::basic_string<char_t, traits_t> & line)
+    {
+        assert(stream_buf != nullptr);
+
+        while (stream_buf->gptr() != stream_buf->egptr())
+        {
+            char_t * const chunk_begin = stream_buf->gptr();
+            size_t const chunk_size = stream_buf->egptr() - chunk_begin;
+            char_t const * const delimiter = traits_t::find(chunk_begin, chunk_size, char_t{'\n'});
+
+            if (delimiter != nullptr)
+            {
+                size_t const line_size = delimiter - chunk_begin;
+                line.append(chunk_begin, line_size);
+                stream_buf->gbump(line_size);
+                ++(*this); // skip '\n' and rebuffer if necessary
+                return;
+            }
+
+            line.append(chunk_begin, chunk_size);
+            stream_buf->gbump(chunk_size);
+            stream_buf->underflow();
+        }
+    }
+
     //!\brief Read current value from buffer (no vtable lookup, safe if not at end).
     reference operator*() const
     {
@@ -29,6 +29,7 @@
 #include <seqan3/alphabet/structure/structured_aa.hpp>
 #include <seqan3/core/type_list/traits.hpp>
 #include <seqan3/io/stream/concept.hpp>
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/std/filesystem>
 #include <seqan3/io/record.hpp>
@@ -590,6 +591,7 @@ public:
     /*!\brief Construct from filename.
      * \param[in] filename Path to the file you wish to open.
      * \param[in] fields_tag A seqan3::fields tag. [optional]
+     * \param[in] buffer_options Configures the stream buffer, see seqan3::stream_buffer_options. [optional]
      * \throws seqan3::file_open_error if the file could not be opened, e.g. non-existent, non-readable, unknown format.
      *
      * \details
@@ -604,13 +606,11 @@ public:
      * See the section on \link io_compression compression and decompression \endlink for more information.
      */
     structure_file_input(std::filesystem::path filename,
-                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
-        primary_stream{new std::ifstream{}, stream_deleter_default}
+                         selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{},
+                         stream_buffer_options const & buffer_options = stream_buffer_options{}) :
+        stream_buffer{buffer_options},
+        primary_stream{stream_buffer.open_input(filename).release(), stream_deleter_default}
     {
-        primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
-        static_cast<std::basic_ifstream<char> *>(primary_stream.get())->open(filename,
-                                                                             std::ios_base::in | std::ios::binary);
-
         if (!primary_stream->good())
             throw file_open_error{"Could not open file " + filename.string() + " for reading."};
 
@@ -760,8 +760,8 @@ protected:
      */
     //!\brief Buffer for a single record.
     record_type record_buffer;
-    //!\brief A larger (compared to stl default) stream buffer to use when reading from a file.
-    std::vector<char> stream_buffer{std::vector<char>(1'000'000)};
+    //!\brief The stream buffer used when reading from a file, see seqan3::stream_buffer_options.
+    detail::file_stream_buffer stream_buffer{};
     //!\}
 
     /*!\name Stream / file access
@@ -22,6 +22,7 @@
 #include <seqan3/core/type_list/traits.hpp>
 #include <seqan3/core/concept/tuple.hpp>
 #include <seqan3/io/stream/concept.hpp>
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/exception.hpp>
 #include <seqan3/std/filesystem>
 #include <seqan3/io/record.hpp>
@@ -244,6 +245,7 @@ public:
     /*!\brief Construct from filename.
      * \param[in] filename Path to the file you wish to open.
      * \param[in] fields_tag A seqan3::fields tag. [optional]
+     * \param[in] buffer_options Configures the stream buffer, see seqan3::stream_buffer_options. [optional]
      *
      * \details
      *
@@ -257,10 +259,12 @@ public:
      * See the section on \link io_compression compression and decompression \endlink for more information.
      */
     structure_file_output(std::filesystem::path filename,
-                          selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{}) :
+                          selected_field_ids const & SEQAN3_DOXYGEN_ONLY(fields_tag) = selected_field_ids{},
+                          stream_buffer_options const & buffer_options = stream_buffer_options{}) :
+        stream_buffer{buffer_options},
         primary_stream{new std::ofstream{}, stream_deleter_default}
     {
-        primary_stream->rdbuf()->pubsetbuf(stream_buffer.data(), stream_buffer.size());
+        stream_buffer.set_on(*primary_stream->rdbuf());
         static_cast<std::basic_ofstream<char> *>(primary_stream.get())->open(filename,
                                                                              std::ios_base::out | std::ios::binary);
 
@@ -567,8 +571,8 @@ public:
     //!\endcond
 protected:
     //!\privatesection
-    //!\brief A larger (compared to stl default) stream buffer to use when reading from a file.
-    std::vector<char> stream_buffer{std::vector<char>(1'000'000)};
+    //!\brief The stream buffer used when writing to a file, see seqan3::stream_buffer_options.
+    detail::file_stream_buffer stream_buffer{};
 
     /*!\name Stream / file access
      * \{
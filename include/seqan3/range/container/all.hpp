@@ -14,8 +14,11 @@
 
 #include <seqan3/range/container/aligned_allocator.hpp>
 #include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/bitcompressed_vector_operations.hpp>
 #include <seqan3/range/container/concatenated_sequences.hpp>
 #include <seqan3/range/container/concept.hpp>
+#include <seqan3/range/container/dna4_operations.hpp>
+#include <seqan3/range/container/mapped_concatenated_sequences.hpp>
 #include <seqan3/range/container/small_string.hpp>
 #include <seqan3/range/container/small_vector.hpp>
 
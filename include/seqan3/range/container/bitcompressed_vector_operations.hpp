@@ -0,0 +1,457 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides word-level operations on seqan3::bitcompressed_vector, e.g. seqan3::count_mismatches and
+ *        seqan3::packed_kmers.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/std/concepts>
+
+namespace seqan3::detail
+{
+
+//!\brief The number of bits a letter occupies in the seqan3::bitcompressed_vector over `alphabet_t`.
+template <typename alphabet_t>
+inline constexpr size_t bitcompressed_letter_width =
+    std::remove_reference_t<decltype(std::declval<bitcompressed_vector<alphabet_t> const &>().raw_data())>::
+        fixed_int_width;
+
+//!\brief Returns a word where the lowest `count` bits are set; `count` must not exceed 64.
+constexpr uint64_t lowest_bits_mask(size_t const count) noexcept
+{
+    return (count >= 64) ? ~0ULL : (1ULL << count) - 1;
+}
+
+/*!\brief Reads `count` bits starting at an arbitrary bit position of the packed words.
+ * \param[in] words        The packed words; bit `i` is bit `i % 64` of word `i / 64`.
+ * \param[in] bit_position The position of the first bit.
+ * \param[in] count        The number of bits; must be in `[1, 64]`.
+ * \returns The bits in the lowest `count` bits of the word; the remaining bits are 0.
+ *
+ * \details
+ *
+ * Touches the word following the first one only if the bits span both, so no word after the last bit is read.
+ */
+inline uint64_t read_packed_bits(uint64_t const * const words, size_t const bit_position, size_t const count) noexcept
+{
+    assert(count > 0 && count <= 64);
+
+    size_t const offset = bit_position % 64;
+    uint64_t bits = words[bit_position / 64] >> offset;
+
+    if (offset + count > 64) // offset > 0, since count <= 64
+        bits |= words[bit_position / 64 + 1] << (64 - offset);
+
+    return bits & lowest_bits_mask(count);
+}
+
+/*!\brief The letters of a seqan3::bitcompressed_vector that are compared in one step by seqan3::count_mismatches.
+ * \tparam width The number of bits per letter.
+ */
+template <size_t width>
+struct packed_letter_chunk
+{
+    //!\brief The number of letters in a 64 bit word.
+    static constexpr size_t letters = 64 / width;
+    //!\brief The number of bits the letters occupy.
+    static constexpr size_t bits = letters * width;
+
+    //!\brief A word where the lowest bit of every letter is set.
+    static constexpr uint64_t lowest_letter_bits = []() constexpr
+    {
+        uint64_t mask{};
+        for (size_t i = 0; i < letters; ++i)
+            mask |= 1ULL << (i * width);
+        return mask;
+    }();
+
+    /*!\brief Returns a word where the lowest bit of a letter is set iff the letter differs between the two words.
+     * \param[in] lhs The letters of the first sequence.
+     * \param[in] rhs The letters of the second sequence.
+     */
+    static constexpr uint64_t mismatches(uint64_t const lhs, uint64_t const rhs) noexcept
+    {
+        uint64_t const difference = lhs ^ rhs;
+        uint64_t folded = difference;
+
+        // Moves every bit of a letter onto its lowest bit; bits of the following letter that are moved onto the
+        // higher bits of a letter are masked out below.
+        for (size_t shift = 1; shift < width; ++shift)
+            folded |= difference >> shift;
+
+        return folded & lowest_letter_bits;
+    }
+};
+
+/*!\brief Calls `on_chunk(mismatches)` for every chunk of up to 64 bits of two slices of packed letters.
+ * \tparam width The number of bits per letter.
+ * \param[in] lhs       The packed words of the first sequence.
+ * \param[in] lhs_begin The position of the first letter of the first slice.
+ * \param[in] rhs       The packed words of the second sequence.
+ * \param[in] rhs_begin The position of the first letter of the second slice.
+ * \param[in] count     The number of letters of both slices.
+ * \param[in] on_chunk  Called with the result of seqan3::detail::packed_letter_chunk::mismatches for every chunk;
+ *                      stops the iteration if it returns `false`.
+ */
+template <size_t width, typename on_chunk_t>
+inline void for_each_mismatch_chunk(uint64_t const * const lhs,
+                                    size_t const lhs_begin,
+                                    uint64_t const * const rhs,
+                                    size_t const rhs_begin,
+                                    size_t const count,
+                                    on_chunk_t && on_chunk)
+{
+    using chunk_t = packed_letter_chunk<width>;
+
+    size_t const lhs_bit_begin = lhs_begin * width;
+    size_t const rhs_bit_begin = rhs_begin * width;
+    size_t const bit_count = count * width;
+
+    for (size_t bit = 0; bit < bit_count; bit += chunk_t::bits)
+    {
+        size_t const chunk_bits = std::min(chunk_t::bits, bit_count - bit);
+        uint64_t const mismatches = chunk_t::mismatches(read_packed_bits(lhs, lhs_bit_begin + bit, chunk_bits),
+                                                        read_packed_bits(rhs, rhs_bit_begin + bit, chunk_bits));
+        if (!on_chunk(mismatches))
+            return;
+    }
+}
+
+//!\brief Returns the rank of every character; computed once per alphabet.
+template <writable_alphabet alphabet_t>
+inline std::array<uint64_t, 256> const & packed_rank_of_char()
+{
+    static std::array<uint64_t, 256> const ranks = [] ()
+    {
+        std::array<uint64_t, 256> ranks{};
+        for (size_t c = 0; c < 256; ++c)
+            ranks[c] = seqan3::to_rank(seqan3::assign_char_to(static_cast<char>(c), alphabet_t{}));
+        return ranks;
+    }();
+
+    return ranks;
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\name Word-level operations on seqan3::bitcompressed_vector
+ * \brief Copy, compare and hash the letters of a seqan3::bitcompressed_vector 64 bits at a time.
+ * \ingroup container
+ *
+ * \details
+ *
+ * Element-wise algorithms access a seqan3::bitcompressed_vector through its proxy reference, which extracts (and
+ * writes back) every letter separately. These functions work on the packed words of the underlying
+ * seqan3::bitcompressed_vector::raw_data() instead and handle `64 / w` letters per step, where `w` is the number of
+ * bits per letter, e.g. 32 seqan3::dna4 or 12 seqan3::aa27 letters.
+ *
+ * Slices are given as positions and are not checked; they must lie within the sequences.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/container/bitcompressed_vector_operations.cpp
+ * \{
+ */
+
+/*!\brief Assigns the characters to the packed sequence, converting them like seqan3::assign_char_to.
+ * \tparam alphabet_t The alphabet type; must model seqan3::writable_alphabet with `char` as character type.
+ * \param[in]  chars    The characters.
+ * \param[out] sequence The sequence; it is resized to the number of characters.
+ *
+ * \details
+ *
+ * The packed words are assembled in a register and written once, instead of writing every letter through the proxy.
+ * For seqan3::dna4 there is a faster overload that uses simd instructions, see
+ * seqan3/range/container/dna4_operations.hpp.
+ *
+ * ### Complexity
+ *
+ * Linear in the number of characters.
+ *
+ * ### Exceptions
+ *
+ * Basic exception guarantee.
+ */
+template <writable_alphabet alphabet_t>
+//!\cond
+    requires std::same_as<alphabet_char_t<alphabet_t>, char>
+//!\endcond
+inline void assign_chars_to(std::string_view const chars, bitcompressed_vector<alphabet_t> & sequence)
+{
+    constexpr size_t width = detail::bitcompressed_letter_width<alphabet_t>;
+    std::array<uint64_t, 256> const & rank_of_char = detail::packed_rank_of_char<alphabet_t>();
+
+    sequence.resize(chars.size());
+    uint64_t * words = sequence.raw_data().data();
+
+    size_t position{};
+    if constexpr (64 % width == 0) // no letter spans two words, so the full words are assembled independently
+    {
+        constexpr size_t letters_per_word = 64 / width;
+
+        for (; position + letters_per_word <= chars.size(); position += letters_per_word)
+        {
+            uint64_t word{};
+            for (size_t i = 0; i < letters_per_word; ++i)
+                word |= rank_of_char[static_cast<uint8_t>(chars[position + i])] << (i * width);
+            *words++ = word;
+        }
+    }
+
+    uint64_t word{};
+    size_t offset{};
+    for (char const c : chars.substr(position))
+    {
+        uint64_t const rank = rank_of_char[static_cast<uint8_t>(c)];
+        word |= rank << offset;
+        offset += width;
+
+        if (offset >= 64) // the word is full; the bits of the rank that did not fit start the next word
+        {
+            *words++ = word;
+            offset -= 64;
+            word = (offset == 0) ? 0 : rank >> (width - offset);
+        }
+    }
+
+    if (offset > 0)
+        *words = word;
+}
+
+/*!\brief Counts the positions at which two slices of packed sequences differ.
+ * \param[in] lhs       The first sequence.
+ * \param[in] lhs_begin The position of the first letter of the slice of `lhs`.
+ * \param[in] rhs       The second sequence.
+ * \param[in] rhs_begin The position of the first letter of the slice of `rhs`.
+ * \param[in] count     The number of letters of both slices.
+ * \returns The Hamming distance of `lhs[lhs_begin, lhs_begin + count)` and `rhs[rhs_begin, rhs_begin + count)`.
+ *
+ * \details
+ *
+ * The slices may start at arbitrary positions. Per step, `64 / w` letters of both slices are XORed, the bits of every
+ * letter are ORed into its lowest bit and the differing letters are counted with seqan3::detail::popcount.
+ *
+ * ### Complexity
+ *
+ * Linear in `count`.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ */
+template <semialphabet alphabet_t>
+inline size_t count_mismatches(bitcompressed_vector<alphabet_t> const & lhs,
+                               size_t const lhs_begin,
+                               bitcompressed_vector<alphabet_t> const & rhs,
+                               size_t const rhs_begin,
+                               size_t const count) noexcept
+{
+    assert(lhs_begin + count <= lhs.size());
+    assert(rhs_begin + count <= rhs.size());
+
+    size_t mismatches{};
+    detail::for_each_mismatch_chunk<detail::bitcompressed_letter_width<alphabet_t>>(
+        lhs.raw_data().data(), lhs_begin, rhs.raw_data().data(), rhs_begin, count,
+        [&mismatches] (uint64_t const chunk_mismatches)
+        {
+            mismatches += detail::popcount(chunk_mismatches);
+            return true;
+        });
+
+    return mismatches;
+}
+
+/*!\brief Counts the positions at which two packed sequences differ, up to the length of the shorter one.
+ * \param[in] lhs The first sequence.
+ * \param[in] rhs The second sequence.
+ * \returns The Hamming distance of the prefixes of length `std::min(lhs.size(), rhs.size())`.
+ *
+ * \details
+ *
+ * ### Complexity
+ *
+ * Linear in the size of the shorter sequence.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ */
+template <semialphabet alphabet_t>
+inline size_t count_mismatches(bitcompressed_vector<alphabet_t> const & lhs,
+                               bitcompressed_vector<alphabet_t> const & rhs) noexcept
+{
+    return count_mismatches(lhs, 0, rhs, 0, std::min(lhs.size(), rhs.size()));
+}
+
+/*!\brief Whether two slices of packed sequences are equal.
+ * \param[in] lhs       The first sequence.
+ * \param[in] lhs_begin The position of the first letter of the slice of `lhs`.
+ * \param[in] rhs       The second sequence.
+ * \param[in] rhs_begin The position of the first letter of the slice of `rhs`.
+ * \param[in] count     The number of letters of both slices.
+ *
+ * \details
+ *
+ * Works like seqan3::count_mismatches, but stops at the first chunk of letters that differs.
+ *
+ * ### Complexity
+ *
+ * Linear in `count`.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ */
+template <semialphabet alphabet_t>
+inline bool equal_slices(bitcompressed_vector<alphabet_t> const & lhs,
+                         size_t const lhs_begin,
+                         bitcompressed_vector<alphabet_t> const & rhs,
+                         size_t const rhs_begin,
+                         size_t const count) noexcept
+{
+    assert(lhs_begin + count <= lhs.size());
+    assert(rhs_begin + count <= rhs.size());
+
+    bool equal{true};
+    detail::for_each_mismatch_chunk<detail::bitcompressed_letter_width<alphabet_t>>(
+        lhs.raw_data().data(), lhs_begin, rhs.raw_data().data(), rhs_begin, count,
+        [&equal] (uint64_t const chunk_mismatches)
+        {
+            equal = (chunk_mismatches == 0);
+            return equal;
+        });
+
+    return equal;
+}
+
+/*!\brief Copies the letters `[begin, end)` into a new packed sequence.
+ * \param[in] sequence The sequence.
+ * \param[in] begin    The position of the first letter.
+ * \param[in] end      The position behind the last letter.
+ * \returns A seqan3::bitcompressed_vector with the letters `sequence[begin, end)`.
+ *
+ * \details
+ *
+ * The letters are copied 64 bits at a time, shifted to the start of the new sequence.
+ *
+ * ### Complexity
+ *
+ * Linear in `end - begin`.
+ *
+ * ### Exceptions
+ *
+ * Throws std::bad_alloc if the new sequence cannot be allocated.
+ */
+template <semialphabet alphabet_t>
+inline bitcompressed_vector<alphabet_t> slice(bitcompressed_vector<alphabet_t> const & sequence,
+                                              size_t const begin,
+                                              size_t const end)
+{
+    assert(begin <= end && end <= sequence.size());
+
+    constexpr size_t width = detail::bitcompressed_letter_width<alphabet_t>;
+
+    bitcompressed_vector<alphabet_t> result{};
+    result.resize(end - begin);
+
+    uint64_t const * const words = sequence.raw_data().data();
+    uint64_t * result_words = result.raw_data().data();
+    size_t const bit_begin = begin * width;
+    size_t const bit_count = (end - begin) * width;
+
+    for (size_t bit = 0; bit < bit_count; bit += 64)
+        *result_words++ = detail::read_packed_bits(words, bit_begin + bit, std::min<size_t>(64, bit_count - bit));
+
+    return result;
+}
+
+/*!\brief Returns the `k` letters starting at `position` as a packed 64 bit word.
+ * \param[in] sequence The sequence.
+ * \param[in] position The position of the first letter of the k-mer.
+ * \param[in] k        The number of letters; `k * w` must be in `[1, 64]`, e.g. `k <= 32` for seqan3::dna4.
+ * \returns The packed letters; the first letter is stored in the lowest `w` bits, the remaining bits are 0.
+ *
+ * \details
+ *
+ * The value is the bit pattern of the letters in the seqan3::bitcompressed_vector. This is **not** the value
+ * computed by seqan3::views::kmer_hash, which stores the first letter in the highest bits, but it is equally
+ * suitable as a hash value or as a key of a direct-address table.
+ *
+ * ### Complexity
+ *
+ * Constant.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ */
+template <semialphabet alphabet_t>
+inline uint64_t packed_kmer(bitcompressed_vector<alphabet_t> const & sequence,
+                            size_t const position,
+                            size_t const k) noexcept
+{
+    constexpr size_t width = detail::bitcompressed_letter_width<alphabet_t>;
+
+    assert(k > 0 && k * width <= 64);
+    assert(position + k <= sequence.size());
+
+    return detail::read_packed_bits(sequence.raw_data().data(), position * width, k * width);
+}
+
+/*!\brief Returns all k-mers of the sequence as packed 64 bit words.
+ * \param[in] sequence The sequence.
+ * \param[in] k        The number of letters; `k * w` must be in `[1, 64]`, e.g. `k <= 32` for seqan3::dna4.
+ * \returns The `sequence.size() - k + 1` k-mers as computed by seqan3::packed_kmer, or no k-mer if the sequence is
+ *          shorter than `k`.
+ *
+ * \details
+ *
+ * ### Complexity
+ *
+ * Linear in the size of the sequence.
+ *
+ * ### Exceptions
+ *
+ * Throws std::bad_alloc if the result cannot be allocated.
+ */
+template <semialphabet alphabet_t>
+inline std::vector<uint64_t> packed_kmers(bitcompressed_vector<alphabet_t> const & sequence, size_t const k)
+{
+    constexpr size_t width = detail::bitcompressed_letter_width<alphabet_t>;
+
+    assert(k > 0 && k * width <= 64);
+
+    if (sequence.size() < k)
+        return {};
+
+    std::vector<uint64_t> kmers(sequence.size() - k + 1);
+    uint64_t const * const words = sequence.raw_data().data();
+
+    for (size_t position = 0; position < kmers.size(); ++position)
+        kmers[position] = detail::read_packed_bits(words, position * width, k * width);
+
+    return kmers;
+}
+//!\}
+
+} // namespace seqan3
@@ -0,0 +1,489 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::assign_chars_to, seqan3::assign_ranks_to and seqan3::reverse_complement for containers
+ *        over seqan3::dna4.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief The simd instruction set used by the seqan3::dna4 kernels.
+ * \ingroup container
+ *
+ * \details
+ *
+ * The kernels use at most AVX2, since the byte-wise comparisons of 64 byte vectors are not lowered to AVX-512
+ * instructions by the builtin simd vectors.
+ */
+inline simd_instruction_set dna4_kernel_instruction_set() noexcept
+{
+    return std::min(runtime_simd_instruction_set(), simd_instruction_set::avx2);
+}
+
+/*!\name Dna4 kernel helpers
+ * \brief Helpers of the seqan3::dna4 kernels; the simd vectors are passed by reference (see
+ *        seqan3::detail::invoke_simd_kernel).
+ * \ingroup container
+ * \{
+ */
+//!\brief Converts every lane from a character to the rank of the seqan3::dna4 letter it is converted to.
+template <typename simd_t>
+inline void dna4_char_to_rank(simd_t & vector) noexcept
+{
+    // same mapping as seqan3::dna4::assign_char: the IUPAC characters are converted to one of the bases they represent
+    simd_t const upper = vector & 0xDF;
+    simd_t const is_c = reinterpret_cast<simd_t>((upper == 'C') | (upper == 'Y') | (upper == 'S') | (upper == 'B'));
+    simd_t const is_g = reinterpret_cast<simd_t>((upper == 'G') | (upper == 'K'));
+    simd_t const is_t = reinterpret_cast<simd_t>((upper == 'T') | (upper == 'U'));
+
+    vector = (is_c & 1) | (is_g & 2) | (is_t & 3);
+}
+
+//!\brief Reverses the order of the lanes.
+template <typename simd_t>
+inline void reverse_lanes(simd_t & vector) noexcept
+{
+    constexpr size_t length = simd_traits<simd_t>::length;
+
+    simd_t reversed;
+    for (size_t lane = 0; lane < length; ++lane) // recognised as a byte shuffle by the compiler
+        reversed[lane] = vector[length - 1 - lane];
+
+    vector = reversed;
+}
+
+//!\brief Reverses the order of the four 2-bit letters within every byte and complements them.
+template <typename simd_t>
+inline void reverse_complement_letters_in_bytes(simd_t & vector) noexcept
+{
+    vector = ((vector >> 4) & 0x0F) | ((vector & 0x0F) << 4);
+    vector = ((vector >> 2) & 0x33) | ((vector & 0x33) << 2);
+    vector = ~vector;
+}
+
+//!\brief Reverses the order of the 32 letters within the word and complements them.
+inline void reverse_complement_letters(uint64_t & word) noexcept
+{
+    word = __builtin_bswap64(word);
+    word = ((word >> 4) & 0x0F0F0F0F'0F0F0F0FULL) | ((word & 0x0F0F0F0F'0F0F0F0FULL) << 4);
+    word = ((word >> 2) & 0x33333333'33333333ULL) | ((word & 0x33333333'33333333ULL) << 2);
+    word = ~word;
+}
+
+//!\brief Packs the ranks in the lowest 2 bits of eight bytes into the lowest 16 bits of the word.
+template <typename vector_t>
+inline void pack_ranks_of_bytes(vector_t & words) noexcept
+{
+    words = (words | (words >> 6)) & 0x000F000F'000F000FULL;
+    words = (words | (words >> 12)) & 0x000000FF'000000FFULL;
+    words = (words | (words >> 24)) & 0x00000000'0000FFFFULL;
+}
+
+//!\brief Packs up to 32 ranks into a word, the first rank is stored in the lowest bits.
+inline uint64_t pack_ranks(uint8_t const * const ranks, size_t const size) noexcept
+{
+    uint64_t word = 0;
+    for (size_t i = 0; i < size; ++i)
+        word |= static_cast<uint64_t>(ranks[i] & 3u) << (2 * i);
+
+    return word;
+}
+//!\}
+
+/*!\name Dna4 kernels
+ * \brief Bulk conversions of seqan3::dna4 sequences, invoked via seqan3::detail::invoke_simd_kernel.
+ * \ingroup container
+ * \tparam simd_t The simd vector type over uint8_t; the kernels fall back to scalar code for the generic instruction
+ *                set.
+ *
+ * \details
+ *
+ * Ranks are stored as one byte per letter, packed sequences as 32 letters per 64 bit word with the first letter in
+ * the lowest two bits (the layout of seqan3::bitcompressed_vector<seqan3::dna4>). The unused bits of the last word
+ * of a packed sequence are set to `0`.
+ * \{
+ */
+//!\brief Converts the characters to ranks.
+template <typename simd_t>
+inline void dna4_chars_to_ranks(char const * const chars, uint8_t * const ranks, size_t const size) noexcept
+{
+    constexpr size_t length = simd_traits<simd_t>::length;
+
+    size_t i = 0;
+    if constexpr (length > 1)
+    {
+        for (; i + length <= size; i += length)
+        {
+            simd_t vector;
+            std::memcpy(&vector, chars + i, sizeof(simd_t));
+            dna4_char_to_rank(vector);
+            std::memcpy(ranks + i, &vector, sizeof(simd_t));
+        }
+    }
+
+    for (; i < size; ++i)
+        ranks[i] = seqan3::to_rank(dna4{}.assign_char(chars[i]));
+}
+
+/*!\brief Converts the characters to ranks and packs them.
+ * \details If `chars` is `nullptr`, `ranks` are packed instead.
+ */
+template <typename simd_t>
+inline void dna4_pack(char const * const chars,
+                      uint8_t const * const ranks,
+                      uint64_t * const words,
+                      size_t const size) noexcept
+{
+    constexpr size_t length = simd_traits<simd_t>::length;
+
+    size_t i = 0;
+    if constexpr (length >= 8)
+    {
+        constexpr size_t vectors_per_word = std::max<size_t>(1, 32 / length);
+        constexpr size_t letters_per_step = vectors_per_word * length;
+        using word_vector_t = simd_type_t<uint64_t, length / 8>;
+
+        // every word lane holds eight letters after packing, i.e. 16 bits
+        for (; i + letters_per_step <= size; i += letters_per_step)
+        {
+            uint64_t packed[letters_per_step / 32]{};
+
+            for (size_t v = 0; v < vectors_per_word; ++v)
+            {
+                simd_t vector;
+                if (chars != nullptr)
+                {
+                    std::memcpy(&vector, chars + i + v * length, sizeof(simd_t));
+                    dna4_char_to_rank(vector);
+                }
+                else
+                {
+                    std::memcpy(&vector, ranks + i + v * length, sizeof(simd_t));
+                    vector &= 3;
+                }
+
+                word_vector_t lanes = reinterpret_cast<word_vector_t>(vector);
+                pack_ranks_of_bytes(lanes);
+
+                for (size_t lane = 0; lane < length / 8; ++lane)
+                {
+                    size_t const letter = v * length + lane * 8;
+                    packed[letter / 32] |= lanes[lane] << (2 * (letter % 32));
+                }
+            }
+
+            std::memcpy(words + i / 32, packed, letters_per_step / 4);
+        }
+    }
+
+    uint8_t buffer[32];
+    for (; i < size; i += 32)
+    {
+        size_t const count = std::min<size_t>(32, size - i);
+        if (chars != nullptr)
+            dna4_chars_to_ranks<simd_type_t<uint8_t, 1>>(chars + i, buffer, count);
+        else
+            std::memcpy(buffer, ranks + i, count);
+
+        words[i / 32] = pack_ranks(buffer, count);
+    }
+}
+
+//!\brief Reverses and complements the ranks in place.
+template <typename simd_t>
+inline void dna4_reverse_complement_ranks(uint8_t * const ranks, size_t const size) noexcept
+{
+    constexpr size_t length = simd_traits<simd_t>::length;
+
+    size_t front = 0;
+    size_t back = size;
+    if constexpr (length > 1)
+    {
+        for (; front + 2 * length <= back; front += length, back -= length)
+        {
+            simd_t front_vector;
+            simd_t back_vector;
+            std::memcpy(&front_vector, ranks + front, sizeof(simd_t));
+            std::memcpy(&back_vector, ranks + back - length, sizeof(simd_t));
+
+            reverse_lanes(front_vector);
+            reverse_lanes(back_vector);
+            front_vector ^= 3;
+            back_vector ^= 3;
+
+            std::memcpy(ranks + front, &back_vector, sizeof(simd_t));
+            std::memcpy(ranks + back - length, &front_vector, sizeof(simd_t));
+        }
+    }
+
+    for (; front + 1 < back; ++front, --back)
+    {
+        uint8_t const tmp = ranks[front] ^ 3;
+        ranks[front] = ranks[back - 1] ^ 3;
+        ranks[back - 1] = tmp;
+    }
+
+    if (front + 1 == back) // the middle letter
+        ranks[front] ^= 3;
+}
+
+//!\brief Reverses and complements the packed sequence of `size` letters in place.
+template <typename simd_t>
+inline void dna4_reverse_complement_packed(uint64_t * const words, size_t const size) noexcept
+{
+    constexpr size_t length = simd_traits<simd_t>::length;
+    size_t const word_count = (size + 31) / 32;
+
+    // 1. Reverse the order of the words and the order of the letters within the words. A reversed byte order reverses
+    //    the order of the words within a vector and the order of the bytes within a word.
+    size_t front = 0;
+    size_t back = word_count;
+    if constexpr (length >= 8)
+    {
+        constexpr size_t words_per_vector = length / 8;
+
+        for (; front + 2 * words_per_vector <= back; front += words_per_vector, back -= words_per_vector)
+        {
+            simd_t front_vector;
+            simd_t back_vector;
+            std::memcpy(&front_vector, words + front, sizeof(simd_t));
+            std::memcpy(&back_vector, words + back - words_per_vector, sizeof(simd_t));
+
+            reverse_lanes(front_vector);
+            reverse_lanes(back_vector);
+            reverse_complement_letters_in_bytes(front_vector);
+            reverse_complement_letters_in_bytes(back_vector);
+
+            std::memcpy(words + front, &back_vector, sizeof(simd_t));
+            std::memcpy(words + back - words_per_vector, &front_vector, sizeof(simd_t));
+        }
+    }
+
+    for (; front + 1 < back; ++front, --back)
+    {
+        uint64_t front_word = words[front];
+        uint64_t back_word = words[back - 1];
+        reverse_complement_letters(front_word);
+        reverse_complement_letters(back_word);
+        words[front] = back_word;
+        words[back - 1] = front_word;
+    }
+
+    if (front + 1 == back) // the middle word
+        reverse_complement_letters(words[front]);
+
+    // 2. The unused letters of the last word are now at the beginning: shift them out.
+    size_t const shift = 2 * (word_count * 32 - size);
+    if (shift == 0)
+        return;
+
+    size_t i = 0;
+    if constexpr (length >= 8)
+    {
+        using word_vector_t = simd_type_t<uint64_t, length / 8>;
+        constexpr size_t words_per_vector = length / 8;
+
+        for (; i + words_per_vector < word_count; i += words_per_vector) // reads one word beyond the vector
+        {
+            word_vector_t current;
+            word_vector_t next;
+            std::memcpy(&current, words + i, sizeof(word_vector_t));
+            std::memcpy(&next, words + i + 1, sizeof(word_vector_t));
+
+            current = (current >> shift) | (next << (64 - shift));
+            std::memcpy(words + i, &current, sizeof(word_vector_t));
+        }
+    }
+
+    for (; i + 1 < word_count; ++i)
+        words[i] = (words[i] >> shift) | (words[i + 1] << (64 - shift));
+
+    words[word_count - 1] >>= shift;
+}
+//!\}
+
+//!\brief Returns the ranks of a contiguous range over seqan3::dna4.
+template <typename rng_t>
+inline auto dna4_rank_data(rng_t && range) noexcept
+{
+    static_assert(sizeof(dna4) == 1 && std::is_trivially_copyable_v<dna4>,
+                  "The dna4 kernels require that seqan3::dna4 is represented by its rank.");
+
+    using value_t = std::remove_reference_t<std::ranges::range_reference_t<rng_t>>;
+    using rank_ptr_t = std::conditional_t<std::is_const_v<value_t>, uint8_t const *, uint8_t *>;
+    return reinterpret_cast<rank_ptr_t>(std::ranges::data(range));
+}
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\name Bulk operations on seqan3::dna4 containers
+ * \brief Convert and reverse-complement whole seqan3::dna4 sequences with simd instructions.
+ * \ingroup container
+ *
+ * \details
+ *
+ * These functions have the same result as their element-wise counterparts, e.g. seqan3::views::char_to and
+ * seqan3::views::complement, but process 16 or 32 letters per instruction using the widest simd instruction set
+ * supported by the executing CPU (see seqan3::detail::invoke_simd_kernel). The packed seqan3::bitcompressed_vector is
+ * processed word-wise without going through its proxy reference.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/container/dna4_operations.cpp
+ * \{
+ */
+
+/*!\brief Assigns the characters to the sequence, converting them like seqan3::dna4::assign_char.
+ * \param[in]  chars    The characters.
+ * \param[out] sequence The sequence; it is resized to the number of characters.
+ *
+ * \details
+ *
+ * ### Complexity
+ *
+ * Linear in the number of characters.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee (no data is modified in case an exception is thrown).
+ */
+inline void assign_chars_to(std::string_view const chars, std::vector<dna4> & sequence)
+{
+    sequence.resize(chars.size());
+
+    detail::invoke_simd_kernel<uint8_t>([&] (auto simd_type)
+    {
+        using simd_t = typename decltype(simd_type)::type;
+        detail::dna4_chars_to_ranks<simd_t>(chars.data(), detail::dna4_rank_data(sequence), chars.size());
+    }, detail::dna4_kernel_instruction_set());
+}
+
+//!\copydoc seqan3::assign_chars_to(std::string_view const, std::vector<dna4> &)
+inline void assign_chars_to(std::string_view const chars, bitcompressed_vector<dna4> & sequence)
+{
+    sequence.resize(chars.size());
+
+    detail::invoke_simd_kernel<uint8_t>([&] (auto simd_type)
+    {
+        using simd_t = typename decltype(simd_type)::type;
+        detail::dna4_pack<simd_t>(chars.data(), nullptr, sequence.raw_data().data(), chars.size());
+    }, detail::dna4_kernel_instruction_set());
+}
+
+/*!\brief Assigns the letters of a contiguous seqan3::dna4 range to the packed sequence.
+ * \tparam rng_t The type of the range; must model std::ranges::contiguous_range and std::ranges::sized_range over
+ *               seqan3::dna4.
+ * \param[in]  range    The letters.
+ * \param[out] sequence The packed sequence; it is resized to the size of the range.
+ *
+ * \details
+ *
+ * ### Complexity
+ *
+ * Linear in the size of the range.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee (no data is modified in case an exception is thrown).
+ */
+template <std::ranges::contiguous_range rng_t>
+//!\cond
+    requires std::ranges::sized_range<rng_t> &&
+             std::same_as<std::remove_cvref_t<std::ranges::range_reference_t<rng_t>>, dna4>
+//!\endcond
+inline void assign_ranks_to(rng_t && range, bitcompressed_vector<dna4> & sequence)
+{
+    size_t const size = std::ranges::size(range);
+    sequence.resize(size);
+
+    detail::invoke_simd_kernel<uint8_t>([&] (auto simd_type)
+    {
+        using simd_t = typename decltype(simd_type)::type;
+        detail::dna4_pack<simd_t>(nullptr, detail::dna4_rank_data(range), sequence.raw_data().data(), size);
+    }, detail::dna4_kernel_instruction_set());
+}
+
+/*!\brief Reverses and complements the contiguous seqan3::dna4 sequence in place.
+ * \tparam rng_t The type of the sequence; must model std::ranges::contiguous_range and std::ranges::sized_range over
+ *               (non-const) seqan3::dna4.
+ * \param[in,out] sequence The sequence.
+ *
+ * \details
+ *
+ * The result is the same as `sequence | std::views::reverse | seqan3::views::complement`.
+ *
+ * ### Complexity
+ *
+ * Linear in the size of the sequence.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ */
+template <std::ranges::contiguous_range rng_t>
+//!\cond
+    requires std::ranges::sized_range<rng_t> &&
+             std::same_as<std::ranges::range_reference_t<rng_t>, dna4 &>
+//!\endcond
+inline void reverse_complement(rng_t && sequence) noexcept
+{
+    detail::invoke_simd_kernel<uint8_t>([&] (auto simd_type)
+    {
+        using simd_t = typename decltype(simd_type)::type;
+        detail::dna4_reverse_complement_ranks<simd_t>(detail::dna4_rank_data(sequence), std::ranges::size(sequence));
+    }, detail::dna4_kernel_instruction_set());
+}
+
+/*!\brief Reverses and complements the packed sequence in place.
+ * \param[in,out] sequence The sequence.
+ *
+ * \details
+ *
+ * The letters are reversed and complemented 32 at a time within the 64 bit words of the sequence.
+ *
+ * ### Complexity
+ *
+ * Linear in the size of the sequence.
+ *
+ * ### Exceptions
+ *
+ * No-throw guarantee.
+ */
+inline void reverse_complement(bitcompressed_vector<dna4> & sequence) noexcept
+{
+    if (sequence.empty())
+        return;
+
+    detail::invoke_simd_kernel<uint8_t>([&] (auto simd_type)
+    {
+        using simd_t = typename decltype(simd_type)::type;
+        detail::dna4_reverse_complement_packed<simd_t>(sequence.raw_data().data(), sequence.size());
+    }, detail::dna4_kernel_instruction_set());
+}
+//!\}
+
+} // namespace seqan3
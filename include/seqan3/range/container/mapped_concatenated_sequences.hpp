@@ -0,0 +1,605 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::mapped_concatenated_sequences and seqan3::write_mapped_sequences.
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if __has_include(<fcntl.h>) && __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && \
+    __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define SEQAN3_HAS_MMAP 1
+#endif
+
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/io/exception.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/bitcompressed_vector_operations.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/detail/random_access_iterator.hpp>
+#include <seqan3/std/concepts>
+#include <seqan3/std/filesystem>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief The header of a file written by seqan3::write_mapped_sequences.
+ * \ingroup container
+ *
+ * \details
+ *
+ * The header is followed by `sequence_count + 1` delimiters and the packed letters, all stored as 64 bit words in the
+ * byte order of the writing machine:
+ *
+ * | Bytes                      | Content                                                                  |
+ * |----------------------------|--------------------------------------------------------------------------|
+ * | `[0, 56)`                  | the header                                                               |
+ * | `56 + 8 * [0, n + 1)`      | the begin positions of the `n` sequences and the total number of letters |
+ * | following                  | the letters, packed like in seqan3::bitcompressed_vector                 |
+ */
+struct mapped_sequences_header
+{
+    //!\brief Identifies the file format.
+    std::array<char, 8> magic{'S', 'E', 'Q', 'A', 'N', '3', 'C', 'S'};
+    //!\brief A fixed value, which reads differently on a machine with another byte order.
+    uint64_t byte_order{0x0102'0304'0506'0708ULL};
+    //!\brief The version of the file format.
+    uint64_t version{1};
+    //!\brief The number of bits per letter.
+    uint64_t bits_per_letter{};
+    //!\brief The size of the alphabet.
+    uint64_t alphabet_size{};
+    //!\brief The number of sequences.
+    uint64_t sequence_count{};
+    //!\brief The number of letters of all sequences.
+    uint64_t letter_count{};
+
+    //!\brief The number of 64 bit words that store the packed letters.
+    constexpr uint64_t word_count() const noexcept
+    {
+        return (letter_count * bits_per_letter + 63) / 64;
+    }
+};
+
+static_assert(sizeof(mapped_sequences_header) == 56);
+static_assert(std::is_trivially_copyable_v<mapped_sequences_header>);
+
+/*!\brief The read-only content of a file; memory-mapped if the system supports it, read into memory otherwise.
+ * \ingroup container
+ */
+class mapped_file
+{
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_file() = default;                                  //!< Defaulted.
+    mapped_file(mapped_file const &) = delete;                //!< Deleted, the mapping is owned.
+    mapped_file(mapped_file &&) = delete;                     //!< Deleted, the mapping is owned.
+    mapped_file & operator=(mapped_file const &) = delete;    //!< Deleted, the mapping is owned.
+    mapped_file & operator=(mapped_file &&) = delete;         //!< Deleted, the mapping is owned.
+
+    //!\brief Unmaps the file.
+    ~mapped_file()
+    {
+#ifdef SEQAN3_HAS_MMAP
+        if (mapping != nullptr)
+            ::munmap(mapping, mapping_size);
+#endif
+    }
+
+    /*!\brief Maps the file read-only.
+     * \param[in] path The path of the file.
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     */
+    explicit mapped_file(std::filesystem::path const & path)
+    {
+#ifdef SEQAN3_HAS_MMAP
+        int const fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+        struct stat status{};
+        if (::fstat(fd, &status) != 0 || status.st_size == 0)
+        {
+            ::close(fd);
+            throw file_open_error{"Could not determine the size of " + path.string() + " or the file is empty."};
+        }
+
+        mapping_size = static_cast<size_t>(status.st_size);
+        // The pages are shared with all processes that map the same file, so the content is held in memory once.
+        void * const result = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (result == MAP_FAILED)
+            throw file_open_error{"Could not memory-map file " + path.string() + "."};
+
+        mapping = result;
+        bytes = static_cast<char const *>(mapping);
+#else
+        std::ifstream stream{path, std::ios::binary | std::ios::ate};
+        if (!stream.is_open())
+            throw file_open_error{"Could not open file " + path.string() + " for reading."};
+
+        mapping_size = static_cast<size_t>(stream.tellg());
+        buffer.resize((mapping_size + 7) / 8); // 64 bit words, so the words of the file are aligned
+        stream.seekg(0);
+
+        if (!stream.read(reinterpret_cast<char *>(buffer.data()), mapping_size))
+            throw file_open_error{"Could not read file " + path.string() + "."};
+
+        bytes = reinterpret_cast<char const *>(buffer.data());
+#endif
+    }
+    //!\}
+
+    //!\brief The content of the file; aligned to 64 bit.
+    char const * data() const noexcept
+    {
+        return bytes;
+    }
+
+    //!\brief The size of the file in bytes.
+    size_t size() const noexcept
+    {
+        return mapping_size;
+    }
+
+private:
+    //!\brief The content of the file.
+    char const * bytes{nullptr};
+    //!\brief The size of the file in bytes.
+    size_t mapping_size{};
+#ifdef SEQAN3_HAS_MMAP
+    //!\brief The memory mapping.
+    void * mapping{nullptr};
+#else
+    //!\brief The content of the file, if memory mapping is not supported.
+    std::vector<uint64_t> buffer{};
+#endif
+};
+
+/*!\brief The validated content of a file written by seqan3::write_mapped_sequences; accesses the letters by position.
+ * \ingroup container
+ * \tparam alphabet_t The alphabet of the sequences.
+ *
+ * \details
+ *
+ * This is the host of the letter iterators of seqan3::mapped_concatenated_sequences; the iterators stay valid as long
+ * as any seqan3::mapped_concatenated_sequences shares the storage.
+ */
+template <semialphabet alphabet_t>
+class mapped_sequences_storage
+{
+public:
+    /*!\name Member types
+     * \{
+     */
+    using value_type = alphabet_t;             //!< The alphabet.
+    using reference = alphabet_t;              //!< Letters are returned by value.
+    using const_reference = alphabet_t;        //!< Letters are returned by value.
+    using difference_type = std::ptrdiff_t;    //!< A signed integer type.
+    using size_type = size_t;                  //!< An unsigned integer type.
+    //!\}
+
+    /*!\brief Maps the file and validates its header and delimiters.
+     * \param[in] path The path of the file.
+     * \throws seqan3::file_open_error if the file cannot be opened.
+     * \throws seqan3::parse_error if the file was not written by seqan3::write_mapped_sequences for `alphabet_t`.
+     */
+    explicit mapped_sequences_storage(std::filesystem::path const & path) : file{path}
+    {
+        if (file.size() < sizeof(mapped_sequences_header))
+            throw parse_error{path.string() + " is too small to be a file written by seqan3::write_mapped_sequences."};
+
+        std::memcpy(&header, file.data(), sizeof(header));
+
+        mapped_sequences_header const expected{};
+        if (header.magic != expected.magic)
+            throw parse_error{path.string() + " was not written by seqan3::write_mapped_sequences."};
+        if (header.byte_order != expected.byte_order)
+            throw parse_error{path.string() + " was written on a machine with a different byte order."};
+        if (header.version != expected.version)
+            throw parse_error{path.string() + " has the unsupported format version " + std::to_string(header.version)
+                              + "."};
+        if (header.bits_per_letter != width || header.alphabet_size != seqan3::alphabet_size<alphabet_t>)
+            throw parse_error{path.string() + " stores the sequences of a different alphabet."};
+
+        size_t const word_capacity = (file.size() - sizeof(mapped_sequences_header)) / 8;
+        if (header.sequence_count >= word_capacity ||
+            header.letter_count > file.size() * 8 || // every letter occupies at least one bit
+            sizeof(mapped_sequences_header) + 8 * (header.sequence_count + 1 + header.word_count()) != file.size())
+        {
+            throw parse_error{path.string() + " is truncated or has trailing data."};
+        }
+
+        delimiters = reinterpret_cast<uint64_t const *>(file.data() + sizeof(mapped_sequences_header));
+        words = delimiters + header.sequence_count + 1;
+
+        // The delimiters are checked once, such that no corrupted file leads to an access outside of the mapping.
+        if (delimiters[0] != 0 || delimiters[header.sequence_count] != header.letter_count)
+            throw parse_error{path.string() + " has invalid sequence delimiters."};
+
+        for (size_t i = 0; i < header.sequence_count; ++i)
+            if (delimiters[i] > delimiters[i + 1])
+                throw parse_error{path.string() + " has invalid sequence delimiters."};
+    }
+
+    //!\brief Returns the letter at the given position of the concatenation of all sequences.
+    alphabet_t operator[](size_type const position) const noexcept
+    {
+        assert(position < header.letter_count);
+
+        uint64_t const rank = read_packed_bits(words, position * width, width);
+        return assign_rank_to(static_cast<alphabet_rank_t<alphabet_t>>(rank), alphabet_t{});
+    }
+
+    //!\brief The number of sequences.
+    size_type sequence_count() const noexcept
+    {
+        return header.sequence_count;
+    }
+
+    //!\brief The number of letters of all sequences.
+    size_type letter_count() const noexcept
+    {
+        return header.letter_count;
+    }
+
+    //!\brief The begin position of sequence `i`; the end position if `i` is the number of sequences.
+    size_type delimiter(size_type const i) const noexcept
+    {
+        assert(i <= header.sequence_count);
+        return delimiters[i];
+    }
+
+private:
+    //!\brief The number of bits per letter.
+    static constexpr size_t width = bitcompressed_letter_width<alphabet_t>;
+
+    //!\brief The content of the file.
+    mapped_file file;
+    //!\brief A copy of the header.
+    mapped_sequences_header header{};
+    //!\brief The delimiters inside of the file.
+    uint64_t const * delimiters{nullptr};
+    //!\brief The packed letters inside of the file.
+    uint64_t const * words{nullptr};
+};
+
+} // namespace seqan3::detail
+
+namespace seqan3
+{
+
+/*!\brief A read-only, memory-mapped collection of sequences that were written by seqan3::write_mapped_sequences.
+ * \ingroup container
+ * \implements std::ranges::random_access_range
+ * \implements std::ranges::sized_range
+ * \tparam alphabet_t The alphabet of the sequences; must model seqan3::semialphabet.
+ *
+ * \details
+ *
+ * seqan3::concatenated_sequences has to be rebuilt, e.g. parsed from a FASTA file, every time a program starts.
+ * This class instead maps a binary file read-only into memory: opening takes constant time (plus a check of the
+ * sequence delimiters), the letters are only read from disk when they are accessed and the operating system shares
+ * the pages between all processes that map the same file. The letters are stored packed like in
+ * seqan3::bitcompressed_vector, e.g. four seqan3::dna4 letters per byte.
+ *
+ * The sequences are sized random access views over `alphabet_t` that return their letters by value. They stay valid
+ * as long as a copy of the seqan3::mapped_concatenated_sequences exists, even if the object they were obtained from
+ * has been destroyed; copies share the mapping.
+ *
+ * The file stores 64 bit words in the byte order of the machine that wrote it. Files cannot be exchanged between
+ * machines with different byte orders; opening such a file throws seqan3::parse_error.
+ *
+ * ### Example
+ *
+ * \include test/snippet/range/container/mapped_concatenated_sequences.cpp
+ */
+template <semialphabet alphabet_t>
+class mapped_concatenated_sequences
+{
+private:
+    //!\brief The type of the storage.
+    using storage_type = detail::mapped_sequences_storage<alphabet_t>;
+    //!\brief The iterator over the letters of a sequence.
+    using letter_iterator = detail::random_access_iterator<storage_type const>;
+
+public:
+    /*!\name Member types
+     * \{
+     */
+    //!\brief A sequence: a sized random access view over the letters.
+    using value_type = std::ranges::subrange<letter_iterator, letter_iterator>;
+    //!\brief The sequences are returned by value.
+    using reference = value_type;
+    //!\brief The sequences are returned by value.
+    using const_reference = value_type;
+    //!\brief The iterator type.
+    using iterator = detail::random_access_iterator<mapped_concatenated_sequences const>;
+    //!\brief The const iterator type; the same as the iterator type.
+    using const_iterator = iterator;
+    //!\brief A signed integer type.
+    using difference_type = std::ptrdiff_t;
+    //!\brief An unsigned integer type.
+    using size_type = size_t;
+    //!\}
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    mapped_concatenated_sequences() = default;                                                  //!< Defaulted.
+    mapped_concatenated_sequences(mapped_concatenated_sequences const &) = default;             //!< Defaulted.
+    mapped_concatenated_sequences(mapped_concatenated_sequences &&) = default;                  //!< Defaulted.
+    mapped_concatenated_sequences & operator=(mapped_concatenated_sequences const &) = default; //!< Defaulted.
+    mapped_concatenated_sequences & operator=(mapped_concatenated_sequences &&) = default;      //!< Defaulted.
+    ~mapped_concatenated_sequences() = default;                                                 //!< Defaulted.
+
+    /*!\brief Maps a file written by seqan3::write_mapped_sequences.
+     * \param[in] path The path of the file.
+     * \throws seqan3::file_open_error if the file cannot be opened or mapped.
+     * \throws seqan3::parse_error if the file was not written by seqan3::write_mapped_sequences for `alphabet_t`.
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Linear in the number of sequences, independent of the number of letters.
+     */
+    explicit mapped_concatenated_sequences(std::filesystem::path const & path) :
+        storage{std::make_shared<storage_type const>(path)}
+    {}
+    //!\}
+
+    /*!\name Iterators
+     * \{
+     */
+    //!\brief Returns an iterator to the first sequence.
+    iterator begin() const noexcept
+    {
+        return iterator{*this};
+    }
+
+    //!\copydoc begin()
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    //!\brief Returns an iterator behind the last sequence.
+    iterator end() const noexcept
+    {
+        return iterator{*this, size()};
+    }
+
+    //!\copydoc end()
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+    //!\}
+
+    /*!\name Element access
+     * \{
+     */
+    /*!\brief Returns the i-th sequence.
+     * \param[in] i The index of the sequence; must be smaller than size().
+     *
+     * \details
+     *
+     * ### Complexity
+     *
+     * Constant.
+     *
+     * ### Exceptions
+     *
+     * No-throw guarantee.
+     */
+    reference operator[](size_type const i) const noexcept
+    {
+        assert(i < size());
+        return {letter_iterator{*storage, storage->delimiter(i)}, letter_iterator{*storage, storage->delimiter(i + 1)}};
+    }
+
+    /*!\brief Returns the i-th sequence, with bounds checking.
+     * \param[in] i The index of the sequence.
+     * \throws std::out_of_range if `i` is not smaller than size().
+     */
+    reference at(size_type const i) const
+    {
+        if (i >= size())
+            throw std::out_of_range{"Trying to access element behind the last in mapped_concatenated_sequences."};
+        return (*this)[i];
+    }
+
+    //!\brief Returns the first sequence; the collection must not be empty.
+    reference front() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[0];
+    }
+
+    //!\brief Returns the last sequence; the collection must not be empty.
+    reference back() const noexcept
+    {
+        assert(size() > 0);
+        return (*this)[size() - 1];
+    }
+    //!\}
+
+    /*!\name Capacity
+     * \{
+     */
+    //!\brief The number of sequences.
+    size_type size() const noexcept
+    {
+        return (storage == nullptr) ? 0 : storage->sequence_count();
+    }
+
+    //!\brief Whether there are no sequences.
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    //!\brief The number of letters of all sequences.
+    size_type concat_size() const noexcept
+    {
+        return (storage == nullptr) ? 0 : storage->letter_count();
+    }
+    //!\}
+
+private:
+    //!\brief The mapped file; shared by all copies.
+    std::shared_ptr<storage_type const> storage{};
+};
+
+/*!\brief Writes sequences to a file that can be memory-mapped by seqan3::mapped_concatenated_sequences.
+ * \ingroup container
+ * \tparam sequences_t The type of the sequences; must model std::ranges::forward_range over std::ranges::forward_range
+ *                     over a seqan3::semialphabet.
+ * \param[in] path      The path of the file; an existing file is replaced.
+ * \param[in] sequences The sequences, e.g. a seqan3::concatenated_sequences or a `std::vector<std::vector<dna4>>`.
+ * \throws seqan3::file_open_error if the file cannot be opened for writing or cannot be replaced.
+ * \throws seqan3::io_error if writing the file fails.
+ *
+ * \details
+ *
+ * The packed words of a seqan3::concatenated_sequences over seqan3::bitcompressed_vector are written as they are;
+ * all other sequences are packed while writing. See seqan3::detail::mapped_sequences_header for the file layout.
+ *
+ * The file is written to `path` with the suffix `.tmp` appended and then renamed to `path`. Processes that have
+ * mapped the previous file keep reading the previous content, which allows replacing a file that is in use; this
+ * includes writing a seqan3::mapped_concatenated_sequences back to the file it was mapped from.
+ *
+ * ### Complexity
+ *
+ * Linear in the number of letters.
+ */
+template <std::ranges::forward_range sequences_t>
+//!\cond
+    requires std::ranges::forward_range<std::ranges::range_reference_t<sequences_t>> &&
+             semialphabet<std::ranges::range_value_t<std::ranges::range_reference_t<sequences_t>>>
+//!\endcond
+void write_mapped_sequences(std::filesystem::path const & path, sequences_t && sequences)
+{
+    using alphabet_t = std::ranges::range_value_t<std::ranges::range_reference_t<sequences_t>>;
+    constexpr size_t width = detail::bitcompressed_letter_width<alphabet_t>;
+
+    std::filesystem::path temporary_path{path};
+    temporary_path += ".tmp";
+
+    std::ofstream stream{temporary_path, std::ios::binary | std::ios::trunc};
+    if (!stream.is_open())
+        throw file_open_error{"Could not open file " + temporary_path.string() + " for writing."};
+
+    auto remove_and_throw = [&] ()
+    {
+        stream.close();
+        std::error_code ignored{};
+        std::filesystem::remove(temporary_path, ignored);
+        throw io_error{"Could not write to file " + temporary_path.string() + "."};
+    };
+
+    auto write_bytes = [&] (void const * const data, size_t const count)
+    {
+        if (!stream.write(static_cast<char const *>(data), count))
+            remove_and_throw();
+    };
+
+    std::vector<uint64_t> delimiters{0};
+    for (auto && sequence : sequences)
+        delimiters.push_back(delimiters.back() + static_cast<uint64_t>(std::ranges::distance(sequence)));
+
+    detail::mapped_sequences_header header{};
+    header.bits_per_letter = width;
+    header.alphabet_size = alphabet_size<alphabet_t>;
+    header.sequence_count = delimiters.size() - 1;
+    header.letter_count = delimiters.back();
+
+    write_bytes(&header, sizeof(header));
+    write_bytes(delimiters.data(), delimiters.size() * sizeof(uint64_t));
+
+    if constexpr (std::same_as<remove_cvref_t<sequences_t>, concatenated_sequences<bitcompressed_vector<alphabet_t>>>)
+    {
+        // the letters are already packed; the unused bits of the last word are cleared
+        if (header.word_count() > 0)
+        {
+            uint64_t const * const words = sequences.raw_data().first.raw_data().data();
+            size_t const last = header.word_count() - 1;
+            uint64_t const last_word = words[last] & detail::lowest_bits_mask(header.letter_count * width - last * 64);
+
+            write_bytes(words, last * sizeof(uint64_t));
+            write_bytes(&last_word, sizeof(uint64_t));
+        }
+    }
+    else
+    {
+        std::vector<uint64_t> buffer{};
+        buffer.reserve(1 << 16);
+
+        uint64_t word{};
+        size_t offset{};
+        for (auto && sequence : sequences)
+        {
+            for (auto && letter : sequence)
+            {
+                uint64_t const rank = seqan3::to_rank(letter);
+                word |= rank << offset;
+                offset += width;
+
+                if (offset >= 64) // the word is full; the bits of the rank that did not fit start the next word
+                {
+                    buffer.push_back(word);
+                    offset -= 64;
+                    word = (offset == 0) ? 0 : rank >> (width - offset);
+
+                    if (buffer.size() == buffer.capacity())
+                    {
+                        write_bytes(buffer.data(), buffer.size() * sizeof(uint64_t));
+                        buffer.clear();
+                    }
+                }
+            }
+        }
+
+        if (offset > 0)
+            buffer.push_back(word);
+
+        write_bytes(buffer.data(), buffer.size() * sizeof(uint64_t));
+    }
+
+    stream.close();
+    if (stream.fail())
+        remove_and_throw();
+
+    std::error_code error{};
+    std::filesystem::rename(temporary_path, path, error);
+    if (error)
+    {
+        std::filesystem::remove(temporary_path, error);
+        throw file_open_error{"Could not replace file " + path.string() + "."};
+    }
+}
+
+} // namespace seqan3
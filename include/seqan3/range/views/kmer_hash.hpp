@@ -12,7 +12,10 @@
 
 #pragma once
 
+#include <array>
+
 #include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
 #include <seqan3/core/math.hpp>
 #include <seqan3/range/hash.hpp>
 #include <seqan3/search/kmer_index/shape.hpp>
@@ -212,6 +215,13 @@ public:
  * To avoid dereferencing the sentinel when iterating, the shape_iterator computes the hash value up until
  * the second to last position and performs the addition of the last position upon
  * access (\ref operator* and \ref operator[]).
+ *
+ * Ungapped shapes are hashed with a rolling hash. For gapped shapes, the ranks of the current k-mer are additionally
+ * kept in a packed window of \f$\lceil\log_2\sigma\rceil\f$ bits per position, if the window fits into 64 bits.
+ * If the alphabet size is a power of two, the hash value is extracted from the window with a single bit extraction
+ * (seqan3::detail::extract_bits). Otherwise, the hash value is updated with a rolling hash per block of consecutive
+ * `1`s in the shape, reading the leaving and entering ranks from the window. In both cases, an increment does not
+ * depend on the size of the shape. Larger gapped shapes fall back to recomputing the hash value.
  */
 template <std::ranges::view urng_t>
 template <typename rng_t>
@@ -264,6 +274,8 @@ public:
     shape_iterator(shape_iterator<urng2_t> it) :
         hash_value{std::move(it.hash_value)},
         roll_factor{std::move(it.roll_factor)},
+        window{std::move(it.window)},
+        gapped_mask{std::move(it.gapped_mask)},
         shape_{std::move(it.shape_)},
         text_left{std::move(it.text_left)},
         text_right{std::move(it.text_right)}
@@ -284,6 +296,23 @@ public:
     {
         assert(std::ranges::size(shape_) > 0);
 
+        if (!shape_.all() && shape_.size() * bits_per_rank <= 64u)
+        {
+            // The last position always contributes to the hash value, see hash_full().
+            uint64_t const positions = shape_.to_ullong() | (1ULL << (shape_.size() - 1));
+
+            if constexpr (is_power_of_two(sigma))
+            {
+                for (size_t i{0}; i < shape_.size(); ++i)
+                    if ((positions >> i) & 1u)
+                        gapped_mask |= rank_mask << (bits_per_rank * (shape_.size() - 1 - i));
+            }
+            else
+            {
+                gapped_mask = positions;
+            }
+        }
+
         if (shape_.size() <= std::ranges::distance(text_left, text_right))
         {
             roll_factor = pow(sigma, static_cast<size_t>(std::ranges::size(shape_) - 1));
@@ -528,12 +557,44 @@ private:
     //!\brief The alphabet size.
     static constexpr auto const sigma{alphabet_size<alphabet_t>};
 
+    //!\brief The number of bits needed to store a rank in the packed window.
+    static constexpr size_t bits_per_rank{sigma > 1 ? most_significant_bit_set<size_t>(sigma - 1) + 1 : 1};
+
+    //!\brief Masks a single rank in the packed window.
+    static constexpr uint64_t rank_mask{(1ULL << bits_per_rank) - 1};
+
+    //!\brief The powers of sigma (modulo \f$2^{64}\f$) used for rolling gapped shapes.
+    static constexpr std::array<size_t, 65> sigma_powers = [] () constexpr
+    {
+        std::array<size_t, 65> powers{};
+        powers[0] = 1;
+
+        for (size_t i = 1; i < powers.size(); ++i)
+            powers[i] = powers[i - 1] * sigma;
+
+        return powers;
+    }();
+
     //!\brief The hash value.
     size_t hash_value{0};
 
     //!\brief The factor for the left most position of the hash value.
     size_t roll_factor{0};
 
+    //!\brief The packed ranks of all but the last position of the k-mer; the rank of `text_left` is the most
+    //!       significant.
+    uint64_t window{0};
+
+    /*!\brief Describes the hashed positions of a gapped shape for hash_gapped_forward().
+     *
+     * \details
+     *
+     * If the alphabet size is a power of two, the bits of the packed window (including the last position) that
+     * form the hash value. Otherwise, the bit `i` is set if the `i`-th position of the shape is hashed.
+     * `0` if the shape is ungapped or the packed window does not fit into 64 bits.
+     */
+    uint64_t gapped_mask{0};
+
     //!\brief The shape to use.
     shape shape_;
 
@@ -550,6 +611,10 @@ private:
         {
             hash_roll_forward();
         }
+        else if (gapped_mask != 0)
+        {
+            hash_gapped_forward();
+        }
         else
         {
             std::ranges::advance(text_left,  1);
@@ -604,15 +669,75 @@ private:
     {
         text_right = text_left;
         hash_value = 0;
+        window = 0;
 
         for (size_t i{0}; i < shape_.size() - 1u; ++i)
         {
-            hash_value += shape_[i] * to_rank(*text_right);
+            size_t const rank = to_rank(*text_right);
+            hash_value += shape_[i] * rank;
             hash_value *= shape_[i] ? sigma : 1;
+            window = (window << bits_per_rank) | rank;
             std::ranges::advance(text_right, 1);
         }
     }
 
+    /*!\brief Calculates the next hash value of a gapped shape from the packed window.
+     *
+     * \details
+     *
+     * Only called if #gapped_mask is not `0`, i.e. the ranks of all positions of the shape fit into the window.
+     */
+    void hash_gapped_forward()
+    {
+        size_t const size = shape_.size();
+        size_t const last_rank = to_rank(*text_right);
+        // The ranks of the current k-mer including the last position.
+        uint64_t const full_window = (window << bits_per_rank) | last_rank;
+
+        window = full_window & ((1ULL << (bits_per_rank * (size - 1))) - 1);
+
+        if constexpr (is_power_of_two(sigma))
+        {
+            // The ranks are the digits of the hash value, the last position of the next k-mer is added on access.
+            hash_value = extract_bits(window << bits_per_rank, gapped_mask);
+        }
+        else
+        {
+            auto rank_at = [&] (size_t const position)
+            {
+                return (full_window >> (bits_per_rank * (size - 1 - position))) & rank_mask;
+            };
+
+            // Every block of consecutive 1s is an ungapped k-mer that is rolled by one position: the rank at its
+            // first position leaves, the rank following its last position enters.
+            size_t next_hash = (hash_value + last_rank) * sigma;
+            size_t const weight = popcount(gapped_mask);
+            size_t hashed_positions{0};
+
+            for (uint64_t remaining = gapped_mask; remaining != 0;)
+            {
+                uint64_t const lowest_bit = remaining & (~remaining + 1);
+                uint64_t const block = remaining & ~(remaining + lowest_bit);
+                size_t const first = count_trailing_zeros(lowest_bit);
+                size_t const length = popcount(block);
+                hashed_positions += length;
+                size_t const hashed_after = weight - hashed_positions;
+
+                next_hash -= rank_at(first) * sigma_powers[hashed_after + length];
+
+                if (first + length < size) // The last position of the next k-mer is added on access.
+                    next_hash += rank_at(first + length) * sigma_powers[hashed_after];
+
+                remaining ^= block;
+            }
+
+            hash_value = next_hash;
+        }
+
+        std::ranges::advance(text_left,  1);
+        std::ranges::advance(text_right, 1);
+    }
+
     //!\brief Calculates the next hash value via rolling hash.
     void hash_roll_forward()
     {
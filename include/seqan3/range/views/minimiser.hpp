@@ -12,7 +12,9 @@
 
 #pragma once
 
-#include <deque>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 #include <seqan3/range/concept.hpp>
 #include <seqan3/range/views/detail.hpp>
@@ -208,7 +210,12 @@ public:
          urange_end{std::move(it.urange_end)},
          minimiser_value{std::move(it.minimiser_value)},
          window_right{std::move(it.window_right)},
-         window_values{std::move(it.window_values)}
+         window_size{it.window_size},
+         window_values{std::move(it.window_values)},
+         left_block{it.left_block},
+         right_block{it.right_block},
+         block_position{it.block_position},
+         right_block_minimum{std::move(it.right_block_minimum)}
     {}
 
     /*!\brief                              Construct from begin and end iterators of a given range over
@@ -252,8 +259,7 @@ public:
     //!\brief Compare to another window_iterator.
     friend bool operator==(window_iterator const & lhs, window_iterator const & rhs)
     {
-        return (lhs.window_right == rhs.window_right) &&
-               (lhs.window_values.size() == rhs.window_values.size());
+        return (lhs.window_right == rhs.window_right) && (lhs.window_size == rhs.window_size);
     }
 
     //!\brief Compare to the sentinel of the underlying range.
@@ -277,25 +283,25 @@ public:
     //!\brief Compare to another window_iterator.
     friend bool operator<(window_iterator const & lhs, window_iterator const & rhs)
     {
-        return (lhs.window_right < rhs.window_right) && (lhs.window_values.size() < rhs.window_values.size());
+        return (lhs.window_right < rhs.window_right) && (lhs.window_size < rhs.window_size);
     }
 
     //!\brief Compare to another window_iterator.
     friend bool operator>(window_iterator const & lhs, window_iterator const & rhs)
     {
-        return (lhs.window_right > rhs.window_right) && (lhs.window_values.size() > rhs.window_values.size());
+        return (lhs.window_right > rhs.window_right) && (lhs.window_size > rhs.window_size);
     }
 
     //!\brief Compare to another window_iterator.
     friend bool operator<=(window_iterator const & lhs, window_iterator const & rhs)
     {
-        return (lhs.window_right <= rhs.window_right) && (lhs.window_values.size() <= rhs.window_values.size());
+        return (lhs.window_right <= rhs.window_right) && (lhs.window_size <= rhs.window_size);
     }
 
     //!\brief Compare to another window_iterator.
     friend bool operator>=(window_iterator const & lhs, window_iterator const & rhs)
     {
-        return (lhs.window_right >= rhs.window_right) && (lhs.window_values.size() >= rhs.window_values.size());
+        return (lhs.window_right >= rhs.window_right) && (lhs.window_size >= rhs.window_size);
     }
     //!\}
 
@@ -330,8 +336,32 @@ private:
     //!\brief Iterator to the rightmost value of one window.
     it_t window_right;
 
-    //!\brief Stored values per window. It is necessary to store them, because a shift can remove the current minimiser.
-    std::deque<value_type> window_values;
+    //!\brief The number of values in one window.
+    uint32_t window_size{};
+
+    /*!\brief The values of the window, split into two blocks of window_size values (block-based two-stack minima).
+     *
+     * \details
+     *
+     * The window consists of the last `window_size - block_position` values of the left block and the first
+     * `block_position` values of the right block. For the left block, the minima of all its suffixes are stored, for
+     * the right block the minimum of the values read so far. The minimum of the window is therefore the minimum of
+     * one suffix minimum and right_block_minimum. Once the right block is full, it becomes the left block and its
+     * suffix minima are computed; this takes `window_size` steps every `window_size` shifts of the window.
+     *
+     * The buffer holds three segments of window_size values: the suffix minima of the left block, followed by the
+     * values of the left and the right block at the offsets left_block and right_block, which are swapped when the
+     * blocks are. It is allocated once, when the first window is computed.
+     */
+    std::vector<value_type> window_values{};
+    //!\brief The offset of the values of the left block in window_values.
+    size_t left_block{};
+    //!\brief The offset of the values of the right block in window_values.
+    size_t right_block{};
+    //!\brief The position of the first window value in the left block, which is also the size of the right block.
+    size_t block_position{};
+    //!\brief The minimum of the values of the right block; only valid if block_position is greater than 0.
+    value_type right_block_minimum{};
 
     //!\brief Increments iterator by 1.
     void get_minimiser()
@@ -340,21 +370,49 @@ private:
         while (!next_minimiser()) {}
     }
 
+    //!\brief Computes the suffix minima of the left block into the first segment of window_values.
+    void compute_suffix_minima()
+    {
+        value_type minimum = window_values[left_block + window_size - 1];
+        window_values[window_size - 1] = minimum;
+
+        for (size_t i = window_size - 1; i > 0; --i)
+        {
+            minimum = std::min(minimum, window_values[left_block + i - 1]);
+            window_values[i - 1] = minimum;
+        }
+    }
+
+    //!\brief Returns the minimum of the current window.
+    value_type window_minimum() const
+    {
+        return (block_position == 0) ? window_values[0]
+                                     : std::min(window_values[block_position], right_block_minimum);
+    }
+
     //!\brief Calculates minimisers for the first window.
     void window_first(uint32_t window_values_size)
     {
+        window_size = window_values_size;
+        window_values.resize(3 * window_size);
+        left_block = window_size;
+        right_block = 2 * window_size;
+
         for (uint32_t i = 0; (i < window_values_size - 1) ; i++)
         {
-            window_values.push_back(*window_right);
+            window_values[left_block + i] = *window_right;
             std::ranges::advance(window_right,  1);
         }
-        window_values.push_back(*window_right);
-        minimiser_value = *(std::min_element(std::begin(window_values), std::end(window_values)));
+        window_values[left_block + window_size - 1] = *window_right;
+
+        compute_suffix_minima();
+        minimiser_value = window_minimum();
     }
 
     //!\brief Calculates the next minimiser value.
-    // For the following windows, we remove the first window value (is now not in window_values) and add the new
-    // value that results from the window shifting.
+    // For the following windows, we remove the first window value (is now not in the window) and add the new
+    // value that results from the window shifting. Amortised constant time, since the suffix minima of a block are
+    // computed once per window_size shifts.
     bool next_minimiser()
     {
         std::ranges::advance(window_right, 1);
@@ -362,16 +420,23 @@ private:
             return true;
 
         value_type new_value = *window_right;
-        if (minimiser_value == *(std::begin(window_values)))
+        bool const minimiser_leaves = (minimiser_value == window_values[left_block + block_position]);
+
+        window_values[right_block + block_position] = new_value;
+        right_block_minimum = (block_position == 0) ? new_value : std::min(right_block_minimum, new_value);
+
+        if (++block_position == window_size) // the right block is full and becomes the left block
         {
-            window_values.pop_front();
-            window_values.push_back(new_value);
-            minimiser_value = *(std::min_element(std::begin(window_values), std::end(window_values)));
-            return true;
+            std::swap(left_block, right_block);
+            block_position = 0;
+            compute_suffix_minima();
         }
 
-        window_values.pop_front();
-        window_values.push_back(new_value);
+        if (minimiser_leaves)
+        {
+            minimiser_value = window_minimum();
+            return true;
+        }
 
         if (new_value < minimiser_value)
         {
@@ -44,6 +44,9 @@ enum struct search_config_id : uint8_t
     output, //!< Identifier for the output configuration.
     hit, //!< Identifier for the hit configuration (all, all_best, single_best, strata).
     parallel, //!< Identifier for the parallel execution configuration.
+    verification, //!< Identifier for the filter-and-verify configuration.
+    page_size, //!< Identifier for the page size configuration.
+    max_hits, //!< Identifier for the maximal number of hits configuration.
     //!\cond
     // ATTENTION: Must always be the last item; will be used to determine the number of ids.
     SIZE //!< Determines the size of the enum.
@@ -69,12 +72,15 @@ inline constexpr std::array<std::array<bool, static_cast<uint8_t>(search_config_
                             static_cast<uint8_t>(search_config_id::SIZE)> compatibility_table<search_config_id> =
 {
     {
-        // max_error, max_error_rate, output, hit, parallel
-        { 0, 0, 1, 1, 1},
-        { 0, 0, 1, 1, 1},
-        { 1, 1, 0, 1, 1},
-        { 1, 1, 1, 0, 1},
-        { 1, 1, 1, 1, 0}
+        // max_error, max_error_rate, output, hit, parallel, verification, page_size, max_hits
+        { 0, 0, 1, 1, 1, 1, 1, 1},
+        { 0, 0, 1, 1, 1, 1, 1, 1},
+        { 1, 1, 0, 1, 1, 1, 1, 1},
+        { 1, 1, 1, 0, 1, 1, 1, 1},
+        { 1, 1, 1, 1, 0, 1, 1, 1},
+        { 1, 1, 1, 1, 1, 0, 1, 1},
+        { 1, 1, 1, 1, 1, 1, 0, 1},
+        { 1, 1, 1, 1, 1, 1, 1, 0}
     }
 };
 
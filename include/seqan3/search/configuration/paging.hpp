@@ -0,0 +1,69 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides the configurations seqan3::search_cfg::page_size and seqan3::search_cfg::max_hits.
+ */
+
+#pragma once
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/search/configuration/detail.hpp>
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Configuration element to locate the text positions of the hits lazily in pages of the given size.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * By default, the text positions of all hits of a query are located and stored before the first hit of that query is
+ * returned. For repetitive queries this can require a lot of memory. If this configuration element is given, the
+ * search only stores the index cursors of a query and locates at most `page_size` text positions at a time, whenever
+ * the previous page has been consumed. The memory needed for the results of a query is thus bounded by the page size.
+ *
+ * In this mode the hits of a query are reported in the order of the underlying index cursors, i.e. the text
+ * positions are not sorted and a text position might be reported more than once if it was found with different
+ * error patterns.
+ *
+ * The configuration has no effect if the index cursors are returned (seqan3::search_cfg::index_cursor),
+ * if only a single best hit is reported (seqan3::search_cfg::hit_single_best) or if the hits are verified against the
+ * text (seqan3::search_cfg::verification). The page size must be greater than `0`.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/configuration_paging.cpp
+ */
+struct page_size : public pipeable_config_element<page_size, size_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::page_size};
+};
+
+/*!\brief Configuration element to limit the number of text positions that are reported per query.
+ * \ingroup search_configuration
+ *
+ * \details
+ *
+ * Once `max_hits` text positions of a query have been located, the remaining occurrences of that query are
+ * discarded without locating them. Which occurrences are reported is unspecified.
+ * The configuration has no effect if the index cursors are returned (seqan3::search_cfg::index_cursor).
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/configuration_paging.cpp
+ */
+struct max_hits : public pipeable_config_element<max_hits, size_t>
+{
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::max_hits};
+};
+
+} // namespace seqan3::search_cfg
@@ -0,0 +1,82 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::search_cfg::verification configuration.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <seqan3/core/algorithm/pipeable_config_element.hpp>
+#include <seqan3/search/configuration/detail.hpp>
+
+namespace seqan3::search_cfg
+{
+
+/*!\brief Enables the filter-and-verify search mode which verifies candidate regions against the original text.
+ * \ingroup search_configuration
+ * \tparam text_t The type of the text the index was built on.
+ *
+ * \details
+ *
+ * By default, approximate search enumerates all error patterns by backtracking in the index. The number of
+ * enumerated paths grows exponentially with the number of errors, which makes high error rates prohibitively
+ * expensive. If this configuration element is given, the search instead splits the query into `e + 1` pieces for
+ * `e` errors and searches every piece exactly in the index. By the pigeonhole principle, every occurrence with at
+ * most `e` errors contains at least one of the pieces without an error. The located pieces are turned into candidate
+ * regions of the text, which are verified with the bit-parallel edit distance algorithm
+ * (seqan3::detail::edit_distance_unbanded) against the text that is passed to this configuration element.
+ *
+ * Candidate regions whose start positions lie within `e` positions of each other stem from the same occurrence and
+ * are verified only once. Every text position at which an occurrence with at most `e` errors begins is reported,
+ * also if the occurrences overlap, e.g. in periodic text. The reported text positions are thus the same as the ones
+ * of the backtracking search.
+ *
+ * The text must be the one the index was built on and must outlive the search.
+ * The verification uses the edit distance, i.e. only the total number of errors is considered and the thresholds
+ * for the single error types are ignored.
+ * This mode can only be combined with seqan3::search_cfg::text_position as output.
+ *
+ * ### Example
+ *
+ * \include test/snippet/search/configuration_verification.cpp
+ */
+template <typename text_t>
+class verification : public pipeable_config_element<verification<text_t>, text_t const *>
+{
+    //!\brief The base type of this class.
+    using base_t = pipeable_config_element<verification<text_t>, text_t const *>;
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    constexpr verification() = default; //!< Defaulted.
+    constexpr verification(verification const &) = default; //!< Defaulted.
+    constexpr verification & operator=(verification const &) = default; //!< Defaulted.
+    constexpr verification(verification &&) = default; //!< Defaulted.
+    constexpr verification & operator=(verification &&) = default; //!< Defaulted.
+    ~verification() = default; //!< Defaulted.
+
+    /*!\brief Stores a pointer to the text that is used to verify the candidate regions.
+     * \param[in] text The text the index was built on; must outlive the search.
+     */
+    constexpr verification(text_t const & text) noexcept : base_t{std::addressof(text)}
+    {}
+
+    //!\brief Temporaries cannot be stored, since the configuration only refers to the text.
+    verification(text_t const &&) = delete;
+    //!\}
+
+    //!\privatesection
+    //!\brief Internal id to check for consistent configuration settings.
+    static constexpr detail::search_config_id id{detail::search_config_id::verification};
+};
+
+} // namespace seqan3::search_cfg
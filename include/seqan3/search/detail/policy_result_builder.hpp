@@ -12,6 +12,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
+
+#include <seqan3/range/views/take.hpp>
+#include <seqan3/search/detail/search_common.hpp>
+#include <seqan3/search/detail/search_result_pager.hpp>
 #include <seqan3/search/detail/search_traits.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
 #include <seqan3/search/search_result.hpp>
@@ -24,6 +30,20 @@ namespace seqan3::detail
 struct policy_result_builder
 {
 protected:
+    /*!\brief Returns the maximal number of text positions reported per query.
+     * \tparam configuration_t The search configuration type.
+     * \param[in] cfg The search configuration.
+     * \returns The value of seqan3::search_cfg::max_hits if configured, otherwise the maximal value of `size_t`.
+     */
+    template <typename configuration_t>
+    static size_t max_hits([[maybe_unused]] configuration_t const & cfg) noexcept
+    {
+        if constexpr (search_traits<configuration_t>::has_max_hits)
+            return get<search_cfg::max_hits>(cfg).value;
+        else
+            return std::numeric_limits<size_t>::max();
+    }
+
     /*!\brief Returns all hits (index cursors) without calling locate on each cursor.
      * \tparam index_cursor_t The type of index cursor used in the search algorithm.
      * \tparam configuration_t The search configuration type.
@@ -87,14 +107,18 @@ protected:
      *
      * This function is used for all search modi except single_best (which are all, all_best, and strata).
      *
-     * The text positions are sorted and made unique by position before returning them.
+     * The text positions are sorted and made unique by position before returning them. If seqan3::search_cfg::max_hits
+     * was configured, the cursors are located until that many unique text positions were found. Cursors found with
+     * different error patterns may overlap, hence the duplicates are removed whenever the limit is reached and the
+     * locating continues if fewer unique text positions remain. Surplus text positions are discarded.
      */
     template <typename index_cursor_t, typename configuration_t>
     //!\cond
         requires search_traits<configuration_t>::search_return_text_position &&
-                 (!search_traits<configuration_t>::search_single_best_hit)
+                 (!search_traits<configuration_t>::search_single_best_hit) &&
+                 (!search_traits<configuration_t>::search_in_pages)
     //!\endcond
-    auto make_results(std::vector<index_cursor_t> internal_hits, configuration_t const &)
+    auto make_results(std::vector<index_cursor_t> internal_hits, configuration_t const & cfg)
     {
         using index_size_t = typename index_cursor_t::index_type::size_type;
         using search_result_t = search_result<size_t, empty_type, index_size_t, index_size_t>;
@@ -102,10 +126,6 @@ protected:
         std::vector<search_result_t> results{};
         results.reserve(internal_hits.size()); // expect at least as many text positions as cursors, possibly more
 
-        for (auto const & cursor : internal_hits)
-            for (auto && [ref_id, ref_pos] : cursor.locate())
-                results.push_back(search_result_t{0, ref_id, ref_pos});
-
         // sort by reference id or by reference position if both have the same reference id.
         auto compare = [] (auto const & r1, auto const & r2)
         {
@@ -113,8 +133,129 @@ protected:
                                                             : (r1.reference_id() < r2.reference_id());
         };
 
-        std::sort(results.begin(), results.end(), compare);
-        results.erase(std::unique(results.begin(), results.end()), results.end());
+        auto sort_and_unique = [&] ()
+        {
+            std::sort(results.begin(), results.end(), compare);
+            results.erase(std::unique(results.begin(), results.end()), results.end());
+        };
+
+        size_t const hits_limit = max_hits(cfg);
+        // Locating at least half of the limit at a time bounds how often the duplicates are removed.
+        size_t const min_chunk_size = hits_limit / 2 + 1;
+        for (auto const & cursor : internal_hits)
+        {
+            for (index_size_t located = 0; located < cursor.count() && results.size() < hits_limit;)
+            {
+                index_size_t const length = std::min<size_t>(cursor.count() - located,
+                                                             std::max(hits_limit - results.size(), min_chunk_size));
+                for (auto && [ref_id, ref_pos] : cursor.locate(located, length))
+                    results.push_back(search_result_t{0, ref_id, ref_pos});
+
+                located += length;
+
+                if (results.size() >= hits_limit)
+                    sort_and_unique();
+            }
+
+            if (results.size() >= hits_limit)
+                break;
+        }
+
+        sort_and_unique();
+
+        if (results.size() > hits_limit)
+            results.erase(results.begin() + hits_limit, results.end());
+
+        return results;
+    }
+
+    /*!\brief Returns a seqan3::detail::search_result_pager which locates the text positions of the cursors lazily.
+     * \tparam index_cursor_t The type of index cursor used in the search algorithm.
+     * \tparam configuration_t The search configuration type.
+     * \param[in] internal_hits internal_hits A range over internal cursor results.
+     * \param[in] cfg The search configuration.
+     * \returns a seqan3::detail::search_result_pager.
+     *
+     * \details
+     *
+     * This function is used instead of the one above if seqan3::search_cfg::page_size was configured.
+     * The text positions are neither sorted nor made unique.
+     */
+    template <typename index_cursor_t, typename configuration_t>
+    //!\cond
+        requires search_traits<configuration_t>::search_in_pages
+    //!\endcond
+    auto make_results(std::vector<index_cursor_t> internal_hits, configuration_t const & cfg)
+    {
+        return search_result_pager<index_cursor_t>{std::move(internal_hits),
+                                                   get<search_cfg::page_size>(cfg).value,
+                                                   max_hits(cfg)};
+    }
+
+    /*!\brief Returns a range over seqan3::search_result from the hits of the filter-and-verify search.
+     * \tparam index_size_t The size type of the index used in the search algorithm.
+     * \tparam configuration_t The search configuration type.
+     * \param[in] verified_hits The hits that were verified against the text.
+     * \returns a range over seqan3::search_result.
+     *
+     * \details
+     *
+     * Overlapping candidate regions may confirm the same occurrence. Hits beginning at the same text position are
+     * therefore reported only once, namely the one with the fewest errors. In single_best mode, only one hit with the
+     * fewest errors is reported.
+     *
+     * The text positions are sorted and made unique by position before returning them.
+     */
+    template <typename index_size_t, typename configuration_t>
+    //!\cond
+        requires search_traits<configuration_t>::search_return_text_position
+    //!\endcond
+    auto make_verified_results(std::vector<verified_hit<index_size_t>> verified_hits, configuration_t const & cfg)
+    {
+        using search_result_t = search_result<size_t, empty_type, index_size_t, index_size_t>;
+
+        auto by_position_and_errors = [] (auto const & h1, auto const & h2)
+        {
+            return std::tie(h1.reference_id, h1.reference_begin_pos, h1.errors) <
+                   std::tie(h2.reference_id, h2.reference_begin_pos, h2.errors);
+        };
+        auto same_position = [] (auto const & h1, auto const & h2)
+        {
+            return std::tie(h1.reference_id, h1.reference_begin_pos) ==
+                   std::tie(h2.reference_id, h2.reference_begin_pos);
+        };
+
+        std::sort(verified_hits.begin(), verified_hits.end(), by_position_and_errors);
+        verified_hits.erase(std::unique(verified_hits.begin(), verified_hits.end(), same_position),
+                            verified_hits.end());
+
+        std::vector<search_result_t> results{};
+
+        if constexpr (search_traits<configuration_t>::search_single_best_hit)
+        {
+            auto fewer_errors = [] (auto const & h1, auto const & h2) { return h1.errors < h2.errors; };
+            auto best = std::min_element(verified_hits.begin(), verified_hits.end(), fewer_errors);
+
+            if (best != verified_hits.end())
+                results.push_back(search_result_t{0, best->reference_id, best->reference_begin_pos});
+        }
+        else
+        {
+            size_t const result_count = std::min<size_t>(verified_hits.size(), max_hits(cfg));
+            results.reserve(result_count);
+            for (auto const & hit : verified_hits | views::take(result_count))
+                results.push_back(search_result_t{0, hit.reference_id, hit.reference_begin_pos});
+
+            // sort by reference id or by reference position if both have the same reference id.
+            auto compare = [] (auto const & r1, auto const & r2)
+            {
+                return (r1.reference_id() == r2.reference_id()) ? (r1.reference_begin_pos() < r2.reference_begin_pos())
+                                                                : (r1.reference_id() < r2.reference_id());
+            };
+
+            std::sort(results.begin(), results.end(), compare);
+            results.erase(std::unique(results.begin(), results.end()), results.end());
+        }
 
         return results;
     }
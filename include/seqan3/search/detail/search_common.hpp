@@ -45,4 +45,18 @@ struct search_param
     }
 };
 
+/*!\brief A hit of the filter-and-verify search that was confirmed against the text.
+ * \tparam index_size_t The size type of the index.
+ */
+template <typename index_size_t>
+struct verified_hit
+{
+    //!\brief The id of the reference sequence the hit lies in.
+    index_size_t reference_id{};
+    //!\brief The begin position of the hit in the reference sequence.
+    index_size_t reference_begin_pos{};
+    //!\brief The number of errors of the hit.
+    uint8_t errors{};
+};
+
 } // namespace seqan3::detail
@@ -0,0 +1,144 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::search_result_pager.
+ */
+
+#pragma once
+
+#include <cassert>
+#include <limits>
+#include <vector>
+
+#include <seqan3/core/detail/empty_type.hpp>
+#include <seqan3/search/search_result.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\brief Stores the index cursors of a query and locates their text positions page by page.
+ * \ingroup search
+ * \tparam index_cursor_t The type of the index cursor; must model seqan3::fm_index_cursor_specialisation.
+ *
+ * \details
+ *
+ * This type is returned by the search algorithms instead of all search results if seqan3::search_cfg::page_size was
+ * configured. The seqan3::search_result_range calls fill_page() whenever the results of the previous page have been
+ * consumed. Only the cursors (i.e. the suffix array intervals) of a query are kept in memory, the text positions are
+ * located with seqan3::fm_index_cursor::locate(first, length) for at most `page_size` occurrences at a time.
+ */
+template <typename index_cursor_t>
+class search_result_pager
+{
+public:
+    //!\brief The size type of the index.
+    using size_type = typename index_cursor_t::size_type;
+    //!\brief The type of the search results generated by this pager.
+    using value_type = search_result<size_t, empty_type, size_type, size_type>;
+
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    search_result_pager() = default; //!< Defaulted.
+    search_result_pager(search_result_pager const &) = default; //!< Defaulted.
+    search_result_pager(search_result_pager &&) = default; //!< Defaulted.
+    search_result_pager & operator=(search_result_pager const &) = default; //!< Defaulted.
+    search_result_pager & operator=(search_result_pager &&) = default; //!< Defaulted.
+    ~search_result_pager() = default; //!< Defaulted.
+
+    /*!\brief Constructs the pager from the cursors found for a query.
+     * \param[in] cursors   The index cursors found for the query.
+     * \param[in] page_size The maximal number of text positions located at a time; must be greater than `0`.
+     * \param[in] max_hits  The maximal number of text positions located in total.
+     */
+    search_result_pager(std::vector<index_cursor_t> cursors,
+                        size_t const page_size,
+                        size_t const max_hits = std::numeric_limits<size_t>::max()) :
+        cursors{std::move(cursors)},
+        page_size{page_size},
+        remaining_hits{max_hits}
+    {
+        assert(page_size > 0);
+    }
+    //!\}
+
+    //!\brief Returns `true` if all text positions have been located, otherwise `false`.
+    bool exhausted() const noexcept
+    {
+        return current_cursor == cursors.size() || remaining_hits == 0;
+    }
+
+    /*!\brief Locates the text positions of the next page and appends them to the buffer.
+     * \param[in, out] buffer The buffer to append the search results to.
+     *
+     * \details
+     *
+     * Appends at most `page_size` search results. If the current cursor has fewer occurrences left, the next cursors
+     * are processed until the page is full.
+     */
+    void fill_page(std::vector<value_type> & buffer)
+    {
+        size_t page_capacity = std::min(page_size, remaining_hits);
+
+        while (page_capacity > 0 && current_cursor < cursors.size())
+        {
+            index_cursor_t const & cursor = cursors[current_cursor];
+            size_type const length = std::min<size_type>(page_capacity, cursor.count() - located_in_cursor);
+
+            for (auto && [ref_id, ref_pos] : cursor.locate(located_in_cursor, length))
+                buffer.push_back(value_type{0, ref_id, ref_pos});
+
+            page_capacity -= length;
+            remaining_hits -= length;
+            located_in_cursor += length;
+
+            if (located_in_cursor == cursor.count())
+            {
+                ++current_cursor;
+                located_in_cursor = 0;
+            }
+        }
+    }
+
+private:
+    //!\brief The cursors found for the query.
+    std::vector<index_cursor_t> cursors{};
+    //!\brief The maximal number of text positions located at a time.
+    size_t page_size{1};
+    //!\brief The number of text positions that may still be located.
+    size_t remaining_hits{std::numeric_limits<size_t>::max()};
+    //!\brief The position of the cursor that is currently located.
+    size_t current_cursor{0};
+    //!\brief The number of text positions already located for the current cursor.
+    size_type located_in_cursor{0};
+};
+
+/*!\brief Determines the type of the search results returned by a search algorithm.
+ * \ingroup search
+ * \tparam hit_range_t The type returned by the search algorithm; either a range over seqan3::search_result or a
+ *                     seqan3::detail::search_result_pager.
+ */
+template <typename hit_range_t>
+struct search_hit_value
+{
+    //!\brief The value type of the range over the search results.
+    using type = std::ranges::range_value_t<hit_range_t>;
+};
+
+//!\brief Specialisation for seqan3::detail::search_result_pager.
+//!\ingroup search
+template <typename index_cursor_t>
+struct search_hit_value<search_result_pager<index_cursor_t>>
+{
+    //!\brief The type of the search results generated by the pager.
+    using type = typename search_result_pager<index_cursor_t>::value_type;
+};
+
+} // namespace seqan3::detail
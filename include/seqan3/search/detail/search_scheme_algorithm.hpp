@@ -12,14 +12,21 @@
 
 #pragma once
 
+#include <cmath>
+#include <map>
+#include <numeric>
 #include <type_traits>
+#include <vector>
 
+#include <seqan3/alphabet/concept.hpp>
+#include <seqan3/core/bit_manipulation.hpp>
 #include <seqan3/core/type_traits/transformation_trait_or.hpp>
 #include <seqan3/range/views/slice.hpp>
 #include <seqan3/search/detail/search_common.hpp>
 #include <seqan3/search/detail/search_scheme_precomputed.hpp>
 #include <seqan3/search/detail/search_traits.hpp>
 #include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/std/algorithm>
 
 namespace seqan3::detail
 {
@@ -70,9 +77,19 @@ public:
      * ### Complexity
      *
      * \f$O(|query|^e)\f$ where \f$e\f$ is the total number of maximum errors.
+     *
+     * ### Exceptions
+     *
+     * Throws std::bad_alloc if the memory for the hits or for a search scheme computed for more than 3 errors cannot
+     * be allocated. The cache of computed search schemes is not changed in this case.
+     *
+     * ### Thread-safety
+     *
+     * Calls to this function in a concurrent environment are not thread safe, since the cache of computed search
+     * schemes is modified. Instead use a copy of the search algorithm per thread.
      */
     template <typename query_t>
-    auto operator()(query_t && query) noexcept
+    auto operator()(query_t && query)
     {
         auto error_state = this->max_error_counts(config, query); // see policy_max_error
 
@@ -95,6 +112,21 @@ private:
     //!\brief A pointer to the fm index which is used to perform the unidirectional search.
     index_t const * index_ptr{nullptr};
 
+    //!\brief The type of the block information of a computed search scheme.
+    using dyn_block_info_type = std::vector<std::tuple<search_dyn::blocks_length_type, size_t>>;
+
+    /*!\brief Search schemes computed on the fly for error numbers without precomputed search scheme, together with
+     *        the optimum block lengths for a query length bin.
+     *
+     * \details
+     *
+     * The key is the pair of maximum errors and the bin of the query length, i.e. the position of its most significant
+     * bit. The block lengths are optimised once per bin and scaled to the length of each query, so the cache holds at
+     * most 64 entries per error number and reads of varying length do not run the optimiser again. The cache is owned
+     * by this algorithm object and not shared with its copies.
+     */
+    std::map<std::pair<uint8_t, uint8_t>, std::pair<search_scheme_dyn_type, std::vector<size_t>>> computed_schemes{};
+
     // forward declaration
     template <bool abort_on_hit, typename query_t, typename delegate_t>
     inline void search_algo_bi(query_t & query, search_param const error_left, delegate_t && delegate);
@@ -148,13 +180,31 @@ private:
     }
 };
 
-/*!\brief Computes a (non-optimal) search scheme. Currently the generated search scheme represents trivial backtracking.
+/*!\brief Computes a search scheme for an arbitrary number of errors.
  * \param[in] min_error Minimum number of errors allowed.
  * \param[in] max_error Maximum number of errors allowed.
  *
+ * \details
+ *
+ * The query is split into \f$K + 1\f$ blocks where \f$K\f$ is `max_error`. The scheme is based on the suffix filter
+ * lemma (Kärkkäinen and Na, 2007): For every occurrence with at most \f$K\f$ errors, there is a block \f$i\f$ such
+ * that the blocks \f$i, \ldots, j\f$ contain at most \f$j - i\f$ errors for all \f$j \geq i\f$. Choosing \f$i\f$ as the
+ * block after the last maximum of the prefix sums \f$\sum_{t \leq j} (e_t - 1)\f$ (where \f$e_t\f$ is the number of
+ * errors in block \f$t\f$) makes \f$i\f$ unique and additionally implies that the blocks \f$j + 1, \ldots, i - 1\f$
+ * contain at least \f$i - 1 - j\f$ errors for all \f$j < i - 1\f$.
+ *
+ * For each \f$i\f$ the blocks are searched in the order \f$i, i - 1, \ldots, 1, i + 1, \ldots, K + 1\f$, i.e. every
+ * search starts with an exact search of block \f$i\f$. The errors \f$L\f$ spent in the blocks left of \f$i\f$ are
+ * bounded from below by the second property. Since the upper bounds for the blocks right of \f$i\f$ depend on
+ * \f$L\f$, there is one search per feasible value of \f$L\f$. This way every error distribution is covered by exactly
+ * one search and no hit is reported twice by different searches.
+ *
+ * Please note that the searches are sorted by their upper error bound string, s.t. easy to compute searches come
+ * first.
+ *
  * ### Complexity
  *
- * Constant.
+ * \f$O(K^3)\f$.
  *
  * ### Exceptions
  *
@@ -162,20 +212,256 @@ private:
  */
 inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const max_error)
 {
-    // TODO: Replace this at least by the pigeonhole principle or even better by 01*0 schemes.
-    // NOTE: Make sure that the searches are sorted by their asymptotical running time (i.e. upper error bound string),
-    //       s.t. easy to compute searches come first. This improves the running time of algorithms that abort after the
-    //       first hit (e.g. search strategy: best). Even though it is not guaranteed, this seems to be a good greedy
-    //       approach.
-    std::vector<search_dyn> scheme{{{1}, {min_error}, {max_error}}};
+    assert(min_error <= max_error);
+
+    uint8_t const blocks = max_error + 1;
+    std::vector<search_dyn> scheme{};
+
+    for (uint8_t i = 1; i <= blocks; ++i)
+    {
+        // The number of errors in the blocks left of block i; at least one error per block.
+        for (uint8_t left_errors = i - 1; left_errors <= (i == 1 ? 0 : max_error); ++left_errors)
+        {
+            search_dyn search{};
+            search.pi.reserve(blocks);
+            search.l.reserve(blocks);
+            search.u.reserve(blocks);
+
+            // The first block is searched without errors.
+            search.pi.push_back(i);
+            search.l.push_back(0);
+            search.u.push_back(0);
+
+            // The blocks left of block i contain at least t errors after the t-th block and left_errors in total.
+            for (uint8_t t = 1; t < i; ++t)
+            {
+                search.pi.push_back(i - t);
+                search.l.push_back(t + 1 == i ? left_errors : t);
+                search.u.push_back(left_errors);
+            }
+
+            // The blocks right of block i contain at most s errors after the s-th block.
+            for (uint8_t s = 1; i + s <= blocks; ++s)
+            {
+                search.pi.push_back(i + s);
+                search.l.push_back(left_errors);
+                search.u.push_back(std::min<uint8_t>(max_error, left_errors + s));
+            }
+
+            search.l.back() = std::max(search.l.back(), min_error);
+
+            if (search.l.back() <= search.u.back())
+                scheme.push_back(std::move(search));
+        }
+    }
+
+    std::stable_sort(scheme.begin(), scheme.end(), [] (search_dyn const & lhs, search_dyn const & rhs)
+    {
+        return lhs.u < rhs.u;
+    });
+
     return scheme;
 }
 
+/*!\brief Estimates the running time of searching a query with a search scheme in an index.
+ * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \param[in] search_scheme The search scheme.
+ * \param[in] blocks_length The length of every block, ordered by block id (i.e. not cumulative).
+ * \param[in] sigma         The alphabet size of the index.
+ * \param[in] text_length   The length of the indexed text.
+ * \returns The expected number of nodes visited in the conceptual suffix tree of the text.
+ *
+ * \details
+ *
+ * The model only considers substitutions and assumes a uniformly distributed random text. A string of length
+ * \f$d\f$ occurs in the text with probability \f$\min(1, n / \sigma^d)\f$. The expected number of visited nodes of a
+ * search is the sum over all depths of the number of strings with an admissible number of errors times this
+ * probability. Although the absolute numbers are not accurate for real data, the estimate is good enough to compare
+ * different choices of block lengths with each other.
+ *
+ * ### Complexity
+ *
+ * \f$O(s \cdot m \cdot K)\f$ where \f$s\f$ is the number of searches, \f$m\f$ is the query length and \f$K\f$ is the
+ * number of errors.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+template <typename search_scheme_t>
+inline double search_scheme_cost(search_scheme_t const & search_scheme,
+                                 std::vector<size_t> const & blocks_length,
+                                 double const sigma,
+                                 double const text_length)
+{
+    double const log_text_length = std::log(std::max(text_length, 1.0));
+    double const log_sigma = std::log(std::max(sigma, 2.0));
+
+    // logarithm of the probability that a random string of length `depth` occurs in the text
+    auto log_occurrence_probability = [&] (size_t const depth)
+    {
+        return std::min(0.0, log_text_length - depth * log_sigma);
+    };
+
+    double cost{0};
+
+    for (auto const & search : search_scheme)
+    {
+        uint8_t const max_error = search.u[search.blocks() - 1];
+
+        // expected number of nodes with `e` errors at the current depth
+        std::vector<double> nodes(max_error + 1, 0.0);
+        std::vector<double> next_nodes(max_error + 1, 0.0);
+        nodes[0] = 1.0;
+        size_t depth{0};
+
+        for (uint8_t block_id = 0; block_id < search.blocks(); ++block_id)
+        {
+            uint8_t const l = search.l[block_id];
+            uint8_t const u = search.u[block_id];
+
+            for (size_t c = 0; c < blocks_length[search.pi[block_id] - 1]; ++c, ++depth)
+            {
+                double const ratio = std::exp(log_occurrence_probability(depth + 1) -
+                                              log_occurrence_probability(depth));
+
+                for (uint8_t e = 0; e <= max_error; ++e)
+                {
+                    double const match = nodes[e];
+                    double const mismatch = (e > 0) ? nodes[e - 1] * (sigma - 1) : 0.0;
+                    next_nodes[e] = (e <= u) ? (match + mismatch) * ratio : 0.0;
+                    cost += next_nodes[e];
+                }
+
+                std::swap(nodes, next_nodes);
+            }
+
+            // Discard all nodes that do not spend enough errors in the block.
+            for (uint8_t e = 0; e < l; ++e)
+                nodes[e] = 0.0;
+        }
+    }
+
+    return cost;
+}
+
+/*!\brief Chooses the length of the blocks of a search scheme that minimise the estimated running time.
+ * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \param[in] search_scheme The search scheme.
+ * \param[in] query_length  The length of the query that will be searched; must be at least the number of blocks.
+ * \param[in] sigma         The alphabet size of the index.
+ * \param[in] text_length   The length of the indexed text.
+ * \returns The length of every block, ordered by block id (i.e. not cumulative).
+ *
+ * \details
+ *
+ * Starts with blocks of equal length and moves single characters from one block to another as long as this decreases
+ * the cost computed by seqan3::detail::search_scheme_cost. Typically, the blocks that are searched first in many
+ * searches become longer, since an exact match of a long block leaves few candidates for the error-prone remainder.
+ *
+ * ### Complexity
+ *
+ * \f$O(m \cdot b^2)\f$ evaluations of seqan3::detail::search_scheme_cost in the worst case where \f$m\f$ is the query
+ * length and \f$b\f$ is the number of blocks.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+template <typename search_scheme_t>
+inline std::vector<size_t> optimum_blocks_length(search_scheme_t const & search_scheme,
+                                                 size_t const query_length,
+                                                 double const sigma,
+                                                 double const text_length)
+{
+    uint8_t const blocks = search_scheme[0].blocks();
+    assert(query_length >= blocks);
+
+    std::vector<size_t> blocks_length(blocks, query_length / blocks);
+    for (uint8_t block_id = 0; block_id < query_length % blocks; ++block_id)
+        ++blocks_length[block_id];
+
+    double best_cost = search_scheme_cost(search_scheme, blocks_length, sigma, text_length);
+
+    for (bool improved = true; improved;)
+    {
+        improved = false;
+
+        for (uint8_t from = 0; from < blocks; ++from)
+        {
+            for (uint8_t to = 0; to < blocks; ++to)
+            {
+                if (from == to || blocks_length[from] <= 1)
+                    continue;
+
+                --blocks_length[from];
+                ++blocks_length[to];
+
+                if (double const cost = search_scheme_cost(search_scheme, blocks_length, sigma, text_length);
+                    cost < best_cost)
+                {
+                    best_cost = cost;
+                    improved = true;
+                }
+                else // undo
+                {
+                    ++blocks_length[from];
+                    --blocks_length[to];
+                }
+            }
+        }
+    }
+
+    return blocks_length;
+}
+
+/*!\brief Scales block lengths to another query length while keeping their proportions.
+ * \param[in] blocks_length The length of every block, e.g. computed by seqan3::detail::optimum_blocks_length; all
+ *                          lengths must be greater than 0.
+ * \param[in] query_length  The new query length; must be at least the sum of `blocks_length`.
+ * \returns The length of every block, ordered by block id, such that the lengths sum up to `query_length`.
+ *
+ * \details
+ *
+ * The block boundaries are scaled and rounded down, hence every block keeps a length of at least 1. This lets
+ * seqan3::detail::search_scheme_algorithm reuse the block lengths optimised for one query length for all queries of
+ * similar length.
+ *
+ * ### Complexity
+ *
+ * Linear in the number of blocks.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+inline std::vector<size_t> scale_blocks_length(std::vector<size_t> const & blocks_length, size_t const query_length)
+{
+    size_t const total_length = std::accumulate(blocks_length.begin(), blocks_length.end(), size_t{0});
+    assert(total_length > 0 && query_length >= total_length);
+
+    std::vector<size_t> scaled_blocks_length(blocks_length.size());
+    size_t cumulative_length{0};
+    size_t scaled_begin{0};
+
+    for (size_t block_id = 0; block_id < blocks_length.size(); ++block_id)
+    {
+        cumulative_length += blocks_length[block_id];
+        // cumulative_length <= query_length, so the product does not overflow for query lengths below 2^32.
+        size_t const scaled_end = cumulative_length * query_length / total_length;
+        scaled_blocks_length[block_id] = scaled_end - scaled_begin;
+        scaled_begin = scaled_end;
+    }
+
+    return scaled_blocks_length;
+}
+
 /*!\brief Returns for each search the cumulative length of blocks in the order of blocks in each search and the
  *        starting position of the first block in the query sequence.
  * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \tparam blocks_length_t  Is of type `std::array` or `std::vector` of unsigned integers.
  * \param[in] search_scheme Search scheme that will be used for searching.
- * \param[in] query_length  Length of the query that will be searched in an index.
+ * \param[in] blocks_length The length of every block, ordered by block id (i.e. not cumulative).
  * \returns A range of pairs containing for each search the cumulative lengths of blocks and the starting position
  *          in the query.
  *
@@ -187,17 +473,17 @@ inline std::vector<search_dyn> compute_ss(uint8_t const min_error, uint8_t const
  *
  * Strong exception guarantee.
  */
-template <typename search_scheme_t>
-inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size_t const query_length)
+template <typename search_scheme_t, typename blocks_length_t>
+inline auto search_scheme_block_info(search_scheme_t const & search_scheme, blocks_length_t const & blocks_length)
 {
-    using blocks_length_type = typename search_scheme_t::value_type::blocks_length_type;
+    using search_blocks_length_type = typename search_scheme_t::value_type::blocks_length_type;
 
     bool constexpr is_dyn_scheme = std::same_as<search_scheme_t, search_scheme_dyn_type>;
 
     // Either store information in an array (for search schemes known at compile time) or in a vector otherwise.
     using result_type = std::conditional_t<is_dyn_scheme,
-                                           std::vector<std::tuple<blocks_length_type, size_t>>,
-                                           std::array<std::tuple<blocks_length_type, size_t>,
+                                           std::vector<std::tuple<search_blocks_length_type, size_t>>,
+                                           std::array<std::tuple<search_blocks_length_type, size_t>,
                                                       transformation_trait_or_t<std::tuple_size<search_scheme_t>,
                                                                                 std::false_type>::value>>;
 
@@ -205,20 +491,7 @@ inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size
     if constexpr (is_dyn_scheme)
         result.resize(search_scheme.size());
 
-    uint8_t const blocks      {search_scheme[0].blocks()};
-    size_t  const block_length{query_length / blocks};
-    uint8_t const rest        {static_cast<uint8_t>(query_length % blocks)};
-
-    blocks_length_type blocks_length;
-    // set all blocks_length values to block_length
-    // resp. block_length + 1 for the first `rest = block_length % blocks` values
-    if constexpr (is_dyn_scheme)
-        blocks_length.resize(blocks, block_length);
-    else
-        blocks_length.fill(block_length);
-
-    for (uint8_t block_id = 0; block_id < rest; ++block_id)
-        ++blocks_length[block_id];
+    uint8_t const blocks{search_scheme[0].blocks()};
 
     for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
     {
@@ -242,6 +515,52 @@ inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size
     return result;
 }
 
+/*!\brief Returns for each search the cumulative length of blocks in the order of blocks in each search and the
+ *        starting position of the first block in the query sequence.
+ * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \param[in] search_scheme Search scheme that will be used for searching.
+ * \param[in] query_length  Length of the query that will be searched in an index.
+ * \returns A range of pairs containing for each search the cumulative lengths of blocks and the starting position
+ *          in the query.
+ *
+ * \details
+ *
+ * The query is split into blocks of equal length. If the query length is not divisible by the number of blocks,
+ * the first `query_length % blocks` blocks are one character longer.
+ *
+ * ### Complexity
+ *
+ * Constant.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee.
+ */
+template <typename search_scheme_t>
+inline auto search_scheme_block_info(search_scheme_t const & search_scheme, size_t const query_length)
+{
+    using blocks_length_type = typename search_scheme_t::value_type::blocks_length_type;
+
+    bool constexpr is_dyn_scheme = std::same_as<search_scheme_t, search_scheme_dyn_type>;
+
+    uint8_t const blocks      {search_scheme[0].blocks()};
+    size_t  const block_length{query_length / blocks};
+    uint8_t const rest        {static_cast<uint8_t>(query_length % blocks)};
+
+    blocks_length_type blocks_length;
+    // set all blocks_length values to block_length
+    // resp. block_length + 1 for the first `rest = block_length % blocks` values
+    if constexpr (is_dyn_scheme)
+        blocks_length.resize(blocks, block_length);
+    else
+        blocks_length.fill(block_length);
+
+    for (uint8_t block_id = 0; block_id < rest; ++block_id)
+        ++blocks_length[block_id];
+
+    return search_scheme_block_info(search_scheme, blocks_length);
+}
+
 //!\cond
 // forward declaration
 template <bool abort_on_hit, typename cursor_t, typename query_t, typename search_t, typename blocks_length_t,
@@ -581,6 +900,37 @@ inline void search_ss(index_t const & index, query_t & query, search_param const
     // retrieve cumulative block lengths and starting position
     auto const block_info = search_scheme_block_info(search_scheme, std::ranges::size(query));
 
+    search_ss<abort_on_hit>(index, query, error_left, search_scheme, block_info, delegate);
+}
+
+/*!\brief Searches a query sequence in a bidirectional index using search schemes with given block lengths.
+ * \tparam abort_on_hit     If the flag is set, the search aborts on the first hit.
+ * \tparam index_t          Must model seqan3::bi_fm_index_specialisation.
+ * \tparam query_t          Must model std::ranges::random_access_range over the index's alphabet.
+ * \tparam search_scheme_t  Is of type `seqan3::detail::search_scheme_type` or `seqan3::detail::search_scheme_dyn_type`.
+ * \tparam block_info_t     The type returned by seqan3::detail::search_scheme_block_info.
+ * \tparam delegate_t       Takes `typename index_t::cursor_type` as argument.
+ * \param[in] index         String index built on the text that will be searched.
+ * \param[in] query         Query sequence to be searched in the index.
+ * \param[in] error_left    Number of errors left for matching the remaining suffix of the query sequence.
+ * \param[in] search_scheme Search scheme to be used for searching.
+ * \param[in] block_info    The cumulative block lengths and starting position of every search for this query.
+ * \param[in] delegate      Function that is called on every hit.
+ *
+ * ### Complexity
+ *
+ * \f$O(|query|^e)\f$ where \f$e\f$ is the total number of maximum errors.
+ *
+ * ### Exceptions
+ *
+ * Strong exception guarantee if iterating the query does not change its state and if invoking the delegate also has a
+ * strong exception guarantee; basic exception guarantee otherwise.
+ */
+template <bool abort_on_hit, typename index_t, typename query_t, typename search_scheme_t, typename block_info_t,
+          typename delegate_t>
+inline void search_ss(index_t const & index, query_t & query, search_param const error_left,
+                      search_scheme_t const & search_scheme, block_info_t const & block_info, delegate_t && delegate)
+{
     for (uint8_t search_id = 0; search_id < search_scheme.size(); ++search_id)
     {
         auto const & search = search_scheme[search_id];
@@ -643,9 +993,38 @@ inline void search_scheme_algorithm<configuration_t, index_t, policies_t...>::se
             search_ss<abort_on_hit>(*index_ptr, query, error_left, optimum_search_scheme<0, 3>, delegate);
             break;
         default:
-            auto const & search_scheme{compute_ss(0, error_left.total)};
-            search_ss<abort_on_hit>(*index_ptr, query, error_left, search_scheme, delegate);
+        {
+            size_t const query_length = std::ranges::size(query);
+            uint8_t const query_length_bin = (query_length == 0) ? 0 : most_significant_bit_set(query_length);
+            auto it = computed_schemes.find({error_left.total, query_length_bin});
+
+            if (it == computed_schemes.end())
+            {
+                search_scheme_dyn_type search_scheme{compute_ss(0, error_left.total)};
+                std::vector<size_t> blocks_length{};
+
+                // Optimise the block lengths for the shortest query length of the bin. Blocks must not be empty.
+                if (size_t const bin_length = size_t{1} << query_length_bin; bin_length >= search_scheme[0].blocks())
+                {
+                    blocks_length = optimum_blocks_length(search_scheme,
+                                                          bin_length,
+                                                          alphabet_size<typename index_t::alphabet_type>,
+                                                          index_ptr->size());
+                }
+
+                it = computed_schemes.emplace(std::pair{error_left.total, query_length_bin},
+                                              std::pair{std::move(search_scheme), std::move(blocks_length)}).first;
+            }
+
+            auto const & [search_scheme, bin_blocks_length] = it->second;
+            dyn_block_info_type const block_info =
+                (query_length >= search_scheme[0].blocks() && !bin_blocks_length.empty())
+                    ? search_scheme_block_info(search_scheme, scale_blocks_length(bin_blocks_length, query_length))
+                    : search_scheme_block_info(search_scheme, query_length);
+
+            search_ss<abort_on_hit>(*index_ptr, query, error_left, search_scheme, block_info, delegate);
             break;
+        }
     }
 }
 //!\}
@@ -17,6 +17,8 @@
 #include <seqan3/search/configuration/max_error_rate.hpp>
 #include <seqan3/search/configuration/hit.hpp>
 #include <seqan3/search/configuration/output.hpp>
+#include <seqan3/search/configuration/paging.hpp>
+#include <seqan3/search/configuration/verification.hpp>
 
 namespace seqan3::detail
 {
@@ -63,6 +65,18 @@ struct search_traits
         search_configuration_t::template exists<search_cfg::output<detail::search_output_text_position>>();
     //!\brief A flag indicating whether output configuration was set in the search configuration.
     static constexpr bool has_output_configuration = search_return_index_cursor | search_return_text_position;
+
+    //!\brief A flag indicating whether the candidates should be verified against the text (filter-and-verify).
+    static constexpr bool search_with_verification =
+        search_configuration_t::template exists<search_cfg::verification>();
+
+    //!\brief A flag indicating whether the text positions should be located lazily in pages.
+    static constexpr bool search_in_pages = search_configuration_t::template exists<search_cfg::page_size>() &&
+                                            search_return_text_position &&
+                                            !search_single_best_hit &&
+                                            !search_with_verification;
+    //!\brief A flag indicating whether the number of reported text positions per query is limited.
+    static constexpr bool has_max_hits = search_configuration_t::template exists<search_cfg::max_hits>();
 };
 
 } // namespace seqan3::detail
@@ -0,0 +1,333 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides an approximate string matching algorithm that seeds with an FM index and verifies the candidates
+ *        with the edit distance.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include <seqan3/core/detail/test_accessor.hpp>
+#include <seqan3/range/views/slice.hpp>
+#include <seqan3/search/detail/search_common.hpp>
+#include <seqan3/search/detail/search_traits.hpp>
+#include <seqan3/search/fm_index/concept.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup search
+ * \{
+ */
+
+/*!\brief The algorithm that searches a query by exact seeds in an FM index and verifies the candidates in the text.
+ * \tparam configuration_t The search configuration type; must contain seqan3::search_cfg::verification.
+ * \tparam index_t The type of index; must model seqan3::fm_index_specialisation.
+ *
+ * \details
+ *
+ * For a query with at most \f$e\f$ errors, the query is split into \f$e + 1\f$ pieces of (almost) equal length.
+ * Every piece is searched exactly in the index and each occurrence of a piece yields a candidate start position of
+ * the query in the text. Candidates whose start positions differ by at most \f$e\f$ are merged into one region,
+ * which is then verified with the semi-global edit distance allowing at most \f$e\f$ errors.
+ *
+ * Every text position at which an occurrence with at most \f$e\f$ errors begins is reported once with the fewest
+ * errors of its occurrences, which are the same text positions as reported by the backtracking algorithms.
+ *
+ * In contrast to the backtracking algorithms the runtime does not grow exponentially with the number of errors,
+ * but linearly with the number of candidates.
+ */
+template <typename configuration_t, fm_index_specialisation index_t, typename ...policies_t>
+class verification_search_algorithm : protected policies_t...
+{
+private:
+    //!\brief The search configuration traits.
+    using traits_t = search_traits<configuration_t>;
+    //!\brief The size type of the index.
+    using size_type = typename index_t::size_type;
+    //!\brief The type of the text that is used for the verification.
+    using text_type = std::remove_const_t<std::remove_pointer_t<
+                          decltype(seqan3::get<search_cfg::verification>(std::declval<configuration_t>()).value)>>;
+
+    static_assert(traits_t::search_with_verification,
+                  "The configuration must contain seqan3::search_cfg::verification.");
+    static_assert(traits_t::search_return_text_position,
+                  "The filter-and-verify search can only report text positions.");
+
+    //!\brief A region of a reference sequence that needs to be verified.
+    struct candidate_region
+    {
+        //!\brief The id of the reference sequence.
+        size_type reference_id{};
+        //!\brief The begin position of the region in the reference sequence.
+        size_type begin_pos{};
+        //!\brief The end position (exclusive) of the region in the reference sequence.
+        size_type end_pos{};
+    };
+
+public:
+    /*!\name Constructors, destructor and assignment
+     * \{
+     */
+    verification_search_algorithm() = default; //!< Defaulted.
+    verification_search_algorithm(verification_search_algorithm const &) = default; //!< Defaulted.
+    verification_search_algorithm(verification_search_algorithm &&) = default; //!< Defaulted.
+    verification_search_algorithm & operator=(verification_search_algorithm const &) = default; //!< Defaulted.
+    verification_search_algorithm & operator=(verification_search_algorithm &&) = default; //!< Defaulted.
+    ~verification_search_algorithm() = default; //!< Defaulted.
+
+    /*!\brief Constructs from a configuration object and an index.
+     * \tparam configuration_t The search configuration type.
+     * \tparam index_t The type of index; must model seqan3::fm_index_specialisation.
+     * \param[in] cfg The configuration object that guides the search algorithm.
+     * \param[in] index The index used in the algorithm.
+     */
+    verification_search_algorithm(configuration_t const & cfg, index_t const & index) : policies_t{}...
+    {
+        config = cfg;
+        index_ptr = &index;
+        text_ptr = get<search_cfg::verification>(config).value;
+    }
+    //!\}
+
+    /*!\brief Searches a query sequence by seeding in the index and verifying the candidates in the text.
+     * \tparam query_t The type of the query sequence to search; must model std::ranges::random_access_range over the
+     *                 index's alphabet.
+     * \param[in] query Query sequence to be searched in the index.
+     *
+     * ### Complexity
+     *
+     * \f$O(|query|^2 \cdot c)\f$ in the worst case and \f$O(e \cdot |query| \cdot c)\f$ expected, where \f$e\f$ is
+     * the maximum number of errors and \f$c\f$ the number of candidate regions.
+     */
+    template <typename query_t>
+    auto operator()(query_t && query)
+    {
+        auto error_state = this->max_error_counts(config, query); // see policy_max_error
+
+        std::vector<verified_hit<size_type>> verified_hits{};
+
+        if (!std::ranges::empty(query))
+        {
+            for (candidate_region const & region : candidate_regions(query, error_state.total))
+                verify(region, query, error_state.total, verified_hits);
+
+            filter_by_hit_strategy(verified_hits, error_state.total);
+        }
+
+        return this->make_verified_results(std::move(verified_hits), config); // see policy_result_builder
+    }
+
+private:
+    //!\brief The configuration object.
+    configuration_t config{};
+
+    //!\brief A pointer to the fm index which is used to search the seeds.
+    index_t const * index_ptr{nullptr};
+
+    //!\brief A pointer to the text which is used to verify the candidates.
+    text_type const * text_ptr{nullptr};
+
+    //!\brief The current column of the edit distance matrix, reused for all candidate regions.
+    std::vector<size_t> verification_column{};
+
+    //!\brief Returns the reference sequence with the given id.
+    decltype(auto) reference_sequence([[maybe_unused]] size_type const reference_id) const
+    {
+        if constexpr (index_t::text_layout_mode == text_layout::single)
+            return (*text_ptr);
+        else
+            return (*text_ptr)[reference_id];
+    }
+
+    //!\brief Returns the number of reference sequences.
+    size_type reference_count() const
+    {
+        if constexpr (index_t::text_layout_mode == text_layout::single)
+            return 1u;
+        else
+            return std::ranges::size(*text_ptr);
+    }
+
+    /*!\brief Searches the pieces of the query exactly and returns the merged candidate regions.
+     * \tparam query_t Must model std::ranges::random_access_range over the index's alphabet.
+     * \param[in] query The query sequence.
+     * \param[in] max_errors The maximal number of errors.
+     * \returns The candidate regions sorted by reference id and position.
+     */
+    template <typename query_t>
+    std::vector<candidate_region> candidate_regions(query_t & query, uint8_t const max_errors) const
+    {
+        size_t const query_length = std::ranges::size(query);
+        std::vector<candidate_region> regions{};
+
+        // If there are more errors than characters, there is no error-free piece left: every reference sequence is a
+        // candidate.
+        if (query_length <= max_errors)
+        {
+            for (size_type reference_id = 0; reference_id < reference_count(); ++reference_id)
+                regions.push_back({reference_id, 0u, std::ranges::size(reference_sequence(reference_id))});
+
+            return regions;
+        }
+
+        // Pigeonhole principle: one of the max_errors + 1 pieces must occur without an error.
+        std::vector<std::pair<size_type, size_type>> candidates{};
+        size_t const piece_count = max_errors + 1u;
+
+        for (size_t piece = 0; piece < piece_count; ++piece)
+        {
+            size_t const piece_begin = piece * query_length / piece_count;
+            size_t const piece_end = (piece + 1) * query_length / piece_count;
+
+            auto cur = index_ptr->cursor();
+            if (!cur.extend_right(query | views::slice(piece_begin, piece_end)))
+                continue;
+
+            for (auto && [reference_id, reference_pos] : cur.locate())
+                candidates.emplace_back(reference_id, (reference_pos > piece_begin) ? reference_pos - piece_begin : 0u);
+        }
+
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        // Merge candidates that start within max_errors positions of each other. They belong to the same occurrence,
+        // shifted by insertions or deletions in front of the piece.
+        size_type first_in_region{};
+        for (auto const & [reference_id, begin_pos] : candidates)
+        {
+            size_type const reference_length = std::ranges::size(reference_sequence(reference_id));
+            size_type const end_pos = std::min<size_type>(reference_length, begin_pos + query_length + max_errors);
+
+            if (!regions.empty() &&
+                regions.back().reference_id == reference_id &&
+                begin_pos <= first_in_region + max_errors)
+            {
+                regions.back().end_pos = end_pos;
+            }
+            else
+            {
+                first_in_region = begin_pos;
+                regions.push_back({reference_id, (begin_pos > max_errors) ? begin_pos - max_errors : 0u, end_pos});
+            }
+        }
+
+        return regions;
+    }
+
+    /*!\brief Verifies a candidate region and adds a hit for every text position an occurrence begins at.
+     * \tparam query_t Must model std::ranges::random_access_range over the index's alphabet.
+     * \param[in] region The candidate region of the text.
+     * \param[in] query The query sequence.
+     * \param[in] max_errors The maximal number of errors.
+     * \param[in, out] verified_hits The hits to add the occurrences of the region to.
+     *
+     * \details
+     *
+     * The query is aligned backwards against the region with the semi-global edit distance, such that every column of
+     * the dynamic programming matrix belongs to the begin position of an occurrence. A text position is a hit if an
+     * alignment with at most `max_errors` errors begins there with a match, a mismatch or a deleted query symbol.
+     * Alignments that begin with an inserted text symbol are found at the next text position with one error less.
+     * Only the rows of a column that can have at most `max_errors` errors are computed (Ukkonen's cut-off).
+     *
+     * If an occurrence exceeds the region, its begin position might be reported with too many errors or not at all.
+     * The occurrence is then reported by the region of one of its error-free pieces, which contains it completely.
+     */
+    template <typename query_t>
+    void verify(candidate_region const & region,
+                query_t & query,
+                uint8_t const max_errors,
+                std::vector<verified_hit<size_type>> & verified_hits)
+    {
+        auto window = reference_sequence(region.reference_id) | views::slice(region.begin_pos, region.end_pos);
+
+        size_t const query_length = std::ranges::size(query);
+        size_t const too_many_errors = max_errors + 1u;
+
+        // The row r stores the errors of the query suffix of length r; more than max_errors errors are capped.
+        std::vector<size_t> & column = verification_column;
+        column.resize(query_length + 1u);
+        for (size_t row = 0; row <= query_length; ++row)
+            column[row] = std::min(row, too_many_errors);
+
+        // All rows below the last active row have more than max_errors errors.
+        size_t last_active_row = std::min<size_t>(query_length, max_errors);
+
+        for (size_t position = std::ranges::size(window); position-- > 0;)
+        {
+            auto const text_symbol = window[position];
+            size_t const last_row = std::min(query_length, last_active_row + 1u);
+            // The errors of the query suffix without the first symbol, which ends before the current position.
+            size_t const suffix_errors = column[query_length - 1u];
+            size_t diagonal = 0u;
+
+            for (size_t row = 1; row <= last_row; ++row)
+            {
+                size_t const mismatch = (query[query_length - row] == text_symbol) ? 0u : 1u;
+                size_t const cell = std::min({diagonal + mismatch, column[row] + 1u, column[row - 1] + 1u});
+
+                diagonal = column[row];
+                column[row] = std::min(cell, too_many_errors);
+            }
+
+            for (last_active_row = last_row; column[last_active_row] > max_errors; --last_active_row)
+            {} // The first row has no errors.
+
+            // The first query symbol is either aligned to the current text symbol or deleted.
+            size_t const mismatch = (query[0] == text_symbol) ? 0u : 1u;
+            size_t const errors = std::min(suffix_errors + mismatch, column[query_length - 1u] + 1u);
+
+            if (errors <= max_errors)
+            {
+                verified_hits.push_back(verified_hit<size_type>{region.reference_id,
+                                                                region.begin_pos + static_cast<size_type>(position),
+                                                                static_cast<uint8_t>(errors)});
+            }
+        }
+    }
+
+    /*!\brief Removes the hits that are not reported by the search strategy (hit configuration).
+     * \param[in, out] verified_hits The verified hits.
+     * \param[in] max_errors The maximal number of errors.
+     */
+    void filter_by_hit_strategy(std::vector<verified_hit<size_type>> & verified_hits,
+                                [[maybe_unused]] uint8_t const max_errors) const
+    {
+        if constexpr (!traits_t::search_all_hits)
+        {
+            if (verified_hits.empty())
+                return;
+
+            auto fewer_errors = [] (auto const & h1, auto const & h2) { return h1.errors < h2.errors; };
+            uint8_t allowed_errors = std::min_element(verified_hits.begin(), verified_hits.end(), fewer_errors)->errors;
+
+            if constexpr (traits_t::search_strata_hits)
+            {
+                uint8_t const stratum = get<search_cfg::hit_strata>(config).value;
+                allowed_errors = std::min<size_t>(max_errors, allowed_errors + stratum);
+            }
+
+            auto too_many_errors = [allowed_errors] (auto const & hit) { return hit.errors > allowed_errors; };
+            verified_hits.erase(std::remove_if(verified_hits.begin(), verified_hits.end(), too_many_errors),
+                                verified_hits.end());
+        }
+    }
+
+    //!\brief Befriend seqan3::detail::test_accessor to grant access to layout.
+    friend struct ::seqan3::detail::test_accessor;
+};
+
+//!\}
+
+} // namespace seqan3::detail
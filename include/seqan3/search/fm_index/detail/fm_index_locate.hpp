@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::detail::locate_sa_interval, a batched suffix array lookup for the FM indices.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <seqan3/core/platform.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/concepts>
+
+namespace seqan3::detail
+{
+
+/*!\addtogroup submodule_fm_index
+ * \{
+ */
+
+/*!\interface seqan3::detail::sdsl_index_with_sa_sample <>
+ * \brief Whether the SDSL index exposes its suffix array samples and the LF-mapping.
+ */
+//!\cond
+template <typename t>
+SEQAN3_CONCEPT sdsl_index_with_sa_sample = requires (t const & sdsl_index, typename t::size_type const i)
+{
+    { sdsl_index.sa_sample.is_sampled(i) } -> bool;
+    { sdsl_index.sa_sample[i] };
+    { sdsl_index.lf[i] } -> typename t::size_type;
+};
+//!\endcond
+
+/*!\brief Looks up the suffix array values of a consecutive suffix array interval.
+ * \tparam sdsl_index_t The type of the SDSL index; must model seqan3::detail::sdsl_index.
+ * \tparam callback_t   The type of the callback; must model std::invocable with `sdsl_index_t::size_type` twice.
+ * \param[in] csa       The SDSL index.
+ * \param[in] lb        The first suffix array position of the interval.
+ * \param[in] count     The number of suffix array positions in the interval.
+ * \param[in] callback  Invoked with the offset into the interval and the text position of every suffix array entry.
+ *
+ * \details
+ *
+ * Every unsampled suffix array value is recovered by walking the LF-mapping until a sampled position is hit.
+ * A single walk is a chain of dependent random memory accesses into the wavelet tree, so resolving the positions one
+ * after the other (as `csa[i]` does) leaves the CPU waiting for one cache miss at a time.
+ * This function instead advances up to `batch_size` independent walks in lockstep and drops every walk from the batch
+ * as soon as it reaches a sample. The LF-steps of different walks do not depend on each other and can be in flight at
+ * the same time, which hides most of the memory latency for large intervals, i.e. for repetitive queries.
+ *
+ * The callback is not necessarily invoked in order of the suffix array positions.
+ *
+ * ### Complexity
+ *
+ * \f$count \cdot O(T_{BACKWARD\_SEARCH} \cdot SAMPLING\_RATE)\f$
+ *
+ * ### Exceptions
+ *
+ * Throws if the callback throws.
+ */
+template <typename sdsl_index_t, typename callback_t>
+inline void locate_sa_interval(sdsl_index_t const & csa,
+                               typename sdsl_index_t::size_type const lb,
+                               typename sdsl_index_t::size_type const count,
+                               callback_t && callback)
+{
+    using size_type = typename sdsl_index_t::size_type;
+
+    if constexpr (sdsl_index_with_sa_sample<sdsl_index_t>)
+    {
+        constexpr uint8_t batch_size = 32;
+        size_type const text_size = csa.size();
+
+        std::array<size_type, batch_size> sa_position;
+        std::array<size_type, batch_size> steps;
+        std::array<uint8_t, batch_size> active_lanes;
+
+        for (size_type batch_begin = 0; batch_begin < count; batch_begin += batch_size)
+        {
+            uint8_t active_count = static_cast<uint8_t>(std::min<size_type>(batch_size, count - batch_begin));
+
+            for (uint8_t lane = 0; lane < active_count; ++lane)
+            {
+                sa_position[lane] = lb + batch_begin + lane;
+                steps[lane] = 0;
+                active_lanes[lane] = lane;
+            }
+
+            while (active_count > 0)
+            {
+                uint8_t still_active{0};
+
+                for (uint8_t k = 0; k < active_count; ++k)
+                {
+                    uint8_t const lane = active_lanes[k];
+
+                    if (csa.sa_sample.is_sampled(sa_position[lane]))
+                    {
+                        size_type text_position = static_cast<size_type>(csa.sa_sample[sa_position[lane]]) +
+                                                  steps[lane];
+                        if (text_position >= text_size) // wrapped around the sentinel
+                            text_position -= text_size;
+
+                        callback(batch_begin + lane, text_position);
+                    }
+                    else
+                    {
+                        sa_position[lane] = csa.lf[sa_position[lane]];
+                        ++steps[lane];
+                        active_lanes[still_active++] = lane;
+                    }
+                }
+
+                active_count = still_active;
+            }
+        }
+    }
+    else // fall back to the lookup of the SDSL index
+    {
+        for (size_type i = 0; i < count; ++i)
+            callback(i, static_cast<size_type>(csa[lb + i]));
+    }
+}
+
+//!\}
+
+} // namespace seqan3::detail
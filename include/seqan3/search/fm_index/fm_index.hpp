@@ -83,6 +83,38 @@ using sdsl_wt_index_type =
                  sdsl::isa_sampling<>,
                  sdsl::plain_byte_alphabet>;
 
+/*!\brief The FM Index Configuration using a Wavelet Tree with a configurable suffix array sampling.
+ * \tparam sa_sampling_rate       Every `sa_sampling_rate`-th suffix array value is stored in the index.
+ * \tparam sa_sampling_strategy_t Which suffix array values are stored; either sdsl::sa_order_sa_sampling<> or
+ *                                sdsl::text_order_sa_sampling<>.
+ *
+ * \details
+ *
+ * This is the same configuration as seqan3::sdsl_wt_index_type, but the suffix array sampling can be chosen at
+ * construction time to trade memory for locate speed. Locating a single occurrence has to walk the LF-mapping until
+ * it reaches a sampled suffix array value, i.e. the sampling rate is the expected number of backward search steps
+ * per located occurrence. Storing the samples takes \f$\frac{n \log n}{SAMPLING\_RATE}\f$ bits.
+ *
+ * * sdsl::sa_order_sa_sampling<> stores \f$SA[i]\f$ for every \f$i \bmod SAMPLING\_RATE = 0\f$. Checking whether a
+ *   position is sampled is cheap, but the number of steps per located occurrence is only bounded on average.
+ * * sdsl::text_order_sa_sampling<> stores \f$SA[i]\f$ for every \f$SA[i] \bmod SAMPLING\_RATE = 0\f$. It
+ *   additionally needs a bit vector of length \f$n\f$ marking the sampled positions, but guarantees less than
+ *   \f$SAMPLING\_RATE\f$ steps per located occurrence, which is beneficial for repetitive texts.
+ *
+ * \include test/snippet/search/fm_index_sampling.cpp
+ */
+template <size_t sa_sampling_rate = 16, typename sa_sampling_strategy_t = sdsl::sa_order_sa_sampling<>>
+using sdsl_wt_sampled_index_type =
+    sdsl::csa_wt<sdsl::wt_blcd<sdsl::bit_vector,
+                               sdsl::rank_support_v<>,
+                               sdsl::select_support_scan<>,
+                               sdsl::select_support_scan<0>>,
+                 sa_sampling_rate,
+                 10'000'000,
+                 sa_sampling_strategy_t,
+                 sdsl::isa_sampling<>,
+                 sdsl::plain_byte_alphabet>;
+
 /*!\brief The default FM Index Configuration.
  * \attention The default might be changed in a future release. If you rely on a stable API and on-disk-format,
  *            please hard-code your sdsl_index_type to a concrete type.
@@ -24,6 +24,7 @@
 #include <seqan3/core/type_traits/range.hpp>
 #include <seqan3/range/views/slice.hpp>
 #include <seqan3/search/fm_index/detail/fm_index_cursor.hpp>
+#include <seqan3/search/fm_index/detail/fm_index_locate.hpp>
 #include <seqan3/search/fm_index/fm_index.hpp>
 #include <seqan3/std/ranges>
 
@@ -541,39 +542,63 @@ public:
      * Strong exception guarantee (no data is modified in case an exception is thrown).
      */
     locate_result_type locate() const
+    {
+        return locate(0, count());
+    }
+
+    /*!\brief Locates a part of the occurrences of the searched query in the text.
+     * \param[in] first  The first occurrence to locate, i.e. the offset into the suffix array interval of the cursor.
+     * \param[in] length The number of occurrences to locate.
+     * \returns Positions in the text.
+     *
+     * \details
+     *
+     * Locating all occurrences of a highly repetitive query at once might need a lot of memory. This overload allows
+     * to locate the occurrences in several steps. The order of the occurrences is the same as in locate().
+     * `first + length` must not be greater than count().
+     *
+     * ### Complexity
+     *
+     * \f$length * O(T_{BACKWARD\_SEARCH} * SAMPLING\_RATE)\f$
+     *
+     * ### Exceptions
+     *
+     * Strong exception guarantee (no data is modified in case an exception is thrown).
+     */
+    locate_result_type locate(size_type const first, size_type const length) const
     //!\cond
         requires (index_t::text_layout_mode == text_layout::single)
     //!\endcond
     {
-        assert(index != nullptr);
+        assert(index != nullptr && first + length <= count());
 
-        locate_result_type occ{};
-        occ.reserve(count());
-        for (size_type i = 0; i < count(); ++i)
+        locate_result_type occ(length);
+        detail::locate_sa_interval(index->index, node.lb + first, length,
+                                   [&occ, _offset = offset()] (size_type const i, size_type const sa_value)
         {
-            occ.emplace_back(0, offset() - index->index[node.lb + i]);
-        }
+            occ[i] = locate_result_value_type{0u, _offset - sa_value};
+        });
 
         return occ;
     }
 
     //!\overload
-    locate_result_type locate() const
+    locate_result_type locate(size_type const first, size_type const length) const
     //!\cond
         requires (index_t::text_layout_mode == text_layout::collection)
     //!\endcond
     {
-        assert(index != nullptr);
+        assert(index != nullptr && first + length <= count());
 
-        locate_result_type occ;
-        occ.reserve(count());
-        for (size_type i = 0; i < count(); ++i)
+        locate_result_type occ(length);
+        detail::locate_sa_interval(index->index, node.lb + first, length,
+                                   [this, &occ, _offset = offset()] (size_type const i, size_type const sa_value)
         {
-            size_type loc = offset() - index->index[node.lb + i];
+            size_type loc = _offset - sa_value;
             size_type sequence_rank = index->text_begin_rs.rank(loc + 1);
             size_type sequence_position = loc - index->text_begin_ss.select(sequence_rank);
-            occ.emplace_back(sequence_rank - 1, sequence_position);
-        }
+            occ[i] = locate_result_value_type{sequence_rank - 1, sequence_position};
+        });
         return occ;
     }
 
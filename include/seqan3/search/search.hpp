@@ -24,6 +24,7 @@
 #include <seqan3/search/detail/unidirectional_search_algorithm.hpp>
 #include <seqan3/search/detail/search_scheme_algorithm.hpp>
 #include <seqan3/search/detail/search_traits.hpp>
+#include <seqan3/search/detail/verification_search_algorithm.hpp>
 #include <seqan3/search/search_result_range.hpp>
 
 namespace seqan3::detail
@@ -104,14 +105,23 @@ struct search_configurator
      *
      * \details
      *
-     * If the `index_t` models seqan3::bi_fm_index_specialisation, then the
+     * If seqan3::search_cfg::verification was set, the seqan3::detail::verification_search_algorithm is chosen
+     * for any index. Otherwise, if the `index_t` models seqan3::bi_fm_index_specialisation, then the
      * seqan3::detail::search_scheme_algorithm is chosen. Otherwise, the
      * detail::unidirectional_search_algorithm is chosen.
      */
     template <typename configuration_t, typename index_t>
     static auto configure_algorithm(configuration_t const & cfg, index_t const & index)
     {
-        if constexpr (bi_fm_index_specialisation<index_t>)
+        if constexpr (search_traits<configuration_t>::search_with_verification)
+        {
+            using algorithm_t = verification_search_algorithm<configuration_t,
+                                                              index_t,
+                                                              policy_max_error,
+                                                              policy_result_builder>;
+            return algorithm_t{cfg, index};
+        }
+        else if constexpr (bi_fm_index_specialisation<index_t>)
         {
             using algorithm_t = search_scheme_algorithm<configuration_t,
                                                         index_t,
@@ -179,6 +189,29 @@ struct search_configuration_validator
         }
     }
 
+    /*!\brief Validates the page size configuration.
+     *
+     * \tparam configuration_t The type of the search configuration.
+     *
+     * \param[in] cfg The configuration to validate.
+     *
+     * \throws std::invalid_argument
+     *
+     * \details
+     *
+     * Checks that the configured seqan3::search_cfg::page_size is greater than `0`. Otherwise throws
+     * std::invalid_argument.
+     */
+    template <typename configuration_t>
+    static void validate_page_size_configuration([[maybe_unused]] configuration_t const & cfg)
+    {
+        if constexpr (configuration_t::template exists<search_cfg::page_size>())
+        {
+            if (get<search_cfg::page_size>(cfg).value == 0)
+                throw std::invalid_argument{"The page size must be greater than 0."};
+        }
+    }
+
     /*!\brief Validates the query type to model std::ranges::random_access_range and std::ranges::sized_range.
      *
      * \tparam query_t The type of the query or range of queries.
@@ -256,6 +289,7 @@ inline auto search(queries_t && queries,
 
     detail::search_configuration_validator::validate_query_type<queries_t>();
     detail::search_configuration_validator::validate_error_configuration(updated_cfg);
+    detail::search_configuration_validator::validate_page_size_configuration(updated_cfg);
 
     auto algorithm = detail::search_configurator::configure_algorithm(updated_cfg, index);
 
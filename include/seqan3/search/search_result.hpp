@@ -25,6 +25,10 @@ namespace seqan3::detail
 {
 // forward declaration
 struct policy_result_builder;
+
+// forward declaration
+template <typename index_cursor_t>
+class search_result_pager;
 }
 
 namespace seqan3
@@ -96,6 +100,9 @@ private:
     //!\cond
     // Grant the policy access to private constructors.
     friend detail::policy_result_builder;
+    // Grant the pager access to private constructors.
+    template <typename index_cursor_t>
+    friend class detail::search_result_pager;
     // Currently, the query id is set within the search result range. This needs to be adapted.
     template <typename search_algorithm_t, typename query_range_t>
     friend class search_result_range;
@@ -12,8 +12,10 @@
 
 #pragma once
 
+#include <seqan3/core/type_traits/template_inspection.hpp>
 #include <seqan3/range/views/single_pass_input.hpp>
 #include <seqan3/range/views/zip.hpp>
+#include <seqan3/search/detail/search_result_pager.hpp>
 #include <seqan3/std/concepts>
 #include <seqan3/std/ranges>
 
@@ -32,6 +34,10 @@ namespace seqan3
  * \details
  *
  * Provides a lazy input-range interface over seqan3::search_result generated by the underlying search algorithm.
+ *
+ * If the search algorithm returns a seqan3::detail::search_result_pager (see seqan3::search_cfg::page_size), only
+ * one page of search results is buffered at a time and the next page is located once the current one has been
+ * consumed.
  */
 template <typename search_algorithm_t, std::ranges::view query_range_t>
 //!\cond
@@ -47,8 +53,10 @@ private:
     using query_t = std::ranges::range_value_t<query_range_t>;
     //!\brief The type of the buffer returned by invoking the search on a single query.
     using hit_range_t = std::invoke_result_t<search_algorithm_t, query_t &>;
+    //!\brief Whether the search returns a seqan3::detail::search_result_pager instead of all hits at once.
+    static constexpr bool is_paged = detail::is_type_specialisation_of_v<hit_range_t, detail::search_result_pager>;
     //!\brief The value type of the buffer returned by invoking the search on a single query.
-    using result_buffer_value_t = std::ranges::range_value_t<hit_range_t>;
+    using result_buffer_value_t = typename detail::search_hit_value<hit_range_t>::type;
     //!\brief The type of the buffer used to store the hits.
     using result_buffer_t = std::vector<result_buffer_value_t>;
     //!\brief The wrapped query_range_t to add single pass behaviour.
@@ -129,25 +137,63 @@ private:
     {
         result_buffer.clear();
 
+        if constexpr (is_paged)
+        {
+            if (!pager.exhausted())
+                return next_page();
+        }
+
         if (at_end())
             return false;
 
         auto current_query_it = single_pass_query_range.begin();
         auto && [query_id, query] = *current_query_it;
 
-        for (auto res : search_algorithm(query))
+        if constexpr (is_paged)
         {
-            res.query_id_ = query_id;
-            result_buffer.push_back(std::move(res));
+            pager = search_algorithm(query);
+            current_query_id = query_id;
+            ++current_query_it;
+            return next_page();
         }
+        else
+        {
+            for (auto res : search_algorithm(query))
+            {
+                res.query_id_ = query_id;
+                result_buffer.push_back(std::move(res));
+            }
+
+            ++current_query_it;
+            return !std::ranges::empty(result_buffer);
+        }
+    }
+
+    /*!\brief Locates the next page of search results of the current query.
+     *
+     * \returns `true` if the page contains at least one hit, otherwise `false`.
+     */
+    bool next_page()
+    {
+        pager.fill_page(result_buffer);
+
+        for (auto & res : result_buffer)
+            res.query_id_ = current_query_id;
 
-        ++current_query_it;
         return !std::ranges::empty(result_buffer);
     }
 
-    //!\brief Returns `true` if all queries in the underlying query range have been processed, otherwise false.
+    /*!\brief Returns `true` if all queries in the underlying query range have been processed and all their results
+     *        have been located, otherwise false.
+     */
     bool at_end() noexcept
     {
+        if constexpr (is_paged)
+        {
+            if (!pager.exhausted())
+                return false;
+        }
+
         return single_pass_query_range.begin() == single_pass_query_range.end();
     }
 
@@ -157,6 +203,10 @@ private:
     single_pass_query_range_t single_pass_query_range{};
     //!\brief Stores the current search results.
     result_buffer_t result_buffer{};
+    //!\brief Locates the results of the current query page by page (only used if #is_paged is `true`).
+    std::conditional_t<is_paged, hit_range_t, detail::empty_type> pager{};
+    //!\brief The id of the query whose results are located by the #pager.
+    size_t current_query_id{};
     //!\brief A flag that indicates whether begin was already called.
     bool first_call_of_begin{true};
 };
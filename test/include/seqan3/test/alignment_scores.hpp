@@ -0,0 +1,53 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::test::expect_same_alignment_scores to compare the scores of two alignment configurations.
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::test
+{
+
+/*!\brief Computes the alignment scores of the given sequence pairs.
+ * \param[in] sequence_pairs The sequence pairs to align.
+ * \param[in] config         The alignment configuration.
+ * \returns The scores ordered by the position of the sequence pair, independent of the order of the results.
+ */
+template <typename sequence_pairs_t, typename config_t>
+std::vector<int32_t> alignment_scores(sequence_pairs_t const & sequence_pairs, config_t const & config)
+{
+    std::vector<int32_t> scores(std::ranges::size(sequence_pairs));
+
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+        scores[result.id()] = result.score();
+
+    return scores;
+}
+
+/*!\brief Checks that both configurations compute the same scores for all given sequence pairs.
+ * \param[in] sequence_pairs  The sequence pairs to align.
+ * \param[in] expected_config The configuration computing the expected scores, e.g. with the scalar algorithm.
+ * \param[in] config          The configuration to test.
+ */
+template <typename sequence_pairs_t, typename expected_config_t, typename config_t>
+void expect_same_alignment_scores(sequence_pairs_t const & sequence_pairs,
+                                  expected_config_t const & expected_config,
+                                  config_t const & config)
+{
+    EXPECT_EQ(alignment_scores(sequence_pairs, config), alignment_scores(sequence_pairs, expected_config));
+}
+
+} // namespace seqan3::test
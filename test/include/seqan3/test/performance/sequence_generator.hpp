@@ -13,6 +13,8 @@
 #pragma once
 
 #include <random>
+#include <string>
+#include <string_view>
 
 #include <seqan3/alphabet/concept.hpp>
 #include <seqan3/std/algorithm>
@@ -72,6 +74,17 @@ auto generate_numeric_sequence(size_t const len = 500,
     return sequence;
 }
 
+// Draws the characters uniformly from the given characters, e.g. to test the conversion of arbitrary characters.
+inline std::string generate_chars(std::string_view const characters, size_t const len, size_t const seed = 0)
+{
+    std::vector<size_t> const positions = generate_numeric_sequence<size_t>(len, 0, characters.size() - 1, seed);
+
+    std::string chars(len, ' ');
+    std::ranges::transform(positions, chars.begin(), [characters] (size_t const i) { return characters[i]; });
+
+    return chars;
+}
+
 template <typename alphabet_t>
 auto generate_sequence_pairs(size_t const sequence_length,
                              size_t const set_size,
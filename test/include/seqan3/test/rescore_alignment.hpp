@@ -0,0 +1,98 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+/*!\file
+ * \brief Provides seqan3::test::rescore_alignment to check the alignments computed by the pairwise alignment.
+ */
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <seqan3/alphabet/gap/gap.hpp>
+#include <seqan3/std/ranges>
+
+namespace seqan3::test
+{
+
+//!\brief The result of seqan3::test::rescore_alignment.
+template <typename alphabet_t>
+struct rescored_alignment
+{
+    //!\brief The score of the alignment.
+    int32_t score{};
+    //!\brief The first aligned sequence without gaps.
+    std::vector<alphabet_t> sequence1{};
+    //!\brief The second aligned sequence without gaps.
+    std::vector<alphabet_t> sequence2{};
+    //!\brief The lowest diagonal (column minus row) of the alignment matrix the alignment passes through.
+    int64_t lowest_diagonal{};
+    //!\brief The highest diagonal (column minus row) of the alignment matrix the alignment passes through.
+    int64_t highest_diagonal{};
+};
+
+/*!\brief Recomputes the score of a gapped alignment with an affine gap scheme and removes its gaps.
+ * \tparam alphabet_t The alphabet of the aligned sequences.
+ * \param[in] alignment      The pair of aligned sequences.
+ * \param[in] scoring_scheme The scoring scheme for the aligned symbols.
+ * \param[in] gap_open       The additional score for opening a gap.
+ * \param[in] gap_extension  The score of every gap symbol.
+ *
+ * \details
+ *
+ * Expects that both aligned sequences have the same size and that no column consists of two gaps. The diagonals are
+ * relative to the first aligned symbols, i.e. the alignment starts on diagonal 0.
+ */
+template <typename alphabet_t, typename alignment_t, typename scoring_scheme_t>
+rescored_alignment<alphabet_t> rescore_alignment(alignment_t const & alignment,
+                                                 scoring_scheme_t const & scoring_scheme,
+                                                 int32_t const gap_open,
+                                                 int32_t const gap_extension)
+{
+    auto const & [aligned1, aligned2] = alignment;
+    EXPECT_EQ(std::ranges::size(aligned1), std::ranges::size(aligned2));
+
+    rescored_alignment<alphabet_t> result{};
+    bool gap_in_first = false;
+    bool gap_in_second = false;
+
+    auto it2 = std::ranges::begin(aligned2);
+    for (auto it1 = std::ranges::begin(aligned1);
+         it1 != std::ranges::end(aligned1) && it2 != std::ranges::end(aligned2);
+         ++it1, ++it2)
+    {
+        bool const is_gap1 = (*it1 == gap{});
+        bool const is_gap2 = (*it2 == gap{});
+        EXPECT_FALSE(is_gap1 && is_gap2);
+
+        if (!is_gap1)
+            result.sequence1.push_back((*it1).template convert_to<alphabet_t>());
+        if (!is_gap2)
+            result.sequence2.push_back((*it2).template convert_to<alphabet_t>());
+
+        if (is_gap1)
+            result.score += gap_extension + (gap_in_first ? 0 : gap_open);
+        else if (is_gap2)
+            result.score += gap_extension + (gap_in_second ? 0 : gap_open);
+        else
+            result.score += scoring_scheme.score(result.sequence1.back(), result.sequence2.back());
+
+        int64_t const diagonal = static_cast<int64_t>(result.sequence1.size()) -
+                                 static_cast<int64_t>(result.sequence2.size());
+        result.lowest_diagonal = std::min(result.lowest_diagonal, diagonal);
+        result.highest_diagonal = std::max(result.highest_diagonal, diagonal);
+        gap_in_first = is_gap1;
+        gap_in_second = is_gap2;
+    }
+
+    return result;
+}
+
+} // namespace seqan3::test
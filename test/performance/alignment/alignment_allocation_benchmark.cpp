@@ -0,0 +1,139 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// ============================================================================
+//  global allocation counter
+// ============================================================================
+
+// Counts every call to the global operator new, which is also used by std::allocator and the aligned allocator.
+std::atomic<size_t> allocation_count{0};
+std::atomic<size_t> allocated_bytes{0};
+
+void * operator new(std::size_t size)
+{
+    ++allocation_count;
+    allocated_bytes += size;
+
+    if (void * ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void * operator new(std::size_t size, std::align_val_t alignment)
+{
+    ++allocation_count;
+    allocated_bytes += size;
+
+    size_t const align = static_cast<size_t>(alignment);
+    if (void * ptr = std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void * ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+// ============================================================================
+//  benchmark
+// ============================================================================
+
+constexpr auto affine_cfg = seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1},
+                                                                      seqan3::gap_open_score{-10}}} |
+                            seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{
+                                seqan3::match_score{4}, seqan3::mismatch_score{-5}}};
+
+constexpr auto global_cfg = seqan3::align_cfg::mode{seqan3::global_alignment} | affine_cfg;
+constexpr auto local_cfg = seqan3::align_cfg::mode{seqan3::local_alignment} | affine_cfg;
+constexpr auto banded_cfg = global_cfg |
+                            seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-20},
+                                                                        seqan3::upper_bound{20}}};
+
+// Aligns a collection of sequence pairs and reports the number of allocations and allocated bytes per alignment.
+// The first argument is the length of the sequences. The allocations needed to store the results, e.g. the aligned
+// sequences, are included in the counts.
+template <typename config_t>
+void alignment_allocations(benchmark::State & state, config_t const & config)
+{
+    using sequence_t = decltype(seqan3::test::generate_sequence<seqan3::dna4>());
+
+    size_t const sequence_length = state.range(0);
+    std::vector<std::pair<sequence_t, sequence_t>> sequence_pairs{};
+    for (size_t i = 0; i < 100; ++i)
+    {
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 10, i),
+                                    seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 10, i + 100));
+    }
+
+    size_t const allocation_count_before = allocation_count;
+    size_t const allocated_bytes_before = allocated_bytes;
+
+    for (auto _ : state)
+    {
+        for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+            benchmark::DoNotOptimize(result.score());
+    }
+
+    double const alignments = static_cast<double>(state.iterations() * sequence_pairs.size());
+    state.counters["allocations"] = (allocation_count - allocation_count_before) / alignments;
+    state.counters["bytes"] = (allocated_bytes - allocated_bytes_before) / alignments;
+}
+
+BENCHMARK_CAPTURE(alignment_allocations, global_score, global_cfg |
+                                                       seqan3::align_cfg::result{seqan3::with_score})
+    ->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(alignment_allocations, global_alignment, global_cfg |
+                                                           seqan3::align_cfg::result{seqan3::with_alignment})
+    ->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(alignment_allocations, local_score, local_cfg |
+                                                      seqan3::align_cfg::result{seqan3::with_score})
+    ->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(alignment_allocations, local_alignment, local_cfg |
+                                                          seqan3::align_cfg::result{seqan3::with_alignment})
+    ->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(alignment_allocations, banded_alignment, banded_cfg |
+                                                           seqan3::align_cfg::result{seqan3::with_alignment})
+    ->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(alignment_allocations, global_alignment_parallel, global_cfg |
+                                                                    seqan3::align_cfg::result{seqan3::with_alignment} |
+                                                                    seqan3::align_cfg::parallel{4})
+    ->Arg(100)->Arg(1000);
+
+BENCHMARK_MAIN();
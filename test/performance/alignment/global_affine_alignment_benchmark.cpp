@@ -251,6 +251,70 @@ void seqan2_affine_dna4_trace_collection(benchmark::State & state)
 BENCHMARK(seqan2_affine_dna4_trace_collection);
 #endif // SEQAN3_HAS_SEQAN2
 
+// ============================================================================
+//  affine; score and trace; dna4; low divergence
+// ============================================================================
+
+// Returns a copy of the sequence with the given number of substitutions, insertions and deletions per 1000 symbols.
+std::vector<seqan3::dna4> generate_similar_sequence(std::vector<seqan3::dna4> const & sequence,
+                                                    size_t const edits_per_mille,
+                                                    size_t const seed)
+{
+    std::mt19937 generator{seed};
+    std::uniform_int_distribution<size_t> position_distribution{0, 2999};
+    std::uniform_int_distribution<int> rank_distribution{0, 3};
+    std::vector<seqan3::dna4> similar_sequence{};
+
+    for (seqan3::dna4 const symbol : sequence)
+    {
+        size_t const position = position_distribution(generator);
+
+        if (position < edits_per_mille) // substitution
+            similar_sequence.push_back(seqan3::assign_rank_to(rank_distribution(generator), seqan3::dna4{}));
+        else if (position < 2 * edits_per_mille) // insertion
+            similar_sequence.insert(similar_sequence.end(), {seqan3::assign_rank_to(rank_distribution(generator),
+                                                                                    seqan3::dna4{}), symbol});
+        else if (position >= 3 * edits_per_mille) // no deletion
+            similar_sequence.push_back(symbol);
+    }
+
+    return similar_sequence;
+}
+
+template <typename ...align_configs_t>
+void seqan3_affine_dna4_similar(benchmark::State & state, align_configs_t && ...configs)
+{
+    size_t sequence_length = 5000;
+    auto seq1 = seqan3::test::generate_sequence<seqan3::dna4>(sequence_length, 0, 0);
+    auto seq2 = generate_similar_sequence(seq1, state.range(0), 1);
+
+    auto similar_cfg = (affine_cfg | ... | configs);
+    for (auto _ : state)
+    {
+        auto rng = align_pairwise(std::tie(seq1, seq2), similar_cfg);
+        *std::ranges::begin(rng);
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(std::views::single(std::tie(seq1, seq2)), affine_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+}
+
+// The argument is the number of edits per 1000 symbols.
+BENCHMARK_CAPTURE(seqan3_affine_dna4_similar,
+                  with_score,
+                  seqan3::align_cfg::result{seqan3::with_score})->Arg(1)->Arg(10)->Arg(50);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_similar,
+                  wavefront_with_score,
+                  seqan3::align_cfg::result{seqan3::with_score},
+                  seqan3::align_cfg::wavefront)->Arg(1)->Arg(10)->Arg(50);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_similar,
+                  with_alignment,
+                  seqan3::align_cfg::result{seqan3::with_alignment})->Arg(1)->Arg(10)->Arg(50);
+BENCHMARK_CAPTURE(seqan3_affine_dna4_similar,
+                  wavefront_with_alignment,
+                  seqan3::align_cfg::result{seqan3::with_alignment},
+                  seqan3::align_cfg::wavefront)->Arg(1)->Arg(10)->Arg(50);
+
 // ============================================================================
 //  instantiate tests
 // ============================================================================
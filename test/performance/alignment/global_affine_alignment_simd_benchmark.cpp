@@ -12,7 +12,9 @@
 #include <vector>
 
 #include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
 #include <seqan3/alphabet/aminoacid/aa20.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/range/views/to.hpp>
 #include <seqan3/range/views/zip.hpp>
@@ -104,6 +106,58 @@ BENCHMARK_CAPTURE(seqan3_affine_dna4_accelerated,
                         ->UseRealTime()
                         ->DenseRange(deviation_begin, deviation_end, deviation_step);
 
+// ============================================================================
+//  affine; score; aa27; BLOSUM62; collection
+// ============================================================================
+
+auto const affine_protein_cfg = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                               seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1},
+                                                                         seqan3::gap_open_score{-10}}} |
+                               seqan3::align_cfg::scoring{seqan3::aminoacid_scoring_scheme{
+                                   seqan3::aminoacid_similarity_matrix::BLOSUM62}};
+
+template <typename ...align_configs_t>
+void seqan3_affine_blosum62_accelerated(benchmark::State & state, align_configs_t && ...configs)
+{
+    size_t sequence_length_variance = state.range(0);
+    auto data = seqan3::test::generate_sequence_pairs<seqan3::aa27>(sequence_length,
+                                                                    set_size,
+                                                                    sequence_length_variance);
+
+    int64_t total = 0;
+    auto accelerate_config = (affine_protein_cfg | ... | configs);
+    for (auto _ : state)
+    {
+        for (auto && res : seqan3::align_pairwise(data, accelerate_config))
+            total += res.score();
+    }
+
+    state.counters["cells"] = seqan3::test::pairwise_cell_updates(data, affine_protein_cfg);
+    state.counters["CUPS"] = seqan3::test::cell_updates_per_second(state.counters["cells"]);
+    state.counters["total"] = total;
+}
+
+BENCHMARK_CAPTURE(seqan3_affine_blosum62_accelerated,
+                  scalar_with_score,
+                  seqan3::align_cfg::result{seqan3::with_score})
+                        ->UseRealTime()
+                        ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
+BENCHMARK_CAPTURE(seqan3_affine_blosum62_accelerated,
+                  simd_with_score,
+                  seqan3::align_cfg::result{seqan3::with_score, seqan3::using_score_type<int16_t>},
+                  seqan3::align_cfg::vectorise)
+                        ->UseRealTime()
+                        ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
+BENCHMARK_CAPTURE(seqan3_affine_blosum62_accelerated,
+                  simd_parallel_with_score,
+                  seqan3::align_cfg::result{seqan3::with_score, seqan3::using_score_type<int16_t>},
+                  seqan3::align_cfg::vectorise,
+                  seqan3::align_cfg::parallel{get_number_of_threads()})
+                        ->UseRealTime()
+                        ->DenseRange(deviation_begin, deviation_end, deviation_step);
+
 #ifdef SEQAN3_HAS_SEQAN2
 
 template <typename ...args_t>
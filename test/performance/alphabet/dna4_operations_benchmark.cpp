@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/dna4_operations.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+// The element-wise conversions through the views are compared to the bulk operations of dna4_operations.hpp.
+// state.range(0): the sequence length
+
+std::string generate_chars(size_t const size)
+{
+    return seqan3::test::generate_sequence<seqan3::dna4>(size, 0, 0) | seqan3::views::to_char
+                                                                      | seqan3::views::to<std::string>;
+}
+
+// ============================================================================
+//  char -> dna4
+// ============================================================================
+
+template <typename container_t>
+void char_to_views(benchmark::State & state)
+{
+    std::string const chars = generate_chars(state.range(0));
+    container_t sequence{};
+    sequence.resize(chars.size());
+
+    for (auto _ : state)
+    {
+        std::ranges::copy(chars | seqan3::views::char_to<seqan3::dna4>, sequence.begin());
+        benchmark::DoNotOptimize(sequence);
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(chars.size());
+}
+
+template <typename container_t>
+void char_to_bulk(benchmark::State & state)
+{
+    std::string const chars = generate_chars(state.range(0));
+    container_t sequence{};
+
+    for (auto _ : state)
+    {
+        seqan3::assign_chars_to(chars, sequence);
+        benchmark::DoNotOptimize(sequence);
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(chars.size());
+}
+
+BENCHMARK_TEMPLATE(char_to_views, std::vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(char_to_bulk, std::vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(char_to_views, seqan3::bitcompressed_vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(char_to_bulk, seqan3::bitcompressed_vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+
+// ============================================================================
+//  dna4 -> packed dna4
+// ============================================================================
+
+void pack_views(benchmark::State & state)
+{
+    std::vector<seqan3::dna4> const letters = seqan3::test::generate_sequence<seqan3::dna4>(state.range(0), 0, 0);
+    seqan3::bitcompressed_vector<seqan3::dna4> sequence{};
+    sequence.resize(letters.size());
+
+    for (auto _ : state)
+    {
+        std::ranges::copy(letters, sequence.begin());
+        benchmark::DoNotOptimize(sequence);
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(letters.size());
+}
+
+void pack_bulk(benchmark::State & state)
+{
+    std::vector<seqan3::dna4> const letters = seqan3::test::generate_sequence<seqan3::dna4>(state.range(0), 0, 0);
+    seqan3::bitcompressed_vector<seqan3::dna4> sequence{};
+
+    for (auto _ : state)
+    {
+        seqan3::assign_ranks_to(letters, sequence);
+        benchmark::DoNotOptimize(sequence);
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(letters.size());
+}
+
+BENCHMARK(pack_views)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK(pack_bulk)->Arg(1'000)->Arg(1'000'000);
+
+// ============================================================================
+//  reverse complement
+// ============================================================================
+
+template <typename container_t>
+void reverse_complement_views(benchmark::State & state)
+{
+    container_t sequence{seqan3::test::generate_sequence<seqan3::dna4>(state.range(0), 0, 0)};
+    container_t reversed{sequence};
+
+    for (auto _ : state)
+    {
+        std::ranges::copy(sequence | std::views::reverse | seqan3::views::complement, reversed.begin());
+        std::swap(sequence, reversed);
+        benchmark::DoNotOptimize(sequence);
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(sequence.size());
+}
+
+template <typename container_t>
+void reverse_complement_bulk(benchmark::State & state)
+{
+    container_t sequence{seqan3::test::generate_sequence<seqan3::dna4>(state.range(0), 0, 0)};
+
+    for (auto _ : state)
+    {
+        seqan3::reverse_complement(sequence);
+        benchmark::DoNotOptimize(sequence);
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(sequence.size());
+}
+
+BENCHMARK_TEMPLATE(reverse_complement_views, std::vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(reverse_complement_bulk, std::vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(reverse_complement_views, seqan3::bitcompressed_vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(reverse_complement_bulk, seqan3::bitcompressed_vector<seqan3::dna4>)->Arg(1'000)->Arg(1'000'000);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,177 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/alignment_file/format_sam.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+#include <seqan3/io/alignment_file/output.hpp>
+#include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
+#include <seqan3/range/views/persist.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+using seqan3::operator""_tag;
+
+inline constexpr size_t iterations_per_run = 1024;
+
+inline std::string const sam_header{"@HD\tVN:1.6\n@SQ\tSN:ref\tLN:100000\n"};
+
+inline std::string const sequence = seqan3::test::generate_sequence<seqan3::dna5>(150, 0, 0) |
+                                    seqan3::views::persist |
+                                    seqan3::views::to_char |
+                                    seqan3::views::to<std::string>;
+
+inline std::string const sam_record{"read\t99\tref\t1200\t60\t10S130M2I8M\t=\t1450\t400\t" +
+                                    sequence + "\t" +
+                                    std::string(sequence.size(), 'I') +
+                                    "\tNM:i:3\tAS:i:137\tXS:i:21\tMD:Z:60A69\tRG:Z:group\tXA:Z:ref,+12,150M,2\n"};
+
+static std::string sam_file = [] ()
+{
+    std::string file{sam_header};
+    for (size_t idx = 0; idx < iterations_per_run; idx++)
+        file += sam_record;
+    return file;
+}();
+
+// ============================================================================
+//  parse SAM records
+// ============================================================================
+
+template <typename fields_t>
+void read_sam(benchmark::State & state)
+{
+    size_t field_size{};
+
+    for (auto _ : state)
+    {
+        std::istringstream istream{sam_file};
+        seqan3::alignment_file_input fin{istream, seqan3::format_sam{}, fields_t{}};
+
+        for (auto & record : fin)
+            field_size += std::ranges::size(seqan3::get<0>(record));
+    }
+
+    benchmark::DoNotOptimize(field_size);
+
+    size_t bytes_per_run = sam_file.size();
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(bytes_per_run);
+    state.counters["records_per_second"] = benchmark::Counter(iterations_per_run,
+                                                              benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// with and without the tag fields
+BENCHMARK_TEMPLATE(read_sam, seqan3::fields<seqan3::field::id, seqan3::field::seq>);
+BENCHMARK_TEMPLATE(read_sam, seqan3::fields<seqan3::field::id, seqan3::field::seq, seqan3::field::tags>);
+// the fields of a typical mapping pipeline
+BENCHMARK_TEMPLATE(read_sam, seqan3::fields<seqan3::field::seq,
+                                            seqan3::field::id,
+                                            seqan3::field::qual,
+                                            seqan3::field::flag,
+                                            seqan3::field::ref_id,
+                                            seqan3::field::ref_offset,
+                                            seqan3::field::mapq,
+                                            seqan3::field::cigar,
+                                            seqan3::field::mate>);
+// all fields but the alignment, which additionally needs the reference sequences
+BENCHMARK_TEMPLATE(read_sam, seqan3::fields<seqan3::field::seq,
+                                            seqan3::field::id,
+                                            seqan3::field::qual,
+                                            seqan3::field::flag,
+                                            seqan3::field::ref_id,
+                                            seqan3::field::ref_offset,
+                                            seqan3::field::mapq,
+                                            seqan3::field::cigar,
+                                            seqan3::field::mate,
+                                            seqan3::field::tags>);
+
+// ============================================================================
+//  write SAM records
+// ============================================================================
+
+void write_sam(benchmark::State & state)
+{
+    using fields_t = seqan3::fields<seqan3::field::seq,
+                                    seqan3::field::id,
+                                    seqan3::field::qual,
+                                    seqan3::field::flag,
+                                    seqan3::field::ref_offset,
+                                    seqan3::field::mapq,
+                                    seqan3::field::cigar,
+                                    seqan3::field::tags>;
+
+    std::istringstream istream{sam_file};
+    seqan3::alignment_file_input fin{istream, seqan3::format_sam{}, fields_t{}};
+    auto const record = *fin.begin();
+
+    std::ostringstream ostream;
+    seqan3::alignment_file_output fout{ostream, seqan3::format_sam{}, fields_t{}};
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < iterations_per_run; ++i)
+            fout.push_back(record);
+    }
+
+    ostream = std::ostringstream{};
+    fout.push_back(record);
+    size_t bytes_per_run = ostream.str().size() * iterations_per_run;
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["bytes_per_run"] = bytes_per_run;
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(bytes_per_run);
+    state.counters["records_per_second"] = benchmark::Counter(iterations_per_run,
+                                                              benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(write_sam);
+
+// ============================================================================
+//  fill, query and clear a tag dictionary like the parser does per record
+// ============================================================================
+
+template <typename dictionary_t>
+void fill_tag_dictionary(benchmark::State & state)
+{
+    dictionary_t dict{};
+    int32_t sum{};
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < iterations_per_run; ++i)
+        {
+            dict.clear();
+            dict["NM"_tag] = int32_t{1};
+            dict["AS"_tag] = int32_t{37};
+            dict["XS"_tag] = int32_t{21};
+            dict["MD"_tag] = std::string{"17A22"};
+            dict["RG"_tag] = std::string{"group"};
+
+            sum += std::get<int32_t>(dict.find("AS"_tag)->second);
+        }
+    }
+
+    benchmark::DoNotOptimize(sum);
+
+    state.counters["iterations_per_run"] = iterations_per_run;
+    state.counters["records_per_second"] = benchmark::Counter(iterations_per_run,
+                                                              benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK_TEMPLATE(fill_tag_dictionary, seqan3::sam_tag_dictionary);
+BENCHMARK_TEMPLATE(fill_tag_dictionary, std::map<uint16_t, seqan3::detail::sam_tag_variant>);
+
+BENCHMARK_MAIN();
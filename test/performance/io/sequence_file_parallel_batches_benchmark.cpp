@@ -0,0 +1,118 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <sstream>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/io/sequence_file/format_fastq.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/range/views/persist.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+
+inline constexpr size_t records_per_run = 1 << 16;
+
+static std::string fastq_file = [] ()
+{
+    std::string file{};
+    for (size_t idx = 0; idx < records_per_run; idx++)
+    {
+        std::string const sequence = seqan3::test::generate_sequence<seqan3::dna5>(150, 0, idx) |
+                                     seqan3::views::persist |
+                                     seqan3::views::to_char |
+                                     seqan3::views::to<std::string>;
+
+        file += "@read_" + std::to_string(idx) + " length=150\n" + sequence + "\n+\n" +
+                std::string(sequence.size(), 'I') + "\n";
+    }
+    return file;
+}();
+
+// ============================================================================
+//  record-wise reading on the calling thread
+// ============================================================================
+
+void read_sequential(benchmark::State & state)
+{
+    size_t sequence_length{};
+
+    for (auto _ : state)
+    {
+        seqan3::sequence_file_input fin{std::istringstream{fastq_file}, seqan3::format_fastq{}};
+
+        for (auto & record : fin)
+            sequence_length += std::ranges::size(seqan3::get<seqan3::field::seq>(record));
+    }
+
+    benchmark::DoNotOptimize(sequence_length);
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(fastq_file.size());
+    state.counters["records_per_second"] = benchmark::Counter(records_per_run,
+                                                              benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(read_sequential)->UseRealTime();
+
+// ============================================================================
+//  column-wise reading on the calling thread
+// ============================================================================
+
+void read_batch(benchmark::State & state)
+{
+    size_t const records_per_batch = state.range(0);
+    size_t sequence_length{};
+
+    for (auto _ : state)
+    {
+        seqan3::sequence_file_input fin{std::istringstream{fastq_file}, seqan3::format_fastq{}};
+
+        for (auto & batch = fin.read_batch(records_per_batch); !batch.empty(); fin.read_batch(records_per_batch))
+            sequence_length += batch.sequences.concat_size();
+    }
+
+    benchmark::DoNotOptimize(sequence_length);
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(fastq_file.size());
+    state.counters["records_per_second"] = benchmark::Counter(records_per_run,
+                                                              benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(read_batch)->UseRealTime()->Arg(64)->Arg(1024);
+
+// ============================================================================
+//  parsing batches on a pool of threads
+// ============================================================================
+
+void read_parallel_batches(benchmark::State & state)
+{
+    size_t const thread_count = state.range(0);
+    size_t sequence_length{};
+
+    for (auto _ : state)
+    {
+        seqan3::sequence_file_input fin{std::istringstream{fastq_file}, seqan3::format_fastq{}};
+
+        for (auto & batch : fin.parallel_batches(thread_count, 1024))
+            sequence_length += batch.sequences.concat_size();
+    }
+
+    benchmark::DoNotOptimize(sequence_length);
+
+    state.counters["thread_count"] = thread_count;
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(fastq_file.size());
+    state.counters["records_per_second"] = benchmark::Counter(records_per_run,
+                                                              benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK(read_parallel_batches)->UseRealTime()->RangeMultiplier(2)->Range(1, 32);
+
+BENCHMARK_MAIN();
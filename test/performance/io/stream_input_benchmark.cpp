@@ -7,11 +7,15 @@
 
 #include <benchmark/benchmark.h>
 
+#include <fstream>
 #include <iostream>
 #include <memory>
 #include <sstream>
 
+#include <seqan3/io/stream/buffer.hpp>
 #include <seqan3/io/stream/iterator.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/test/tmp_filename.hpp>
 
 #ifdef SEQAN3_HAS_ZLIB
     #include <seqan3/contrib/stream/bgzf_istream.hpp>
@@ -249,6 +253,71 @@ BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::bgzf_istream);
 BENCHMARK_TEMPLATE(compressed_type_erased2, seqan3::contrib::bz2_istream);
 #endif
 
+// ============================================================================
+//  file with configured stream buffer
+// ============================================================================
+
+void read_file(benchmark::State & state, std::string const & content, seqan3::stream_buffer_options const & options)
+{
+    seqan3::test::tmp_filename filename{"stream_input_benchmark.txt"};
+
+    {
+        std::ofstream os{filename.get_path(), std::ios::binary};
+        os << content;
+    }
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        seqan3::detail::file_stream_buffer buffer{options};
+        std::unique_ptr<std::basic_istream<char>> file = buffer.open_input(filename.get_path());
+        seqan3::detail::fast_istreambuf_iterator<char> it{*file->rdbuf()};
+
+        for (; it != std::ranges::default_sentinel; ++it)
+            i += *it;
+    }
+
+    state.counters["iterations_per_run"] = i;
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(content.size());
+}
+
+// state.range(0): buffer size in bytes (0 = std::basic_filebuf default),
+// state.range(1): 0 = no hint, 1 = sequential read hint, 2 = direct I/O
+void file_buffer_size(benchmark::State & state)
+{
+    seqan3::stream_buffer_options options{};
+    options.buffer_size = state.range(0);
+    options.sequential_read_hint = state.range(1) == 1;
+    options.direct_io = state.range(1) == 2;
+
+    read_file(state, input, options);
+}
+
+static void file_buffer_size_arguments(benchmark::internal::Benchmark * b)
+{
+    for (int64_t buffer_size : {0, 4 << 10, 64 << 10, 1'000'000, 16 << 20})
+        for (int64_t hint : {0, 1, 2})
+            b->Args({buffer_size, hint});
+}
+
+BENCHMARK(file_buffer_size)->Apply(file_buffer_size_arguments);
+
+// ============================================================================
+//  many small files, with and without a shared buffer pool
+// ============================================================================
+
+// state.range(0): whether the files share a seqan3::stream_buffer_pool
+void small_files(benchmark::State & state)
+{
+    seqan3::stream_buffer_options options{};
+    if (state.range(0))
+        options.pool = std::make_shared<seqan3::stream_buffer_pool>();
+
+    read_file(state, input.substr(0, 1000), options);
+}
+
+BENCHMARK(small_files)->Arg(0)->Arg(1);
+
 // ============================================================================
 //  seqan2 virtual stream
 // ============================================================================
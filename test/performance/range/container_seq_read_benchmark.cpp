@@ -7,13 +7,21 @@
 
 #include <deque>
 #include <list>
+#include <string>
 #include <vector>
 
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/all.hpp>
 #include <seqan3/range/container/all.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/range/views/kmer_hash.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/std/algorithm>
+#include <seqan3/std/ranges>
 #include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
 
 template <typename t>
 using sdsl_int_vec = sdsl::int_vector<sizeof(t) * 8>;
@@ -137,6 +145,168 @@ BENCHMARK_TEMPLATE(sequential_read, small_vec, seqan3::dna15, true);
 BENCHMARK_TEMPLATE(sequential_read, small_vec, seqan3::aa27, true);
 BENCHMARK_TEMPLATE(sequential_read, small_vec, seqan3::alphabet_variant<char, seqan3::dna4>, true);
 
+// ============================================================================
+//  word-level operations
+// ============================================================================
+
+// Compares the element-wise algorithms on std::vector and seqan3::bitcompressed_vector (through the proxy reference)
+// to the word-level operations of seqan3/range/container/bitcompressed_vector_operations.hpp.
+
+template <typename container_t>
+void assign_chars_element_wise(benchmark::State & state)
+{
+    using alphabet_t = std::ranges::range_value_t<container_t>;
+
+    auto letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    std::string chars = letters | seqan3::views::to_char | seqan3::views::to<std::string>;
+    container_t sequence{};
+
+    for (auto _ : state)
+    {
+        sequence.resize(chars.size());
+        std::ranges::copy(chars | seqan3::views::char_to<alphabet_t>, sequence.begin());
+        benchmark::DoNotOptimize(sequence.data());
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(chars.size());
+}
+
+template <typename alphabet_t>
+void assign_chars_word_level(benchmark::State & state)
+{
+    auto letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    std::string chars = letters | seqan3::views::to_char | seqan3::views::to<std::string>;
+    seqan3::bitcompressed_vector<alphabet_t> sequence{};
+
+    for (auto _ : state)
+    {
+        seqan3::assign_chars_to<alphabet_t>(chars, sequence);
+        benchmark::DoNotOptimize(sequence.raw_data().data());
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(chars.size());
+}
+
+BENCHMARK_TEMPLATE(assign_chars_element_wise, std::vector<seqan3::dna4>);
+BENCHMARK_TEMPLATE(assign_chars_element_wise, seqan3::bitcompressed_vector<seqan3::dna4>);
+BENCHMARK_TEMPLATE(assign_chars_word_level, seqan3::dna4);
+BENCHMARK_TEMPLATE(assign_chars_element_wise, std::vector<seqan3::aa27>);
+BENCHMARK_TEMPLATE(assign_chars_element_wise, seqan3::bitcompressed_vector<seqan3::aa27>);
+BENCHMARK_TEMPLATE(assign_chars_word_level, seqan3::aa27);
+
+template <typename container_t>
+void count_mismatches_element_wise(benchmark::State & state)
+{
+    using alphabet_t = std::ranges::range_value_t<container_t>;
+
+    auto lhs_letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    auto rhs_letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 1);
+    container_t lhs(lhs_letters.begin(), lhs_letters.end());
+    container_t rhs(rhs_letters.begin(), rhs_letters.end());
+
+    for (auto _ : state)
+    {
+        size_t mismatches{};
+        for (size_t i = 0; i < lhs.size(); ++i)
+            mismatches += (lhs[i] != rhs[i]);
+        benchmark::DoNotOptimize(mismatches);
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(lhs.size());
+}
+
+template <typename alphabet_t>
+void count_mismatches_word_level(benchmark::State & state)
+{
+    auto lhs_letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    auto rhs_letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 1);
+    seqan3::bitcompressed_vector<alphabet_t> lhs(lhs_letters.begin(), lhs_letters.end());
+    seqan3::bitcompressed_vector<alphabet_t> rhs(rhs_letters.begin(), rhs_letters.end());
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(seqan3::count_mismatches(lhs, rhs));
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(lhs.size());
+}
+
+BENCHMARK_TEMPLATE(count_mismatches_element_wise, std::vector<seqan3::dna4>);
+BENCHMARK_TEMPLATE(count_mismatches_element_wise, seqan3::bitcompressed_vector<seqan3::dna4>);
+BENCHMARK_TEMPLATE(count_mismatches_word_level, seqan3::dna4);
+BENCHMARK_TEMPLATE(count_mismatches_element_wise, std::vector<seqan3::aa27>);
+BENCHMARK_TEMPLATE(count_mismatches_element_wise, seqan3::bitcompressed_vector<seqan3::aa27>);
+BENCHMARK_TEMPLATE(count_mismatches_word_level, seqan3::aa27);
+
+template <typename container_t>
+void slice_element_wise(benchmark::State & state)
+{
+    using alphabet_t = std::ranges::range_value_t<container_t>;
+
+    auto letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    container_t sequence(letters.begin(), letters.end());
+
+    // starts at an odd position, which is not aligned to a word of the bitcompressed_vector
+    for (auto _ : state)
+    {
+        container_t copy(sequence.begin() + 3, sequence.end() - 3);
+        benchmark::DoNotOptimize(copy.data());
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(sequence.size() - 6);
+}
+
+template <typename alphabet_t>
+void slice_word_level(benchmark::State & state)
+{
+    auto letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    seqan3::bitcompressed_vector<alphabet_t> sequence(letters.begin(), letters.end());
+
+    for (auto _ : state)
+    {
+        seqan3::bitcompressed_vector<alphabet_t> copy = seqan3::slice(sequence, 3, sequence.size() - 3);
+        benchmark::DoNotOptimize(copy.raw_data().data());
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(sequence.size() - 6);
+}
+
+BENCHMARK_TEMPLATE(slice_element_wise, std::vector<seqan3::dna4>);
+BENCHMARK_TEMPLATE(slice_element_wise, seqan3::bitcompressed_vector<seqan3::dna4>);
+BENCHMARK_TEMPLATE(slice_word_level, seqan3::dna4);
+
+template <typename container_t>
+void kmers_element_wise(benchmark::State & state)
+{
+    using alphabet_t = std::ranges::range_value_t<container_t>;
+
+    auto letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    container_t sequence(letters.begin(), letters.end());
+    std::vector<uint64_t> kmers(sequence.size() - 15);
+
+    for (auto _ : state)
+    {
+        std::ranges::copy(sequence | seqan3::views::kmer_hash(seqan3::ungapped{16}), kmers.begin());
+        benchmark::DoNotOptimize(kmers.data());
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(sequence.size());
+}
+
+template <typename alphabet_t>
+void kmers_word_level(benchmark::State & state)
+{
+    auto letters = seqan3::test::generate_sequence<alphabet_t>(10'000, 0, 0);
+    seqan3::bitcompressed_vector<alphabet_t> sequence(letters.begin(), letters.end());
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(seqan3::packed_kmers(sequence, 16).data());
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(sequence.size());
+}
+
+BENCHMARK_TEMPLATE(kmers_element_wise, std::vector<seqan3::dna4>);
+BENCHMARK_TEMPLATE(kmers_element_wise, seqan3::bitcompressed_vector<seqan3::dna4>);
+BENCHMARK_TEMPLATE(kmers_word_level, seqan3::dna4);
+
 // ============================================================================
 //  run
 // ============================================================================
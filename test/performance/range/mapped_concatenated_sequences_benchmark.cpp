@@ -0,0 +1,131 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <fstream>
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/container/mapped_concatenated_sequences.hpp>
+#include <seqan3/range/views/to_char.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/performance/units.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using sequences_t = seqan3::concatenated_sequences<seqan3::bitcompressed_vector<seqan3::dna4>>;
+
+struct dna4_traits : seqan3::sequence_file_input_default_traits_dna
+{
+    using sequence_alphabet = seqan3::dna4;
+
+    template <typename alph>
+    using sequence_container = seqan3::bitcompressed_vector<alph>;
+};
+
+// 1000 sequences of 10'000 letters, stored as FASTA and as mapped file
+struct files
+{
+    seqan3::test::tmp_filename fasta{"reference.fa"};
+    seqan3::test::tmp_filename mapped{"reference.seqan3"};
+    sequences_t sequences{};
+
+    files()
+    {
+        std::ofstream fasta_stream{fasta.get_path()};
+
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            auto sequence = seqan3::test::generate_sequence<seqan3::dna4>(10'000, 0, i);
+            fasta_stream << "> " << i << '\n';
+            for (auto c : sequence | seqan3::views::to_char)
+                fasta_stream << c;
+            fasta_stream << '\n';
+            sequences.push_back(sequence);
+        }
+
+        seqan3::write_mapped_sequences(mapped.get_path(), sequences);
+    }
+};
+
+files const & reference()
+{
+    static files const instance{};
+    return instance;
+}
+
+// ============================================================================
+//  load
+// ============================================================================
+
+void load_fasta(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        sequences_t sequences{};
+        seqan3::sequence_file_input<dna4_traits> fin{reference().fasta.get_path()};
+        for (auto & record : fin)
+            sequences.push_back(seqan3::get<seqan3::field::seq>(record));
+        benchmark::DoNotOptimize(sequences.concat_size());
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(reference().sequences.concat_size());
+}
+
+void load_mapped(benchmark::State & state)
+{
+    for (auto _ : state)
+    {
+        seqan3::mapped_concatenated_sequences<seqan3::dna4> sequences{reference().mapped.get_path()};
+        benchmark::DoNotOptimize(sequences.concat_size());
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(reference().sequences.concat_size());
+}
+
+BENCHMARK(load_fasta);
+BENCHMARK(load_mapped);
+
+// ============================================================================
+//  sequential_read
+// ============================================================================
+
+template <typename container_t>
+void sequential_read(benchmark::State & state, container_t const & sequences)
+{
+    for (auto _ : state)
+    {
+        size_t rank_sum{};
+        for (auto && sequence : sequences)
+            for (auto && letter : sequence)
+                rank_sum += seqan3::to_rank(letter);
+        benchmark::DoNotOptimize(rank_sum);
+    }
+
+    state.counters["bytes_per_second"] = seqan3::test::bytes_per_second(reference().sequences.concat_size());
+}
+
+void sequential_read_concatenated(benchmark::State & state)
+{
+    sequential_read(state, reference().sequences);
+}
+
+void sequential_read_mapped(benchmark::State & state)
+{
+    sequential_read(state, seqan3::mapped_concatenated_sequences<seqan3::dna4>{reference().mapped.get_path()});
+}
+
+BENCHMARK(sequential_read_concatenated);
+BENCHMARK(sequential_read_mapped);
+
+// ============================================================================
+//  run
+// ============================================================================
+
+BENCHMARK_MAIN();
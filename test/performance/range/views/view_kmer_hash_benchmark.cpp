@@ -8,6 +8,7 @@
 #include <benchmark/benchmark.h>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/range/views/kmer_hash.hpp>
 #include <seqan3/test/performance/sequence_generator.hpp>
 #include <seqan3/test/performance/naive_kmer_hash.hpp>
@@ -86,6 +87,26 @@ static void seqan_kmer_hash_gapped(benchmark::State & state)
     state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - k + 1);
 }
 
+// A spaced seed of weight 11 and span 18 (PatternHunter). Its blocks of consecutive 1s are short.
+template <typename alphabet_t>
+static void seqan_kmer_hash_spaced_seed(benchmark::State & state)
+{
+    auto sequence_length = state.range(0);
+    assert(sequence_length > 0);
+    seqan3::shape const shape_{seqan3::bin_literal{0b111010010100110111}};
+    auto seq = seqan3::test::generate_sequence<alphabet_t>(sequence_length, 0, 0);
+
+    volatile size_t sum{0};
+
+    for (auto _ : state)
+    {
+        for (auto h : seq | seqan3::views::kmer_hash(shape_))
+            benchmark::DoNotOptimize(sum += h);
+    }
+
+    state.counters["Throughput[bp/s]"] = bp_per_second(sequence_length - shape_.size() + 1);
+}
+
 static void naive_kmer_hash(benchmark::State & state)
 {
     auto sequence_length = state.range(0);
@@ -174,6 +195,8 @@ BENCHMARK(seqan2_kmer_hash_gapped)->Apply(arguments);
 
 BENCHMARK(seqan_kmer_hash_ungapped)->Apply(arguments);
 BENCHMARK(seqan_kmer_hash_gapped)->Apply(arguments);
+BENCHMARK_TEMPLATE(seqan_kmer_hash_spaced_seed, seqan3::dna4)->Arg(1'000)->Arg(50'000);
+BENCHMARK_TEMPLATE(seqan_kmer_hash_spaced_seed, seqan3::dna5)->Arg(1'000)->Arg(50'000);
 BENCHMARK(naive_kmer_hash)->Apply(arguments);
 
 BENCHMARK_MAIN();
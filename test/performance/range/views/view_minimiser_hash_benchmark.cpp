@@ -43,7 +43,7 @@ static void arguments(benchmark::internal::Benchmark* b)
     {
         for (int32_t k : {8, /*16, 24,*/ 30})
         {
-            for (int32_t w : {k + 5, k + 20})
+            for (int32_t w : {k + 5, k + 20, 100, 1000}) // large windows stress the minimum of the window
             {
                 b->Args({sequence_length, k, w});
             }
@@ -0,0 +1,79 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/views/slice.hpp>
+#include <seqan3/search/fm_index/fm_index.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// ============================================================================
+//  locate all occurrences of short queries in a repetitive text
+// ============================================================================
+
+static constexpr size_t template_length{10'000};
+static constexpr size_t repeats{100};
+
+template <typename sdsl_index_t, bool lazy>
+void locate(benchmark::State & state)
+{
+    size_t const query_length = state.range(0);
+
+    std::vector<seqan3::dna4> const seq_template = seqan3::test::generate_sequence<seqan3::dna4>(template_length, 0, 0);
+    std::vector<seqan3::dna4> text{};
+    for (size_t i = 0; i < repeats; ++i)
+        text.insert(text.end(), seq_template.begin(), seq_template.end());
+
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, sdsl_index_t> index{text};
+
+    std::vector<decltype(index.cursor())> cursors{};
+    for (size_t i = 0; i + query_length <= template_length; i += 100)
+    {
+        auto cur = index.cursor();
+        cur.extend_right(text | seqan3::views::slice(i, i + query_length));
+        cursors.push_back(cur);
+    }
+
+    size_t occurrences{0};
+    for (auto _ : state)
+    {
+        for (auto const & cur : cursors)
+        {
+            if constexpr (lazy)
+            {
+                for (auto && occ : cur.lazy_locate())
+                    benchmark::DoNotOptimize(occurrences += occ.second);
+            }
+            else
+            {
+                benchmark::DoNotOptimize(occurrences += cur.locate().size());
+            }
+        }
+    }
+
+    state.counters["occurrences/s"] = benchmark::Counter(cursors.size() * repeats * state.iterations(),
+                                                        benchmark::Counter::kIsRate);
+}
+
+using sa_order_16_t = seqan3::sdsl_wt_sampled_index_type<16, sdsl::sa_order_sa_sampling<>>;
+using text_order_16_t = seqan3::sdsl_wt_sampled_index_type<16, sdsl::text_order_sa_sampling<>>;
+using text_order_4_t = seqan3::sdsl_wt_sampled_index_type<4, sdsl::text_order_sa_sampling<>>;
+using sa_order_64_t = seqan3::sdsl_wt_sampled_index_type<64, sdsl::sa_order_sa_sampling<>>;
+
+BENCHMARK_TEMPLATE(locate, sa_order_16_t, true)->Arg(20);
+BENCHMARK_TEMPLATE(locate, sa_order_16_t, false)->Arg(20);
+BENCHMARK_TEMPLATE(locate, text_order_16_t, false)->Arg(20);
+BENCHMARK_TEMPLATE(locate, text_order_4_t, false)->Arg(20);
+BENCHMARK_TEMPLATE(locate, sa_order_64_t, true)->Arg(20);
+BENCHMARK_TEMPLATE(locate, sa_order_64_t, false)->Arg(20);
+
+// ============================================================================
+//  run
+// ============================================================================
+
+BENCHMARK_MAIN();
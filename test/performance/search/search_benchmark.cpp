@@ -304,6 +304,16 @@ BENCHMARK_CAPTURE(bidirectional_search_all, highErrorReadsSearch3Rep,
 BENCHMARK_CAPTURE(bidirectional_search_all, highErrorReadsSearch3Rep,
                   options{100'000, true, 50, 50, 0.30, 0.30, 0, 3, 3, 1.75});
 
+// Search schemes computed on the fly (no precomputed optimum search scheme for more than 3 errors)
+BENCHMARK_CAPTURE(bidirectional_search_all, longReadsSearch4,
+                  options{100'000, false, 20, 100, 0.18, 0.18, 4, 4, 0, 0});
+BENCHMARK_CAPTURE(bidirectional_search_all, longReadsSearch5,
+                  options{100'000, false, 20, 100, 0.18, 0.18, 5, 5, 0, 0});
+BENCHMARK_CAPTURE(bidirectional_search_all, longReadsSearch6,
+                  options{100'000, false, 20, 100, 0.18, 0.18, 6, 6, 0, 0});
+BENCHMARK_CAPTURE(bidirectional_search_all, longReadsSearch6Rep,
+                  options{100'000, true, 20, 100, 0.18, 0.18, 6, 6, 0, 0});
+
 BENCHMARK_CAPTURE(unidirectional_search_stratified, lowErrorReadsSearch3Strata0Rep,
                   options{50'000, true, 50, 50, 0.18, 0.18, 0, 3, 0, 1});
 BENCHMARK_CAPTURE(unidirectional_search_stratified, lowErrorReadsSearch3Strata1Rep,
@@ -0,0 +1,12 @@
+#include <seqan3/alignment/band/static_band.hpp>
+#include <seqan3/alignment/configuration/align_config_band.hpp>
+#include <seqan3/alignment/configuration/align_config_difference_recurrence.hpp>
+#include <seqan3/alignment/configuration/align_config_mode.hpp>
+
+int main()
+{
+    // Compute long global alignments within a band with the difference recurrence.
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} |
+               seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-100}, seqan3::upper_bound{100}}} |
+               seqan3::align_cfg::difference_recurrence;
+}
@@ -0,0 +1,7 @@
+#include <seqan3/alignment/configuration/align_config_linear_memory.hpp>
+
+int main()
+{
+    // Compute the alignment in linear memory.
+    auto cfg = seqan3::align_cfg::linear_memory;
+}
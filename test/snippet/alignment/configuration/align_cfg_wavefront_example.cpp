@@ -0,0 +1,7 @@
+#include <seqan3/alignment/configuration/align_config_wavefront.hpp>
+
+int main()
+{
+    // Compute the global alignment with the wavefront alignment algorithm.
+    auto cfg = seqan3::align_cfg::wavefront;
+}
@@ -0,0 +1,15 @@
+#include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/core/debug_stream.hpp>
+
+int main()
+{
+    uint8_t  t0 = 0b1011'0110;
+    uint16_t t1 = 0b0100'0001'1110'1001;
+    uint64_t t2 = 0b1100'0011'1110'0100;
+
+    seqan3::debug_stream << seqan3::detail::extract_bits(t0, uint8_t{0b1111'0000}) << '\n';              // 11
+    seqan3::debug_stream << seqan3::detail::extract_bits(t1, uint16_t{0b0000'0000'1111'1111}) << '\n';   // 233
+    seqan3::debug_stream << seqan3::detail::extract_bits(t2, uint64_t{0b1111'0000'0000'1111}) << '\n';   // 196
+
+    return 0;
+}
@@ -0,0 +1,36 @@
+#include <sstream>
+
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/alignment_file/input.hpp>
+
+auto sam_file_raw = R"(@HD	VN:1.6
+@SQ	SN:ref	LN:34
+r001	0	ref	2	60	2S3M1I2M1D2M1S	*	0	0	TTCTGAATCAG	*
+r002	0	ref	15	60	5M	*	0	0	TCTAG	*
+)";
+
+struct cigar_alignment_traits : seqan3::alignment_file_input_default_traits<>
+{
+    using alignment_type = seqan3::cigar_alignment; // store the cigar instead of the gapped sequences
+};
+
+int main()
+{
+    using seqan3::operator""_dna5;
+
+    seqan3::dna5_vector reference = "ACTGATCGAGAGGATCTAGAGGAGATCGTAGGAC"_dna5;
+
+    seqan3::alignment_file_input<cigar_alignment_traits,
+                                 seqan3::fields<seqan3::field::seq, seqan3::field::alignment>> fin{
+        std::istringstream{sam_file_raw}, seqan3::format_sam{}};
+
+    for (auto & [seq, alignment] : fin)
+    {
+        seqan3::debug_stream << alignment.cigar_view() << " at " << alignment.reference_begin() << '\n';
+
+        // the gapped sequences are only computed here
+        auto [gapped_reference, gapped_query] = alignment.alignment(reference, seq);
+        seqan3::debug_stream << gapped_reference << '\n' << gapped_query << '\n';
+    }
+}
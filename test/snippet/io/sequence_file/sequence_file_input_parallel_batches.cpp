@@ -0,0 +1,30 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+
+auto input = R"(@TEST1
+ACGT
++
+##!#
+@Test2
+AGGCTGA
++
+##!#>!!
+@Test3
+GGAGTATAATATATATATATATAT
++
+##!#>!!!!!!!!!!!!!!!!!!!
+)";
+
+int main()
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fastq{}};
+
+    // parse the records on 4 threads, in batches of (at most) 2 records
+    for (auto & batch : fin.parallel_batches(4, 2))
+    {
+        for (size_t i = 0; i < batch.size(); ++i)
+            seqan3::debug_stream << "ID: " << batch.ids[i] << " SEQ: " << batch.sequences[i] << '\n';
+    }
+}
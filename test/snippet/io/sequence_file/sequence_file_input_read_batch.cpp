@@ -0,0 +1,24 @@
+#include <sstream>
+
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+
+auto input = R"(> TEST1
+ACGT
+> Test2
+AGGCTGA
+> Test3
+GGAGTATAATATATATATATATAT)";
+
+int main()
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+
+    // read the file in batches of (at most) 2 records; the memory of the batch is reused
+    for (auto & batch = fin.read_batch(2); !batch.empty(); fin.read_batch(2))
+    {
+        seqan3::debug_stream << "batch of " << batch.size() << " records:\n";
+        seqan3::debug_stream << batch.ids << '\n';       // all ids of the batch
+        seqan3::debug_stream << batch.sequences << '\n'; // all sequences of the batch, in contiguous memory
+    }
+}
@@ -0,0 +1,41 @@
+#include <memory>
+#include <string>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/io/sequence_file/output.hpp>
+#include <seqan3/io/stream/buffer.hpp>
+#include <seqan3/std/filesystem>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    auto tmp_dir = std::filesystem::temp_directory_path();
+
+    for (size_t i = 0; i < 3; ++i) // Create the files /tmp/my0.fasta, /tmp/my1.fasta and /tmp/my2.fasta.
+    {
+        seqan3::sequence_file_output fout{tmp_dir / ("my" + std::to_string(i) + ".fasta")};
+        fout.emplace_back("ACGT"_dna4, "TEST" + std::to_string(i));
+    }
+
+    seqan3::stream_buffer_options options{};
+    options.buffer_size = 64 * 1024;                                // 64 KiB instead of 1 MB per file
+    options.sequential_read_hint = true;                            // ask the OS for a larger read-ahead window
+    options.pool = std::make_shared<seqan3::stream_buffer_pool>();  // reuse the buffer of a closed file
+
+    using fields_t = seqan3::fields<seqan3::field::seq, seqan3::field::id>;
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        // only the first file allocates a buffer, the following files reuse it
+        seqan3::sequence_file_input fin{tmp_dir / ("my" + std::to_string(i) + ".fasta"), fields_t{}, options};
+
+        for (auto & [seq, id] : fin)
+            seqan3::debug_stream << id << ": " << seq << '\n';
+    }
+
+    for (size_t i = 0; i < 3; ++i)
+        std::filesystem::remove(tmp_dir / ("my" + std::to_string(i) + ".fasta"));
+}
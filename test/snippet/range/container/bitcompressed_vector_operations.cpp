@@ -0,0 +1,25 @@
+#include <cstdint>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/bitcompressed_vector_operations.hpp>
+
+using seqan3::operator""_dna4;
+
+int main()
+{
+    seqan3::bitcompressed_vector<seqan3::aa27> protein{};
+    seqan3::assign_chars_to("MKWVTFISLL", protein);                   // packs 12 letters per 64 bit word
+    seqan3::debug_stream << seqan3::slice(protein, 2, 6) << '\n';     // WVTF
+
+    seqan3::bitcompressed_vector<seqan3::dna4> read{"ACGTTGCAACGT"_dna4};
+    seqan3::bitcompressed_vector<seqan3::dna4> reference{"ACGATGCAACTT"_dna4};
+    seqan3::debug_stream << seqan3::count_mismatches(read, reference) << '\n';               // 2
+    seqan3::debug_stream << seqan3::equal_slices(read, 4, reference, 4, 6) << '\n';          // 1
+
+    std::vector<uint64_t> kmers = seqan3::packed_kmers(read, 4);      // 9 k-mers of 4 letters
+    seqan3::debug_stream << kmers.size() << ' ' << kmers[0] << '\n';  // 9 228
+}
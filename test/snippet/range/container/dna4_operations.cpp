@@ -0,0 +1,24 @@
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/dna4_operations.hpp>
+
+int main()
+{
+    std::string const chars{"ACGTTGCAacgtN"};
+
+    std::vector<seqan3::dna4> sequence{};
+    seqan3::assign_chars_to(chars, sequence);       // same as chars | seqan3::views::char_to<seqan3::dna4>
+    seqan3::debug_stream << sequence << '\n';       // ACGTTGCAACGTA
+
+    seqan3::bitcompressed_vector<seqan3::dna4> packed{};
+    seqan3::assign_ranks_to(sequence, packed);      // packs 32 letters per 64 bit word at once
+
+    seqan3::reverse_complement(sequence);           // in place, 16 or 32 letters per instruction
+    seqan3::reverse_complement(packed);             // in place, word-wise on the packed representation
+    seqan3::debug_stream << sequence << '\n';       // TACGTTGCAACGT
+    seqan3::debug_stream << packed << '\n';         // TACGTTGCAACGT
+}
@@ -0,0 +1,27 @@
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/container/mapped_concatenated_sequences.hpp>
+#include <seqan3/std/filesystem>
+
+using seqan3::operator""_dna4;
+
+int main()
+{
+    std::filesystem::path const path = std::filesystem::temp_directory_path() / "reference.seqan3";
+
+    // once: e.g. after reading the sequences from a FASTA file
+    seqan3::concatenated_sequences<seqan3::bitcompressed_vector<seqan3::dna4>> sequences{};
+    sequences.push_back("ACGTACGTAC"_dna4);
+    sequences.push_back("GGTTA"_dna4);
+    seqan3::write_mapped_sequences(path, sequences);
+
+    // in every run: maps the file without parsing it
+    seqan3::mapped_concatenated_sequences<seqan3::dna4> reference{path};
+    seqan3::debug_stream << reference.size() << '\n';  // 2
+    seqan3::debug_stream << reference[1] << '\n';      // GGTTA
+    seqan3::debug_stream << reference[0][3] << '\n';   // T
+
+    std::filesystem::remove(path);
+}
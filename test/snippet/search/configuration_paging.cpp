@@ -0,0 +1,13 @@
+#include <seqan3/search/configuration/max_error.hpp>
+#include <seqan3/search/configuration/paging.hpp>
+
+int main()
+{
+    // Locate the text positions of the hits in pages of 1000 positions and report at most 100000 positions per query
+    // (allowing 1 error of any type).
+    seqan3::configuration const cfg = seqan3::search_cfg::page_size{1000} |
+                                      seqan3::search_cfg::max_hits{100000} |
+                                      seqan3::search_cfg::max_error{seqan3::search_cfg::total{1}};
+
+    return 0;
+}
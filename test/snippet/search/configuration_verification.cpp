@@ -0,0 +1,26 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/search.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+    std::vector<seqan3::dna4_vector> genomes{"CGCTGTCTGAAGGATGAGTGTCAGCCAGTGTA"_dna4,
+                                             "ACCCGATGAGCTACCCAGTAGTCGAACTG"_dna4};
+
+    seqan3::fm_index index{genomes};
+
+    // Seed with the index and verify the candidates against the genomes (allowing 2 errors of any type).
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error{seqan3::search_cfg::total{2}} |
+                                      seqan3::search_cfg::verification{genomes};
+
+    for (auto && result : seqan3::search("GATGAGCTGCC"_dna4, index, cfg))
+        seqan3::debug_stream << result << '\n';
+    // This should result in:
+    // <query_id:0, reference_id:0, reference_pos:12>
+    // <query_id:0, reference_id:1, reference_pos:4>
+    // <query_id:0, reference_id:1, reference_pos:5>
+}
@@ -0,0 +1,21 @@
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/debug_stream.hpp>
+#include <seqan3/search/fm_index/all.hpp>
+
+int main()
+{
+    using seqan3::operator""_dna4;
+
+    // Store every 4th suffix array value in text order: faster locate, bigger index.
+    using sampled_index_t = seqan3::sdsl_wt_sampled_index_type<4, sdsl::text_order_sa_sampling<>>;
+
+    std::vector<seqan3::dna4> genome{"ATCGATCGAAGGCTAGCTAGCTAAGGGA"_dna4};
+    seqan3::fm_index<seqan3::dna4, seqan3::text_layout::single, sampled_index_t> index{genome};
+
+    auto cur = index.cursor();
+    cur.extend_right("AAGG"_dna4);
+    seqan3::debug_stream << cur.locate() << '\n';                      // outputs: [(0,8),(0,22)]
+    return 0;
+}
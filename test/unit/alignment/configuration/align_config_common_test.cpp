@@ -21,7 +21,9 @@ using alignment_result_t = seqan3::alignment_result<seqan3::detail::alignment_re
 
 using test_types = ::testing::Types<seqan3::align_cfg::aligned_ends<std::remove_const_t<decltype(seqan3::free_ends_all)>>,
                                     seqan3::align_cfg::band<seqan3::static_band>,
+                                    seqan3::detail::difference_recurrence_tag,
                                     seqan3::align_cfg::gap<seqan3::gap_scheme<>>,
+                                    seqan3::detail::linear_memory_tag,
                                     seqan3::align_cfg::max_error,
                                     seqan3::align_cfg::mode<seqan3::detail::global_alignment_type>,
                                     seqan3::align_cfg::mode<seqan3::detail::local_alignment_type>,
@@ -29,7 +31,10 @@ using test_types = ::testing::Types<seqan3::align_cfg::aligned_ends<std::remove_
                                     seqan3::align_cfg::result<>,
                                     seqan3::align_cfg::scoring<seqan3::nucleotide_scoring_scheme<int8_t>>,
                                     seqan3::detail::vectorise_tag,
-                                    seqan3::detail::alignment_result_capture_element<alignment_result_t>>;
+                                    seqan3::detail::alignment_result_capture_element<alignment_result_t>,
+                                    seqan3::detail::vectorised_score_type_element<int8_t>,
+                                    seqan3::detail::wavefront_tag,
+                                    seqan3::align_cfg::x_drop>;
 
 TYPED_TEST_SUITE(alignment_configuration_test, test_types, );
 
@@ -54,7 +59,7 @@ TEST(alignment_configuration_test, symmetric_configuration)
 TEST(alignment_configuration_test, number_of_configs)
 {
     // NOTE(rrahn): You must update this test if you add a new value to seqan3::align_cfg::id
-    EXPECT_EQ(static_cast<uint8_t>(seqan3::detail::align_config_id::SIZE), 12);
+    EXPECT_EQ(static_cast<uint8_t>(seqan3::detail::align_config_id::SIZE), 17);
 }
 
 TYPED_TEST(alignment_configuration_test, config_element)
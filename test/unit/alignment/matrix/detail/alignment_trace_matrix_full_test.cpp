@@ -130,3 +130,24 @@ TEST(trace_matrix, trace_path)
 
     EXPECT_TRUE(path.empty());
 }
+
+TEST(trace_matrix, resize)
+{
+    seqan3::detail::alignment_trace_matrix_full<seqan3::detail::trace_directions> matrix{"acgt", "acgt"};
+
+    // Overwrite some cells to check that the resized matrix is reinitialised.
+    for (auto && cell : *matrix.begin())
+        cell.current = seqan3::detail::trace_directions::diagonal;
+
+    matrix.resize("acgtacgt", "acg");
+
+    size_t column_count = 0;
+    for (auto && column : matrix)
+    {
+        EXPECT_EQ(std::ranges::distance(column), 4);
+        for (auto && cell : column)
+            EXPECT_EQ(cell.current, seqan3::detail::trace_directions::none);
+        ++column_count;
+    }
+    EXPECT_EQ(column_count, 9u);
+}
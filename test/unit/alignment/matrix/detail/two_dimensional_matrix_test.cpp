@@ -184,6 +184,25 @@ TYPED_TEST(two_dimensional_matrix_test, rows)
     EXPECT_EQ(matrix.rows(), 3u);
 }
 
+TYPED_TEST(two_dimensional_matrix_test, resize)
+{
+    using score_type = typename TestFixture::score_type;
+
+    this->matrix.resize(seqan3::detail::number_rows{2}, seqan3::detail::number_cols{3});
+    EXPECT_EQ(this->matrix.rows(), 2u);
+    EXPECT_EQ(this->matrix.cols(), 3u);
+    EXPECT_EQ(std::ranges::distance(this->matrix), 6);
+    for (auto cell : this->matrix)
+        this->expect_eq(cell, score_type{});
+
+    this->matrix.resize(seqan3::detail::number_rows{5}, seqan3::detail::number_cols{4}, score_type{7});
+    EXPECT_EQ(this->matrix.rows(), 5u);
+    EXPECT_EQ(this->matrix.cols(), 4u);
+    EXPECT_EQ(std::ranges::distance(this->matrix), 20);
+    for (auto cell : this->matrix)
+        this->expect_eq(cell, score_type{7});
+}
+
 TYPED_TEST(two_dimensional_matrix_test, range)
 {
     // For an explanation how this works see iterator_fixture further below in this file.
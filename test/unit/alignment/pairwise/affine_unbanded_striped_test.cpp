@@ -0,0 +1,97 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/alignment_scores.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Alignments computing at most the back coordinate use the striped kernel for large sequence pairs. Requesting the
+// front coordinate selects the scalar algorithm, which serves as reference.
+template <typename alphabet_t, typename config_t>
+void test_striped_alignment(config_t const & config)
+{
+    // Mix sequence pairs below and above the length threshold of the striped kernel.
+    auto sequence_pairs = seqan3::test::generate_sequence_pairs<alphabet_t>(600, 20, 500);
+    auto similar_sequence = seqan3::test::generate_sequence<alphabet_t>(1000, 0, 7);
+    auto similar_sequence_mutated = similar_sequence;
+    for (size_t i = 0; i < similar_sequence_mutated.size(); i += 37)
+        similar_sequence_mutated.erase(similar_sequence_mutated.begin() + i);
+    sequence_pairs.emplace_back(similar_sequence, similar_sequence_mutated);
+    sequence_pairs.emplace_back(similar_sequence_mutated, similar_sequence);
+
+    auto scalar_config = config | seqan3::align_cfg::result{seqan3::with_front_coordinate};
+    seqan3::test::expect_same_alignment_scores(sequence_pairs, scalar_config, config);
+
+    std::vector<seqan3::alignment_coordinate> expected_back_coordinates(sequence_pairs.size());
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, scalar_config))
+        expected_back_coordinates[result.id()] = result.back_coordinate();
+
+    std::vector<seqan3::alignment_coordinate> back_coordinates(sequence_pairs.size());
+    for (auto && result : seqan3::align_pairwise(sequence_pairs,
+                                                 config | seqan3::align_cfg::result{seqan3::with_back_coordinate}))
+        back_coordinates[result.id()] = result.back_coordinate();
+
+    EXPECT_EQ(back_coordinates, expected_back_coordinates);
+}
+
+TEST(affine_unbanded_striped, global_dna4)
+{
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                               seqan3::mismatch_score{-5}}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}};
+
+    test_striped_alignment<seqan3::dna4>(config);
+}
+
+TEST(affine_unbanded_striped, global_dna4_linear_gaps)
+{
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}}};
+
+    test_striped_alignment<seqan3::dna4>(config);
+}
+
+TEST(affine_unbanded_striped, local_dna4)
+{
+    auto config = seqan3::align_cfg::mode{seqan3::local_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                               seqan3::mismatch_score{-5}}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}};
+
+    test_striped_alignment<seqan3::dna4>(config);
+}
+
+TEST(affine_unbanded_striped, global_blosum62)
+{
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::aminoacid_scoring_scheme{
+                                                 seqan3::aminoacid_similarity_matrix::BLOSUM62}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}};
+
+    test_striped_alignment<seqan3::aa27>(config);
+}
+
+TEST(affine_unbanded_striped, local_blosum62)
+{
+    auto config = seqan3::align_cfg::mode{seqan3::local_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::aminoacid_scoring_scheme{
+                                                 seqan3::aminoacid_similarity_matrix::BLOSUM62}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}};
+
+    test_striped_alignment<seqan3::aa27>(config);
+}
@@ -12,9 +12,12 @@
 #include <seqan3/alignment/pairwise/alignment_configurator.hpp>
 #include <seqan3/alignment/pairwise/detail/type_traits.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
 #include <seqan3/range/views/chunk.hpp>
 #include <seqan3/range/views/zip.hpp>
 #include <seqan3/std/ranges>
+#include <seqan3/test/alignment_scores.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
 
 using seqan3::operator""_dna4;
 
@@ -234,3 +237,63 @@ TEST(alignment_configurator, configure_result_score_type)
                                             seqan3::detail::row_index_type{4u}}));
     EXPECT_TRUE((std::same_as<decltype(result.score()), double>));
 }
+
+// Computes the scores with the vectorised alignment configured for every instruction set supported by the executing
+// CPU and compares them with the scores of the scalar alignment.
+template <typename config_t>
+void expect_same_scores_for_every_instruction_set(config_t const & cfg)
+{
+    using seqan3::detail::simd_instruction_set;
+
+    auto sequence_pairs = seqan3::test::generate_sequence_pairs<seqan3::dna4>(100, 70, 20);
+    auto sequence_pairs_view = sequence_pairs | std::views::all;
+    std::vector<int32_t> const expected_scores = seqan3::test::alignment_scores(sequence_pairs, cfg);
+
+    for (simd_instruction_set instruction_set : {simd_instruction_set::generic,
+                                                 simd_instruction_set::sse4,
+                                                 simd_instruction_set::avx2,
+                                                 simd_instruction_set::avx512})
+    {
+        if (instruction_set > seqan3::detail::runtime_simd_instruction_set())
+            continue;
+
+        auto [algorithm, complete_config] =
+            seqan3::detail::alignment_configurator::configure<decltype(sequence_pairs_view)>(
+                cfg | seqan3::align_cfg::vectorise, instruction_set);
+
+        using traits_t = seqan3::detail::alignment_configuration_traits<decltype(complete_config)>;
+
+        auto indexed_sequence_pairs = seqan3::views::zip(sequence_pairs_view, std::views::iota(0))
+                                    | seqan3::views::chunk(traits_t::runtime_alignments_per_vector(instruction_set));
+
+        std::vector<int32_t> scores(sequence_pairs.size());
+        for (auto && chunk : indexed_sequence_pairs)
+        {
+            algorithm(chunk, [&] (auto && result)
+            {
+                scores[result.id()] = result.score();
+            });
+        }
+
+        EXPECT_EQ(scores, expected_scores) << "instruction set: " << static_cast<size_t>(instruction_set);
+    }
+}
+
+TEST(alignment_configurator, configure_vectorised_instruction_sets)
+{
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} |
+               seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+               seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{}};
+
+    expect_same_scores_for_every_instruction_set(cfg);
+}
+
+TEST(alignment_configurator, configure_vectorised_banded_instruction_sets)
+{
+    auto cfg = seqan3::align_cfg::mode{seqan3::global_alignment} |
+               seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+               seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{}} |
+               seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-30}, seqan3::upper_bound{30}}};
+
+    expect_same_scores_for_every_instruction_set(cfg);
+}
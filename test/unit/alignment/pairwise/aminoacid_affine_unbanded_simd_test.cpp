@@ -0,0 +1,56 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/configuration/align_config_vectorised_score_type.hpp>
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/test/alignment_scores.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// The vectorised alignment with a substitution matrix must compute the same scores as the scalar alignment.
+template <typename config_t>
+void test_vectorised_alignment(config_t const & config)
+{
+    auto sequence_pairs = seqan3::test::generate_sequence_pairs<seqan3::aa27>(100, 100, 30);
+    // Add some empty sequences.
+    sequence_pairs[3].first.clear();
+    sequence_pairs[17].second.clear();
+    sequence_pairs[42].first.clear();
+    sequence_pairs[42].second.clear();
+
+    seqan3::test::expect_same_alignment_scores(sequence_pairs, config, config | seqan3::align_cfg::vectorise);
+
+    // Fixed 32 bit lanes without the adaptive score width.
+    seqan3::test::expect_same_alignment_scores(sequence_pairs,
+                                               config,
+                                               config |
+                                               seqan3::align_cfg::vectorise |
+                                               seqan3::detail::vectorised_score_type_element<int32_t>{});
+}
+
+TEST(aminoacid_affine_unbanded_simd, global_blosum62)
+{
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::aminoacid_scoring_scheme{
+                                                 seqan3::aminoacid_similarity_matrix::BLOSUM62}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}};
+
+    test_vectorised_alignment(config);
+}
+
+TEST(aminoacid_affine_unbanded_simd, local_blosum62)
+{
+    auto config = seqan3::align_cfg::mode{seqan3::local_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::aminoacid_scoring_scheme{
+                                                 seqan3::aminoacid_similarity_matrix::BLOSUM62}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}};
+
+    test_vectorised_alignment(config);
+}
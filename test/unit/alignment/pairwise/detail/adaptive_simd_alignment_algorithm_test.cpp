@@ -0,0 +1,170 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <seqan3/alignment/configuration/align_config_vectorised_score_type.hpp>
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/pairwise/detail/adaptive_simd_alignment_algorithm.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/alignment_scores.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+// Sequence pairs of alternating lengths, such that consecutive pairs need different score widths.
+auto generate_mixed_length_pairs(std::vector<size_t> const & lengths, size_t const count)
+{
+    std::vector<std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>> sequence_pairs{};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t const length = lengths[i % lengths.size()];
+        sequence_pairs.emplace_back(seqan3::test::generate_sequence<seqan3::dna4>(length, length / 10, i),
+                                    seqan3::test::generate_sequence<seqan3::dna4>(length, length / 10, i + count));
+    }
+
+    return sequence_pairs;
+}
+
+TEST(adaptive_simd_alignment_algorithm, traits)
+{
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{}} |
+                  seqan3::align_cfg::result{seqan3::with_score} |
+                  seqan3::align_cfg::vectorise;
+    using traits_t = seqan3::detail::alignment_configuration_traits<decltype(config)>;
+
+    EXPECT_TRUE(traits_t::is_score_width_adaptive);
+    EXPECT_FALSE(traits_t::checks_lane_overflow);
+    EXPECT_EQ(traits_t::alignments_per_vector, seqan3::simd_traits<seqan3::simd_type_t<int8_t>>::length);
+    EXPECT_EQ(traits_t::runtime_alignments_per_vector(),
+              seqan3::detail::simd_length_for<int8_t>(seqan3::detail::runtime_simd_instruction_set()));
+
+    using fixed_config_t = decltype(config | seqan3::detail::vectorised_score_type_element<int16_t>{});
+    using fixed_traits_t = seqan3::detail::alignment_configuration_traits<fixed_config_t>;
+
+    EXPECT_FALSE(fixed_traits_t::is_score_width_adaptive);
+    EXPECT_TRUE((std::same_as<typename fixed_traits_t::original_score_type, int32_t>));
+    EXPECT_TRUE((std::same_as<typename fixed_traits_t::score_type, seqan3::simd_type_t<int16_t>>));
+    EXPECT_EQ(fixed_traits_t::alignments_per_vector, seqan3::simd_traits<seqan3::simd_type_t<int16_t>>::length);
+    EXPECT_TRUE(fixed_traits_t::checks_lane_overflow);
+    EXPECT_EQ(fixed_traits_t::lane_overflow_margin, 8191);
+
+    using alignment_config_t = decltype(config | seqan3::align_cfg::result{seqan3::with_alignment});
+    EXPECT_FALSE(seqan3::detail::alignment_configuration_traits<alignment_config_t>::is_score_width_adaptive);
+}
+
+TEST(adaptive_simd_alignment_algorithm, global_8_and_16_bit)
+{
+    // The scores of the short sequence pairs fit into the 8 bit lanes, the others are recomputed in the 16 bit lanes.
+    auto sequence_pairs = generate_mixed_length_pairs({10, 200, 14, 14, 30, 0, 8}, 150);
+
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                               seqan3::mismatch_score{-5}}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::result{seqan3::with_score};
+
+    seqan3::test::expect_same_alignment_scores(sequence_pairs, config, config | seqan3::align_cfg::vectorise);
+}
+
+TEST(adaptive_simd_alignment_algorithm, local_8_and_16_bit)
+{
+    auto sequence_pairs = generate_mixed_length_pairs({10, 200, 14, 14, 30, 0, 8}, 150);
+
+    auto config = seqan3::align_cfg::mode{seqan3::local_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                               seqan3::mismatch_score{-5}}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::result{seqan3::with_score};
+
+    seqan3::test::expect_same_alignment_scores(sequence_pairs, config, config | seqan3::align_cfg::vectorise);
+}
+
+TEST(adaptive_simd_alignment_algorithm, global_16_and_32_bit)
+{
+    // The 8 bit lanes cannot be used with these scores and the scores of the long sequence pairs overflow the 16 bit
+    // lanes, such that they are recomputed in the 32 bit lanes.
+    auto sequence_pairs = generate_mixed_length_pairs({1000, 1300, 50}, 24);
+
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{20},
+                                                                               seqan3::mismatch_score{-30}}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-10}, seqan3::gap_open_score{-40}}} |
+                  seqan3::align_cfg::result{seqan3::with_score};
+
+    seqan3::test::expect_same_alignment_scores(sequence_pairs, config, config | seqan3::align_cfg::vectorise);
+}
+
+// Reports the id and the lane width of the computed alignment.
+struct lane_width_result
+{
+    size_t index;
+    size_t width;
+
+    size_t id() const
+    {
+        return index;
+    }
+};
+
+TEST(adaptive_simd_alignment_algorithm, recomputes_overflowed_pairs_in_order)
+{
+    using sequence_pair_t = std::pair<std::vector<seqan3::dna4>, std::vector<seqan3::dna4>>;
+    using chunk_t = std::vector<std::pair<sequence_pair_t, size_t>>;
+    using callback_t = std::function<void(lane_width_result)>;
+
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{}} |
+                  seqan3::align_cfg::result{seqan3::with_score} |
+                  seqan3::align_cfg::vectorise;
+
+    using algorithm_t = seqan3::detail::adaptive_simd_alignment_algorithm<decltype(config),
+                                                                          chunk_t const &,
+                                                                          callback_t>;
+
+    // The narrower lanes skip every sequence pair whose first sequence is longer than the width in bytes, as if its
+    // scores overflowed.
+    std::vector<size_t> batch_sizes{};
+    algorithm_t algorithm{config, seqan3::detail::simd_instruction_set::sse4, [&] (auto scalar_type)
+    {
+        using scalar_t = typename decltype(scalar_type)::type;
+        return typename algorithm_t::algorithm_type{[&] (auto batch, callback_t callback)
+        {
+            batch_sizes.push_back(std::ranges::size(batch));
+            for (auto && [sequence_pair, index] : batch)
+            {
+                if (sizeof(scalar_t) == 4 || std::ranges::size(sequence_pair.first) <= sizeof(scalar_t))
+                    callback(lane_width_result{index, sizeof(scalar_t)});
+            }
+        }};
+    }};
+
+    chunk_t chunk{};
+    std::vector<size_t> const lengths{1, 4, 2, 0, 8, 1, 3};
+    for (size_t i = 0; i < lengths.size(); ++i)
+        chunk.emplace_back(sequence_pair_t{std::vector<seqan3::dna4>(lengths[i]), {}}, i + 10);
+
+    std::vector<size_t> ids{};
+    std::vector<size_t> widths{};
+    algorithm(chunk, [&] (lane_width_result result)
+    {
+        ids.push_back(result.id());
+        widths.push_back(result.width);
+    });
+
+    EXPECT_EQ(ids, (std::vector<size_t>{10, 11, 12, 13, 14, 15, 16}));
+    EXPECT_EQ(widths, (std::vector<size_t>{1, 4, 2, 1, 4, 1, 4}));
+
+    // Only the overflowed sequence pairs are recomputed in the wider lanes.
+    EXPECT_EQ(batch_sizes, (std::vector<size_t>{7, 4, 3}));
+}
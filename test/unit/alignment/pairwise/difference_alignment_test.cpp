@@ -0,0 +1,168 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/rescore_alignment.hpp>
+
+// Computes the global alignment score within the band of diagonals (column minus row) with gap open -10 and gap
+// extension -1.
+template <typename alphabet_t, typename scoring_scheme_t>
+int32_t banded_global_score(std::vector<alphabet_t> const & sequence1,
+                            std::vector<alphabet_t> const & sequence2,
+                            scoring_scheme_t const & scoring_scheme,
+                            int64_t const lower_diagonal,
+                            int64_t const upper_diagonal)
+{
+    int32_t const gap_extension = -1;
+    int32_t const gap_open = -11;
+    int32_t const infinity = std::numeric_limits<int32_t>::lowest() / 2;
+    int64_t const columns = sequence1.size();
+    int64_t const rows = sequence2.size();
+
+    std::vector<std::vector<int32_t>> optimal(columns + 1, std::vector<int32_t>(rows + 1, infinity));
+    auto horizontal = optimal;
+    auto vertical = optimal;
+    optimal[0][0] = 0;
+
+    for (int64_t column = 0; column <= columns; ++column)
+    {
+        for (int64_t row = 0; row <= rows; ++row)
+        {
+            if ((column == 0 && row == 0) || column - row < lower_diagonal || column - row > upper_diagonal)
+                continue;
+
+            if (column > 0)
+                horizontal[column][row] = std::max(horizontal[column - 1][row] + gap_extension,
+                                                   optimal[column - 1][row] + gap_open);
+            if (row > 0)
+                vertical[column][row] = std::max(vertical[column][row - 1] + gap_extension,
+                                                 optimal[column][row - 1] + gap_open);
+
+            int32_t score = std::max({horizontal[column][row], vertical[column][row], infinity});
+            if (column > 0 && row > 0)
+                score = std::max(score, optimal[column - 1][row - 1] +
+                                        scoring_scheme.score(sequence1[column - 1], sequence2[row - 1]));
+            optimal[column][row] = score;
+        }
+    }
+
+    return optimal[columns][rows];
+}
+
+// The sequence pairs are long enough to be computed with the difference recurrence, except for a few pairs that are
+// computed with the scalar algorithm.
+template <typename alphabet_t>
+auto long_sequence_pairs()
+{
+    auto sequence_pairs = seqan3::test::generate_sequence_pairs<alphabet_t>(1100, 4, 100);
+
+    auto similar_sequence = seqan3::test::generate_sequence<alphabet_t>(2500, 0, 7);
+    auto similar_sequence_mutated = similar_sequence;
+    for (size_t i = 1; i < similar_sequence_mutated.size(); i += 37)
+        similar_sequence_mutated.erase(similar_sequence_mutated.begin() + i);
+    for (size_t i = 5; i < similar_sequence_mutated.size(); i += 53)
+        similar_sequence_mutated[i] = similar_sequence_mutated[i - 1];
+    sequence_pairs.emplace_back(similar_sequence, similar_sequence_mutated);
+    sequence_pairs.emplace_back(similar_sequence_mutated, similar_sequence);
+
+    return sequence_pairs;
+}
+
+template <typename scoring_scheme_t>
+auto global_config(scoring_scheme_t const & scoring_scheme)
+{
+    return seqan3::align_cfg::mode{seqan3::global_alignment} |
+           seqan3::align_cfg::scoring{scoring_scheme} |
+           seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+           seqan3::align_cfg::difference_recurrence;
+}
+
+template <typename alphabet_t, typename config_t, typename scoring_scheme_t>
+void compare_with_reference(config_t const & config,
+                            scoring_scheme_t const & scoring_scheme,
+                            int64_t const lower_diagonal = std::numeric_limits<int64_t>::lowest(),
+                            int64_t const upper_diagonal = std::numeric_limits<int64_t>::max())
+{
+    auto sequence_pairs = long_sequence_pairs<alphabet_t>();
+
+    std::vector<int32_t> expected_scores{};
+    for (auto && [sequence1, sequence2] : sequence_pairs)
+        expected_scores.push_back(banded_global_score(sequence1, sequence2, scoring_scheme,
+                                                      lower_diagonal, upper_diagonal));
+
+    size_t index = 0;
+    for (auto && result : seqan3::align_pairwise(sequence_pairs,
+                                                 config | seqan3::align_cfg::result{seqan3::with_alignment}))
+    {
+        auto const & [sequence1, sequence2] = sequence_pairs[index];
+
+        EXPECT_EQ(result.score(), expected_scores[index]);
+        EXPECT_EQ(result.front_coordinate().first, 0u);
+        EXPECT_EQ(result.front_coordinate().second, 0u);
+        EXPECT_EQ(result.back_coordinate().first, sequence1.size());
+        EXPECT_EQ(result.back_coordinate().second, sequence2.size());
+
+        auto const rescored = seqan3::test::rescore_alignment<alphabet_t>(result.alignment(), scoring_scheme, -10, -1);
+        EXPECT_EQ(rescored.score, expected_scores[index]);
+        EXPECT_EQ(rescored.sequence1, sequence1);
+        EXPECT_EQ(rescored.sequence2, sequence2);
+        EXPECT_GE(rescored.lowest_diagonal, lower_diagonal);
+        EXPECT_LE(rescored.highest_diagonal, upper_diagonal);
+        ++index;
+    }
+
+    EXPECT_EQ(index, sequence_pairs.size());
+
+    // Computing the back coordinate only must give the same scores.
+    std::vector<int32_t> scores{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs,
+                                                 config | seqan3::align_cfg::result{seqan3::with_back_coordinate}))
+        scores.push_back(result.score());
+
+    EXPECT_EQ(scores, expected_scores);
+}
+
+TEST(difference_alignment, global_dna4)
+{
+    seqan3::nucleotide_scoring_scheme scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+    compare_with_reference<seqan3::dna4>(global_config(scoring_scheme), scoring_scheme);
+}
+
+TEST(difference_alignment, global_blosum62)
+{
+    seqan3::aminoacid_scoring_scheme scoring_scheme{seqan3::aminoacid_similarity_matrix::BLOSUM62};
+    compare_with_reference<seqan3::aa27>(global_config(scoring_scheme), scoring_scheme);
+}
+
+TEST(difference_alignment, banded_dna4)
+{
+    // The band contains the origin and the sink of all matrices.
+    seqan3::nucleotide_scoring_scheme scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+    auto config = global_config(scoring_scheme) |
+                  seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-250}, seqan3::upper_bound{250}}};
+
+    compare_with_reference<seqan3::dna4>(config, scoring_scheme, -250, 250);
+}
+
+TEST(difference_alignment, scores_exceeding_8_bit_lanes)
+{
+    // The differences of these scores do not fit into 8 bits and are computed with the scalar algorithm.
+    seqan3::nucleotide_scoring_scheme scoring_scheme{seqan3::match_score{60}, seqan3::mismatch_score{-40}};
+    compare_with_reference<seqan3::dna4>(global_config(scoring_scheme), scoring_scheme);
+}
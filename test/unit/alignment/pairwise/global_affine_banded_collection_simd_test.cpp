@@ -0,0 +1,73 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+#include "fixture/global_affine_banded.hpp"
+#include "pairwise_alignment_collection_test_template.hpp"
+
+namespace seqan3::test::alignment::collection::simd::global::affine::banded
+{
+
+static auto dna4_all_same = []()
+{
+    auto base_fixture = fixture::global::affine::banded::dna4_01;
+    using fixture_t = decltype(base_fixture);
+
+    std::vector<fixture_t> data{};
+    for (size_t i = 0; i < 100; ++i)
+        data.push_back(base_fixture);
+
+    return alignment_fixture_collection{base_fixture.config | seqan3::align_cfg::vectorise, data};
+}();
+
+} // namespace seqan3::test::alignment::collection::simd::global::affine::banded
+
+using pairwise_collection_simd_global_affine_banded_testing_types = ::testing::Types<
+        pairwise_alignment_fixture<&seqan3::test::alignment::collection::simd::global::affine::banded::dna4_all_same>
+    >;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pairwise_collection_simd_global_affine_banded,
+                               pairwise_alignment_collection_test,
+                               pairwise_collection_simd_global_affine_banded_testing_types, );
+
+// Sequence pairs of different lengths are sliced individually to the band before they are packed into the simd vector.
+TEST(global_affine_banded_collection_simd, different_length)
+{
+    auto sequence_pairs = seqan3::test::generate_sequence_pairs<seqan3::dna4>(100, 100, 30);
+
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                               seqan3::mismatch_score{-5}}} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::band{seqan3::static_band{seqan3::lower_bound{-20}, seqan3::upper_bound{20}}} |
+                  seqan3::align_cfg::result{seqan3::with_back_coordinate};
+
+    std::vector<int32_t> expected_scores{};
+    std::vector<seqan3::alignment_coordinate> expected_coordinates{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config))
+    {
+        expected_scores.push_back(result.score());
+        expected_coordinates.push_back(result.back_coordinate());
+    }
+
+    std::vector<int32_t> scores(sequence_pairs.size());
+    std::vector<seqan3::alignment_coordinate> coordinates(sequence_pairs.size());
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config | seqan3::align_cfg::vectorise))
+    {
+        scores[result.id()] = result.score();
+        coordinates[result.id()] = result.back_coordinate();
+    }
+
+    EXPECT_EQ(scores, expected_scores);
+    EXPECT_EQ(coordinates, expected_coordinates);
+}
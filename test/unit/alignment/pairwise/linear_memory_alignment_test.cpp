@@ -0,0 +1,133 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/rescore_alignment.hpp>
+
+using seqan3::operator""_dna4;
+
+// The linear memory alignment must find an alignment with the optimal score of the default algorithm, which serves as
+// reference. In case of several optimal alignments the reported alignments might differ.
+template <typename alphabet_t, typename config_t, typename scoring_scheme_t>
+void compare_with_default_alignment(config_t const & config, scoring_scheme_t const & scoring_scheme)
+{
+    auto sequence_pairs = seqan3::test::generate_sequence_pairs<alphabet_t>(150, 40, 100);
+    sequence_pairs.emplace_back(std::vector<alphabet_t>{}, seqan3::test::generate_sequence<alphabet_t>(10, 0, 1));
+    sequence_pairs.emplace_back(seqan3::test::generate_sequence<alphabet_t>(10, 0, 2), std::vector<alphabet_t>{});
+
+    auto similar_sequence = seqan3::test::generate_sequence<alphabet_t>(1000, 0, 7);
+    auto similar_sequence_mutated = similar_sequence;
+    for (size_t i = 1; i < similar_sequence_mutated.size(); i += 37)
+        similar_sequence_mutated.erase(similar_sequence_mutated.begin() + i);
+    sequence_pairs.emplace_back(similar_sequence, similar_sequence_mutated);
+
+    auto const gaps = seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}};
+    auto const alignment_config = config |
+                                  seqan3::align_cfg::scoring{scoring_scheme} |
+                                  seqan3::align_cfg::gap{gaps};
+
+    std::vector<int32_t> expected_scores{};
+    std::vector<seqan3::alignment_coordinate> expected_back_coordinates{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs,
+                                                 alignment_config |
+                                                 seqan3::align_cfg::result{seqan3::with_back_coordinate}))
+    {
+        expected_scores.push_back(result.score());
+        expected_back_coordinates.push_back(result.back_coordinate());
+    }
+
+    size_t index = 0;
+    for (auto && result : seqan3::align_pairwise(sequence_pairs,
+                                                 alignment_config |
+                                                 seqan3::align_cfg::linear_memory |
+                                                 seqan3::align_cfg::result{seqan3::with_alignment}))
+    {
+        auto const & [sequence1, sequence2] = sequence_pairs[index];
+
+        EXPECT_EQ(result.score(), expected_scores[index]);
+        EXPECT_EQ(result.back_coordinate(), expected_back_coordinates[index]);
+
+        auto const rescored = seqan3::test::rescore_alignment<alphabet_t>(result.alignment(), scoring_scheme, -10, -1);
+        auto const front = result.front_coordinate();
+        auto const back = result.back_coordinate();
+        EXPECT_EQ(rescored.score, expected_scores[index]);
+        EXPECT_EQ(rescored.sequence1,
+                  (std::vector<alphabet_t>{sequence1.begin() + front.first, sequence1.begin() + back.first}));
+        EXPECT_EQ(rescored.sequence2,
+                  (std::vector<alphabet_t>{sequence2.begin() + front.second, sequence2.begin() + back.second}));
+        ++index;
+    }
+
+    EXPECT_EQ(index, sequence_pairs.size());
+
+    // Computing only the score must give the same results.
+    std::vector<int32_t> scores{};
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, alignment_config | seqan3::align_cfg::linear_memory))
+        scores.push_back(result.score());
+
+    EXPECT_EQ(scores, expected_scores);
+}
+
+TEST(linear_memory_alignment, global_dna4)
+{
+    compare_with_default_alignment<seqan3::dna4>(seqan3::align_cfg::mode{seqan3::global_alignment},
+                                                 seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                   seqan3::mismatch_score{-5}});
+}
+
+TEST(linear_memory_alignment, local_dna4)
+{
+    compare_with_default_alignment<seqan3::dna4>(seqan3::align_cfg::mode{seqan3::local_alignment},
+                                                 seqan3::nucleotide_scoring_scheme{seqan3::match_score{4},
+                                                                                   seqan3::mismatch_score{-5}});
+}
+
+TEST(linear_memory_alignment, global_blosum62)
+{
+    compare_with_default_alignment<seqan3::aa27>(seqan3::align_cfg::mode{seqan3::global_alignment},
+                                                 seqan3::aminoacid_scoring_scheme{
+                                                     seqan3::aminoacid_similarity_matrix::BLOSUM62});
+}
+
+TEST(linear_memory_alignment, local_blosum62)
+{
+    compare_with_default_alignment<seqan3::aa27>(seqan3::align_cfg::mode{seqan3::local_alignment},
+                                                 seqan3::aminoacid_scoring_scheme{
+                                                     seqan3::aminoacid_similarity_matrix::BLOSUM62});
+}
+
+TEST(linear_memory_alignment, global_example)
+{
+    std::vector<seqan3::dna4> sequence1 = "AACCGGTTAACCGGTT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGTCGTA"_dna4;
+
+    seqan3::nucleotide_scoring_scheme scoring_scheme{seqan3::match_score{4}, seqan3::mismatch_score{-5}};
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{scoring_scheme} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::result{seqan3::with_alignment};
+
+    auto expected = *std::ranges::begin(seqan3::align_pairwise(std::tie(sequence1, sequence2), config));
+    auto result = *std::ranges::begin(seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                                             config | seqan3::align_cfg::linear_memory));
+
+    EXPECT_EQ(result.score(), expected.score());
+    EXPECT_EQ(result.front_coordinate(), expected.front_coordinate());
+    EXPECT_EQ(result.back_coordinate(), expected.back_coordinate());
+    EXPECT_EQ(seqan3::test::rescore_alignment<seqan3::dna4>(result.alignment(), scoring_scheme, -10, -1).score,
+              expected.score());
+}
@@ -0,0 +1,156 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/rescore_alignment.hpp>
+
+using seqan3::operator""_aa27;
+using seqan3::operator""_dna4;
+
+// Returns a copy of the sequence with substitutions, insertions and deletions at the given rate of positions.
+std::vector<seqan3::dna4> mutate(std::vector<seqan3::dna4> const & sequence, size_t const rate, size_t const seed)
+{
+    std::mt19937 generator{seed};
+    std::vector<seqan3::dna4> mutated{};
+
+    for (seqan3::dna4 const symbol : sequence)
+    {
+        switch (generator() % (3 * rate))
+        {
+            case 0: mutated.push_back(seqan3::assign_rank_to(generator() % 4, seqan3::dna4{})); break;
+            case 1: break;
+            case 2: mutated.push_back(seqan3::assign_rank_to(generator() % 4, seqan3::dna4{})); [[fallthrough]];
+            default: mutated.push_back(symbol);
+        }
+    }
+
+    return mutated;
+}
+
+struct wavefront_alignment : public ::testing::TestWithParam<std::tuple<int32_t, int32_t, int32_t, int32_t>>
+{
+    int32_t match = std::get<0>(GetParam());
+    int32_t mismatch = std::get<1>(GetParam());
+    int32_t gap_open = std::get<2>(GetParam());
+    int32_t gap_extension = std::get<3>(GetParam());
+
+    seqan3::nucleotide_scoring_scheme<> scoring_scheme{seqan3::match_score{match}, seqan3::mismatch_score{mismatch}};
+
+    auto config() const
+    {
+        return seqan3::align_cfg::mode{seqan3::global_alignment} |
+               seqan3::align_cfg::scoring{scoring_scheme} |
+               seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{gap_extension},
+                                                         seqan3::gap_open_score{gap_open}}};
+    }
+
+    // Similar sequence pairs with different mutation rates, unrelated sequence pairs and empty sequences.
+    auto sequence_pairs() const
+    {
+        auto pairs = seqan3::test::generate_sequence_pairs<seqan3::dna4>(150, 10, 50);
+
+        for (size_t rate : {5, 20, 100})
+        {
+            for (size_t seed = 0; seed < 10; ++seed)
+            {
+                auto sequence = seqan3::test::generate_sequence<seqan3::dna4>(300, 100, seed);
+                pairs.emplace_back(sequence, mutate(sequence, rate, seed));
+            }
+        }
+
+        pairs.emplace_back(std::vector<seqan3::dna4>{}, "ACGT"_dna4);
+        pairs.emplace_back("ACGT"_dna4, std::vector<seqan3::dna4>{});
+        pairs.emplace_back(std::vector<seqan3::dna4>{}, std::vector<seqan3::dna4>{});
+        return pairs;
+    }
+};
+
+TEST_P(wavefront_alignment, same_as_default_algorithm)
+{
+    auto pairs = sequence_pairs();
+
+    std::vector<int32_t> expected_scores{};
+    for (auto && result : seqan3::align_pairwise(pairs, config() | seqan3::align_cfg::result{seqan3::with_score}))
+        expected_scores.push_back(result.score());
+
+    std::vector<int32_t> scores{};
+    for (auto && result : seqan3::align_pairwise(pairs, config() | seqan3::align_cfg::wavefront |
+                                                                   seqan3::align_cfg::result{seqan3::with_score}))
+        scores.push_back(result.score());
+
+    EXPECT_EQ(scores, expected_scores);
+
+    size_t index = 0;
+    for (auto && result : seqan3::align_pairwise(pairs, config() | seqan3::align_cfg::wavefront |
+                                                                   seqan3::align_cfg::result{seqan3::with_alignment}))
+    {
+        auto const & [sequence1, sequence2] = pairs[index];
+
+        EXPECT_EQ(result.score(), expected_scores[index]);
+        EXPECT_EQ(result.front_coordinate().first, 0u);
+        EXPECT_EQ(result.front_coordinate().second, 0u);
+        EXPECT_EQ(result.back_coordinate().first, sequence1.size());
+        EXPECT_EQ(result.back_coordinate().second, sequence2.size());
+
+        auto const rescored = seqan3::test::rescore_alignment<seqan3::dna4>(result.alignment(), scoring_scheme,
+                                                                          gap_open, gap_extension);
+        EXPECT_EQ(rescored.score, expected_scores[index]);
+        EXPECT_EQ(rescored.sequence1, sequence1);
+        EXPECT_EQ(rescored.sequence2, sequence2);
+        ++index;
+    }
+
+    EXPECT_EQ(index, pairs.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(scores, wavefront_alignment, ::testing::Values(std::tuple{4, -5, -10, -1},
+                                                                        std::tuple{0, -1, 0, -1},
+                                                                        std::tuple{2, -3, -5, -2},
+                                                                        std::tuple{3, 1, -2, 0}));
+
+TEST(wavefront_alignment_configuration, invalid_scoring_scheme)
+{
+    auto sequence1 = "ARNDCQEGH"_aa27;
+    auto sequence2 = "ARNDCQEGH"_aa27;
+
+    // The substitution matrix has different scores for the matches.
+    seqan3::aminoacid_scoring_scheme scoring_scheme{seqan3::aminoacid_similarity_matrix::BLOSUM62};
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{scoring_scheme} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::wavefront;
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), config),
+                 seqan3::invalid_alignment_configuration);
+}
+
+TEST(wavefront_alignment_configuration, invalid_gap_scheme)
+{
+    auto sequence1 = "ACGT"_dna4;
+    auto sequence2 = "ACGT"_dna4;
+
+    // The gap score is not below half of the match score.
+    seqan3::nucleotide_scoring_scheme scoring_scheme{seqan3::match_score{2}, seqan3::mismatch_score{-3}};
+    auto config = seqan3::align_cfg::mode{seqan3::global_alignment} |
+                  seqan3::align_cfg::scoring{scoring_scheme} |
+                  seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{1}, seqan3::gap_open_score{-10}}} |
+                  seqan3::align_cfg::wavefront;
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), config),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <seqan3/alignment/configuration/all.hpp>
+#include <seqan3/alignment/pairwise/align_pairwise.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/test/performance/sequence_generator.hpp>
+
+using seqan3::operator""_dna4;
+
+struct extension_result
+{
+    int32_t score;
+    size_t column;
+    size_t row;
+};
+
+// Computes the best extension over the full alignment matrix with gap open -10 and gap extension -1.
+// The gap open score of the recursion includes the first gap extension.
+template <typename scoring_scheme_t>
+extension_result full_extension(std::vector<seqan3::dna4> const & sequence1,
+                                std::vector<seqan3::dna4> const & sequence2,
+                                scoring_scheme_t const & scoring_scheme)
+{
+    int32_t const gap_extension = -1;
+    int32_t const gap_open = -11;
+    int32_t const infinity = std::numeric_limits<int32_t>::lowest() / 2;
+
+    std::vector<std::vector<int32_t>> optimal(sequence1.size() + 1, std::vector<int32_t>(sequence2.size() + 1));
+    auto horizontal = optimal;
+    auto vertical = optimal;
+    extension_result result{0, 0, 0};
+
+    for (size_t column = 0; column <= sequence1.size(); ++column)
+    {
+        for (size_t row = 0; row <= sequence2.size(); ++row)
+        {
+            if (column == 0 || row == 0)
+            {
+                int32_t const gap_length = static_cast<int32_t>(column + row);
+                optimal[column][row] = (gap_length == 0) ? 0 : gap_open + (gap_length - 1) * gap_extension;
+                horizontal[column][row] = infinity;
+                vertical[column][row] = infinity;
+                continue;
+            }
+
+            horizontal[column][row] = std::max(horizontal[column - 1][row] + gap_extension,
+                                               optimal[column - 1][row] + gap_open);
+            vertical[column][row] = std::max(vertical[column][row - 1] + gap_extension,
+                                             optimal[column][row - 1] + gap_open);
+            optimal[column][row] = std::max({horizontal[column][row],
+                                             vertical[column][row],
+                                             optimal[column - 1][row - 1] +
+                                                 scoring_scheme.score(sequence1[column - 1], sequence2[row - 1])});
+
+            if (optimal[column][row] > result.score)
+                result = extension_result{optimal[column][row], column, row};
+        }
+    }
+
+    return result;
+}
+
+struct x_drop_alignment : public ::testing::Test
+{
+    seqan3::nucleotide_scoring_scheme<> scoring_scheme{seqan3::match_score{2}, seqan3::mismatch_score{-3}};
+
+    auto base_config(int32_t const x_drop) const
+    {
+        return seqan3::align_cfg::mode{seqan3::global_alignment} |
+               seqan3::align_cfg::scoring{scoring_scheme} |
+               seqan3::align_cfg::gap{seqan3::gap_scheme{seqan3::gap_score{-1}, seqan3::gap_open_score{-10}}} |
+               seqan3::align_cfg::x_drop{x_drop};
+    }
+
+    auto config(int32_t const x_drop) const
+    {
+        return base_config(x_drop) | seqan3::align_cfg::result{seqan3::with_front_coordinate};
+    }
+};
+
+TEST_F(x_drop_alignment, unrestricted)
+{
+    auto sequence_pairs = seqan3::test::generate_sequence_pairs<seqan3::dna4>(100, 50, 80);
+
+    size_t index = 0;
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config(std::numeric_limits<int32_t>::max() / 4)))
+    {
+        auto const & [sequence1, sequence2] = sequence_pairs[index++];
+        auto expected = full_extension(sequence1, sequence2, scoring_scheme);
+
+        EXPECT_EQ(result.score(), expected.score);
+        EXPECT_EQ(result.back_coordinate().first, expected.column);
+        EXPECT_EQ(result.back_coordinate().second, expected.row);
+        EXPECT_EQ(result.front_coordinate().first, 0u);
+        EXPECT_EQ(result.front_coordinate().second, 0u);
+    }
+
+    EXPECT_EQ(index, sequence_pairs.size());
+}
+
+TEST_F(x_drop_alignment, lower_bound)
+{
+    auto sequence_pairs = seqan3::test::generate_sequence_pairs<seqan3::dna4>(100, 50, 80);
+
+    size_t index = 0;
+    for (auto && result : seqan3::align_pairwise(sequence_pairs, config(10)))
+    {
+        auto const & [sequence1, sequence2] = sequence_pairs[index++];
+        EXPECT_LE(result.score(), full_extension(sequence1, sequence2, scoring_scheme).score);
+        EXPECT_GE(result.score(), 0);
+    }
+}
+
+TEST_F(x_drop_alignment, stops_after_seed)
+{
+    std::vector<seqan3::dna4> seed = "ACGTTGCAACGTAGCTAGCTTACG"_dna4;
+    std::vector<seqan3::dna4> sequence1 = seed;
+    std::vector<seqan3::dna4> sequence2 = seed;
+
+    // Append unrelated sequences which are much longer than the seed.
+    auto tail1 = seqan3::test::generate_sequence<seqan3::dna4>(2000, 0, 1);
+    auto tail2 = seqan3::test::generate_sequence<seqan3::dna4>(2000, 0, 2);
+    sequence1.insert(sequence1.end(), tail1.begin(), tail1.end());
+    sequence2.insert(sequence2.end(), tail2.begin(), tail2.end());
+
+    auto result = *std::ranges::begin(seqan3::align_pairwise(std::tie(sequence1, sequence2), config(10)));
+
+    EXPECT_GE(result.score(), static_cast<int32_t>(2 * seed.size()));
+    EXPECT_GE(result.back_coordinate().first, seed.size());
+    EXPECT_GE(result.back_coordinate().second, seed.size());
+    EXPECT_LT(result.back_coordinate().first, seed.size() + 20);
+    EXPECT_LT(result.back_coordinate().second, seed.size() + 20);
+}
+
+TEST_F(x_drop_alignment, empty_sequence)
+{
+    std::vector<seqan3::dna4> sequence1{};
+    std::vector<seqan3::dna4> sequence2 = "ACGT"_dna4;
+
+    auto result = *std::ranges::begin(seqan3::align_pairwise(std::tie(sequence1, sequence2), config(10)));
+
+    EXPECT_EQ(result.score(), 0);
+    EXPECT_EQ(result.back_coordinate().first, 0u);
+    EXPECT_EQ(result.back_coordinate().second, 0u);
+}
+
+TEST_F(x_drop_alignment, invalid_configuration)
+{
+    std::vector<seqan3::dna4> sequence1 = "ACGT"_dna4;
+    std::vector<seqan3::dna4> sequence2 = "ACGT"_dna4;
+
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2), config(-1)),
+                 seqan3::invalid_alignment_configuration);
+    EXPECT_THROW(seqan3::align_pairwise(std::tie(sequence1, sequence2),
+                                        base_config(10) | seqan3::align_cfg::result{seqan3::with_alignment}),
+                 seqan3::invalid_alignment_configuration);
+}
@@ -7,9 +7,15 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include <seqan3/alignment/scoring/aminoacid_scoring_scheme.hpp>
 #include <seqan3/alignment/scoring/detail/simd_matrix_scoring_scheme.hpp>
+#include <seqan3/alignment/scoring/nucleotide_scoring_scheme.hpp>
 #include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
 #include <seqan3/core/simd/simd.hpp>
 #include <seqan3/test/pretty_printing.hpp>
 #include <seqan3/test/simd_utility.hpp>
@@ -23,8 +29,8 @@ struct simd_matrix_scoring_scheme_test : public ::testing::Test
     scalar_t padded_value2 = std::numeric_limits<scalar_t>::lowest() >> 1; // sets the bit before most significant bit.
 };
 
-using simd_test_types = ::testing::Types<//seqan3::simd::simd_type_t<int8_t>,
-                                         //seqan3::simd::simd_type_t<int16_t>,
+using simd_test_types = ::testing::Types<seqan3::simd::simd_type_t<int8_t>,
+                                         seqan3::simd::simd_type_t<int16_t>,
                                          seqan3::simd::simd_type_t<int32_t>>;
 
 TYPED_TEST_SUITE(simd_matrix_scoring_scheme_test, simd_test_types, );
@@ -219,3 +225,88 @@ TYPED_TEST(simd_matrix_scoring_scheme_test, score_local_with_padding)
     simd_value2[0] = 3;
     SIMD_EQ(scheme.score(simd_value1, simd_value2), result);
 }
+
+// Scores all pairs of symbols and padded symbols with the simd vectors of every supported instruction set, which uses
+// the profile lookup with shuffles for some of the simd vector types.
+template <typename scalar_t, typename alphabet_t, typename alignment_t>
+void expect_scores_in_every_instruction_set()
+{
+    using set_t = seqan3::detail::simd_instruction_set;
+    constexpr size_t dimension = seqan3::alphabet_size<alphabet_t> + 1;
+
+    // A distinct score for most of the cells, such that a lookup of a wrong cell is detected.
+    seqan3::nucleotide_scoring_scheme<>::matrix_type matrix{};
+    for (size_t i = 0; i < matrix.size(); ++i)
+        for (size_t j = 0; j < matrix.size(); ++j)
+            matrix[i][j] = static_cast<int8_t>(i * 7 - j * 3);
+
+    seqan3::nucleotide_scoring_scheme<> const scalar_scheme{matrix};
+    scalar_t const padding_score = std::same_as<alignment_t, seqan3::detail::global_alignment_type> ? 1 : -1;
+
+    std::vector<scalar_t> expected{};
+    for (size_t row = 0; row < dimension; ++row)
+    {
+        for (size_t column = 0; column < dimension; ++column)
+        {
+            if (row + 1 == dimension || column + 1 == dimension)
+                expected.push_back(padding_score);
+            else
+                expected.push_back(scalar_scheme.score(seqan3::assign_rank_to(row, alphabet_t{}),
+                                                       seqan3::assign_rank_to(column, alphabet_t{})));
+        }
+    }
+
+    for (set_t instruction_set : {set_t::generic, set_t::sse4, set_t::avx2, set_t::avx512})
+    {
+        if (instruction_set > seqan3::detail::runtime_simd_instruction_set())
+            continue;
+
+        std::vector<scalar_t> scores = seqan3::detail::invoke_simd_kernel<scalar_t>([&] (auto simd_type)
+        {
+            using simd_t = typename decltype(simd_type)::type;
+            using scheme_t = seqan3::detail::simd_matrix_scoring_scheme<simd_t,
+                                                                        alphabet_t,
+                                                                        alignment_t,
+                                                                        seqan3::nucleotide_scoring_scheme<>>;
+            constexpr size_t length = seqan3::simd_traits<simd_t>::length;
+
+            scheme_t const scheme{scalar_scheme};
+            std::vector<scalar_t> scores(dimension * dimension);
+
+            for (size_t first_cell = 0; first_cell < scores.size(); first_cell += length)
+            {
+                simd_t lhs{};
+                simd_t rhs{};
+                for (size_t lane = 0; lane < length; ++lane)
+                {
+                    size_t const cell = (first_cell + lane) % scores.size();
+                    size_t const row = cell / dimension;
+                    size_t const column = cell % dimension;
+                    scalar_t const padded_value = std::numeric_limits<scalar_t>::lowest();
+                    lhs[lane] = (row + 1 == dimension) ? padded_value : static_cast<scalar_t>(row);
+                    rhs[lane] = (column + 1 == dimension) ? padded_value >> 1 : static_cast<scalar_t>(column);
+                }
+
+                simd_t const result = scheme.score(lhs, rhs);
+                for (size_t lane = 0; lane < length && first_cell + lane < scores.size(); ++lane)
+                    scores[first_cell + lane] = result[lane];
+            }
+
+            return scores;
+        }, instruction_set);
+
+        EXPECT_EQ(scores, expected) << "instruction set: " << static_cast<int>(instruction_set);
+    }
+}
+
+TYPED_TEST(simd_matrix_scoring_scheme_test, score_in_every_instruction_set)
+{
+    using scalar_t = typename seqan3::simd_traits<TypeParam>::scalar_type;
+    using global_t = seqan3::detail::global_alignment_type;
+    using local_t = seqan3::detail::local_alignment_type;
+
+    expect_scores_in_every_instruction_set<scalar_t, seqan3::dna4, global_t>();
+    expect_scores_in_every_instruction_set<scalar_t, seqan3::dna4, local_t>();
+    expect_scores_in_every_instruction_set<scalar_t, seqan3::dna15, global_t>();
+    expect_scores_in_every_instruction_set<scalar_t, seqan3::dna15, local_t>();
+}
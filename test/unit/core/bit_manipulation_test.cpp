@@ -220,6 +220,39 @@ TYPED_TEST(unsigned_operations, popcount)
     }
 }
 
+TYPED_TEST(unsigned_operations, extract_bits)
+{
+    using unsigned_t = TypeParam;
+    EXPECT_EQ(seqan3::detail::extract_bits<unsigned_t>(0b1011'0110, 0b0000'0000), 0b0u);
+    EXPECT_EQ(seqan3::detail::extract_bits<unsigned_t>(0b1011'0110, 0b1111'1111), 0b1011'0110u);
+    EXPECT_EQ(seqan3::detail::extract_bits<unsigned_t>(0b1011'0110, 0b0000'1111), 0b0110u);
+    EXPECT_EQ(seqan3::detail::extract_bits<unsigned_t>(0b1011'0110, 0b1111'0000), 0b1011u);
+    EXPECT_EQ(seqan3::detail::extract_bits<unsigned_t>(0b1011'0110, 0b1100'0011), 0b1010u);
+    EXPECT_EQ(seqan3::detail::extract_bits<unsigned_t>(0b1011'0110, 0b1010'1010), 0b1101u);
+
+    unsigned_t const all_bits = std::numeric_limits<unsigned_t>::max();
+    unsigned_t const high_bit = unsigned_t{1u} << (seqan3::detail::sizeof_bits<unsigned_t> - 1);
+    EXPECT_EQ(seqan3::detail::extract_bits(all_bits, all_bits), all_bits);
+    EXPECT_EQ(seqan3::detail::extract_bits(high_bit, high_bit), 1u);
+    EXPECT_EQ(seqan3::detail::extract_bits(all_bits, static_cast<unsigned_t>(high_bit | 1u)), 0b11u);
+
+    // compare against extracting bit by bit
+    for (unsigned_t value = 0b1011'0110, mask = 0b0110'1101, k = 0u; k < max_iterations; ++k)
+    {
+        unsigned_t expected{0};
+        for (uint8_t position = 0, result_position = 0; position < seqan3::detail::sizeof_bits<unsigned_t>; ++position)
+        {
+            if ((mask >> position) & 1u)
+                expected |= static_cast<unsigned_t>(((value >> position) & 1u) << result_position++);
+        }
+
+        EXPECT_EQ(seqan3::detail::extract_bits(value, mask), expected) << "Extracting " << mask << " from " << value;
+
+        value = static_cast<unsigned_t>(value * 0x5DEE'CE66Du + 11u);
+        mask = static_cast<unsigned_t>(mask * 0x9E37'79B9u + k);
+    }
+}
+
 TEST(to_little_endian, byte)
 {
     uint8_t val = 0x01;
@@ -0,0 +1,142 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
+#include <seqan3/core/simd/simd_traits.hpp>
+
+using seqan3::detail::simd_instruction_set;
+
+// Returns the number of lanes of the simd type and checks that the lane-wise addition is correct.
+struct sum_kernel
+{
+    template <typename simd_t>
+    size_t operator()(std::type_identity<simd_t>) const
+    {
+        constexpr size_t lanes = seqan3::simd::simd_traits<simd_t>::length;
+
+        simd_t lhs{};
+        simd_t rhs{};
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            lhs[lane] = lane;
+            rhs[lane] = 2 * lane;
+        }
+
+        simd_t const sum = lhs + rhs;
+        for (size_t lane = 0; lane < lanes; ++lane)
+            if (sum[lane] != static_cast<int16_t>(3 * lane))
+                return 0;
+
+        return lanes;
+    }
+};
+
+TEST(simd_dispatch, compile_time_simd_instruction_set)
+{
+    EXPECT_EQ(static_cast<size_t>(seqan3::detail::compile_time_simd_instruction_set),
+              static_cast<size_t>(seqan3::detail::default_simd_max_length<seqan3::detail::builtin_simd>));
+}
+
+TEST(simd_dispatch, runtime_simd_instruction_set)
+{
+    simd_instruction_set const instruction_set = seqan3::detail::runtime_simd_instruction_set();
+
+    EXPECT_GE(instruction_set, seqan3::detail::compile_time_simd_instruction_set);
+    EXPECT_EQ(instruction_set, seqan3::detail::runtime_simd_instruction_set());
+#if !SEQAN3_WITH_SIMD_DISPATCH
+    EXPECT_EQ(instruction_set, seqan3::detail::compile_time_simd_instruction_set);
+#endif
+}
+
+TEST(simd_dispatch, simd_type_for_t)
+{
+    EXPECT_EQ((seqan3::simd::simd_traits<seqan3::detail::simd_type_for_t<int16_t,
+                                                                         simd_instruction_set::generic>>::length),
+              1u);
+    EXPECT_EQ((seqan3::simd::simd_traits<seqan3::detail::simd_type_for_t<int16_t,
+                                                                         simd_instruction_set::sse4>>::length),
+              8u);
+    EXPECT_EQ((seqan3::simd::simd_traits<seqan3::detail::simd_type_for_t<int16_t,
+                                                                         simd_instruction_set::avx512>>::length),
+              32u);
+}
+
+TEST(simd_dispatch, invoke_simd_kernel)
+{
+    simd_instruction_set const runtime_set = seqan3::detail::runtime_simd_instruction_set();
+
+    EXPECT_EQ(seqan3::detail::invoke_simd_kernel<int16_t>(sum_kernel{}),
+              std::max<size_t>(1u, static_cast<size_t>(runtime_set) / sizeof(int16_t)));
+
+    for (simd_instruction_set instruction_set : {simd_instruction_set::generic,
+                                                 simd_instruction_set::sse4,
+                                                 simd_instruction_set::avx2,
+                                                 simd_instruction_set::avx512})
+    {
+        if (instruction_set > runtime_set)
+            continue;
+
+        EXPECT_EQ(seqan3::detail::invoke_simd_kernel<int16_t>(sum_kernel{}, instruction_set),
+                  std::max<size_t>(1u, static_cast<size_t>(instruction_set) / sizeof(int16_t)));
+    }
+}
+
+TEST(simd_dispatch, simd_instruction_set_of)
+{
+    EXPECT_EQ((seqan3::detail::simd_instruction_set_of<seqan3::detail::simd_type_for_t<int8_t,
+                                                                                        simd_instruction_set::sse4>>),
+              simd_instruction_set::sse4);
+    EXPECT_EQ((seqan3::detail::simd_instruction_set_of<seqan3::detail::simd_type_for_t<int32_t,
+                                                                                        simd_instruction_set::avx2>>),
+              simd_instruction_set::avx2);
+    EXPECT_EQ((seqan3::detail::simd_instruction_set_of<seqan3::detail::simd_type_for_t<int64_t,
+                                                                                        simd_instruction_set::avx512>>),
+              simd_instruction_set::avx512);
+    EXPECT_EQ(seqan3::detail::simd_length_for<int32_t>(simd_instruction_set::generic), 1u);
+    EXPECT_EQ(seqan3::detail::simd_length_for<int32_t>(simd_instruction_set::avx2), 8u);
+}
+
+TEST(simd_dispatch, visit_simd_instruction_set)
+{
+    for (simd_instruction_set instruction_set : {simd_instruction_set::generic,
+                                                 simd_instruction_set::sse4,
+                                                 simd_instruction_set::avx2,
+                                                 simd_instruction_set::avx512})
+    {
+        EXPECT_EQ(seqan3::detail::visit_simd_instruction_set([] (auto instruction_set_constant)
+                  {
+                      return decltype(instruction_set_constant)::value;
+                  }, instruction_set),
+                  instruction_set);
+    }
+}
+
+TEST(simd_dispatch, invoke_simd_kernel_of)
+{
+    simd_instruction_set const runtime_set = seqan3::detail::runtime_simd_instruction_set();
+
+    for (simd_instruction_set instruction_set : {simd_instruction_set::sse4,
+                                                 simd_instruction_set::avx2,
+                                                 simd_instruction_set::avx512})
+    {
+        if (instruction_set > runtime_set)
+            continue;
+
+        seqan3::detail::visit_simd_instruction_set([] (auto instruction_set_constant)
+        {
+            using simd_t = seqan3::detail::simd_type_for_t<int16_t, decltype(instruction_set_constant)::value>;
+
+            EXPECT_EQ(seqan3::detail::invoke_simd_kernel_of<simd_t>(sum_kernel{}),
+                      seqan3::simd::simd_traits<simd_t>::length);
+        }, instruction_set);
+    }
+}
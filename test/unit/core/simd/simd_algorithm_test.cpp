@@ -11,6 +11,7 @@
 #include <numeric>
 
 #include <seqan3/core/detail/pack_algorithm.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
 #include <seqan3/core/simd/simd.hpp>
 #include <seqan3/core/simd/simd_algorithm.hpp>
 #include <seqan3/test/simd_utility.hpp>
@@ -57,6 +58,44 @@ TEST(simd_algorithm, transpose)
     }
 }
 
+// Invokes the test with every simd instruction set that is supported by the executing CPU.
+template <typename test_t>
+void for_each_simd_instruction_set(test_t && test)
+{
+    using seqan3::detail::simd_instruction_set;
+
+    for (simd_instruction_set instruction_set : {simd_instruction_set::sse4,
+                                                 simd_instruction_set::avx2,
+                                                 simd_instruction_set::avx512})
+    {
+        if (instruction_set <= seqan3::detail::runtime_simd_instruction_set())
+            seqan3::detail::visit_simd_instruction_set(test, instruction_set);
+    }
+}
+
+TEST(simd_algorithm, transpose_instruction_sets)
+{
+    for_each_simd_instruction_set([] (auto instruction_set)
+    {
+        using simd_t = seqan3::detail::simd_type_for_t<uint8_t, decltype(instruction_set)::value>;
+
+        if constexpr (seqan3::simd::simd_traits<simd_t>::length > 1)
+        {
+            std::array<simd_t, seqan3::simd::simd_traits<simd_t>::length> matrix;
+
+            for (size_t i = 0; i < matrix.size(); ++i)
+                for (size_t j = 0; j < matrix.size(); ++j)
+                    matrix[i][j] = i * matrix.size() + j;
+
+            seqan3::simd::transpose(matrix);
+
+            for (size_t i = 0; i < matrix.size(); ++i)
+                for (size_t j = 0; j < matrix.size(); ++j)
+                    EXPECT_EQ(matrix[i][j], static_cast<uint8_t>(j * matrix.size() + i));
+        }
+    });
+}
+
 //-----------------------------------------------------------------------------
 // Algorithm load
 //-----------------------------------------------------------------------------
@@ -232,3 +271,18 @@ TYPED_TEST(simd_algorithm_upcast, unsigned)
             EXPECT_EQ(t[i], static_cast<target_type>(static_cast<TypeParam>(-10)));
     });
 }
+
+TEST(simd_algorithm, upcast_instruction_sets)
+{
+    for_each_simd_instruction_set([] (auto instruction_set)
+    {
+        using src_simd_t = seqan3::detail::simd_type_for_t<int8_t, decltype(instruction_set)::value>;
+        using target_simd_t = seqan3::detail::simd_type_for_t<int32_t, decltype(instruction_set)::value>;
+
+        src_simd_t const s = seqan3::simd::iota<src_simd_t>(-10);
+        target_simd_t const t = seqan3::simd::upcast<target_simd_t>(s);
+
+        for (size_t i  = 0; i < seqan3::simd::simd_traits<target_simd_t>::length; ++i)
+            EXPECT_EQ(t[i], static_cast<int32_t>(i) - 10);
+    });
+}
@@ -13,6 +13,7 @@
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/core/bit_manipulation.hpp>
+#include <seqan3/core/simd/detail/simd_dispatch.hpp>
 #include <seqan3/core/simd/simd_traits.hpp>
 #include <seqan3/core/simd/simd.hpp>
 #include <seqan3/core/simd/view_to_simd.hpp>
@@ -349,3 +350,43 @@ TYPED_TEST(view_to_simd_test, issue_1813)
         this->compare(v, this->transformed_simd_vec | std::views::take(10));
     }
 }
+
+TEST(view_to_simd, instruction_sets)
+{
+    using seqan3::detail::simd_instruction_set;
+
+    auto test = [] (auto instruction_set)
+    {
+        using simd_t = seqan3::detail::simd_type_for_t<int8_t, decltype(instruction_set)::value>;
+        constexpr size_t length = seqan3::simd::simd_traits<simd_t>::length;
+
+        // Sequences that end on different boundaries of the chunks loaded with the transposition.
+        std::vector<std::vector<seqan3::dna4>> sequences(length);
+        for (size_t i = 0; i < length; ++i)
+            sequences[i] = seqan3::test::generate_sequence<seqan3::dna4>(4 * length - 3 * i);
+
+        size_t position = 0;
+        for (auto && chunk : sequences | seqan3::views::to_simd<simd_t>)
+        {
+            for (auto && vector : chunk)
+            {
+                for (size_t i = 0; i < length; ++i)
+                {
+                    int8_t expected = (position < sequences[i].size()) ? seqan3::to_rank(sequences[i][position])
+                                                                       : seqan3::alphabet_size<seqan3::dna4>;
+                    EXPECT_EQ(vector[i], expected);
+                }
+                ++position;
+            }
+        }
+        EXPECT_EQ(position, 4 * length);
+    };
+
+    for (simd_instruction_set instruction_set : {simd_instruction_set::sse4,
+                                                 simd_instruction_set::avx2,
+                                                 simd_instruction_set::avx512})
+    {
+        if (instruction_set <= seqan3::detail::runtime_simd_instruction_set())
+            seqan3::detail::visit_simd_instruction_set(test, instruction_set);
+    }
+}
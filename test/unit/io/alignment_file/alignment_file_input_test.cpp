@@ -17,6 +17,7 @@
 #include <seqan3/std/ranges>
 #include <seqan3/test/tmp_filename.hpp>
 
+using seqan3::operator""_cigar_op;
 using seqan3::operator""_dna4;
 using seqan3::operator""_dna5;
 using seqan3::operator""_phred42;
@@ -582,6 +583,53 @@ TEST_F(alignment_file_input_sam_format_f, construct_from_stream_and_read_alignme
     EXPECT_EQ(counter, 3u);
 }
 
+struct cigar_alignment_traits : seqan3::alignment_file_input_default_traits<>
+{
+    using alignment_type = seqan3::cigar_alignment;
+};
+
+using cigar_alignment_fields = seqan3::fields<seqan3::field::seq, seqan3::field::alignment>;
+
+TEST_F(alignment_file_input_sam_format_f, read_cigar_alignments)
+{
+    seqan3::alignment_file_input<cigar_alignment_traits, cigar_alignment_fields> fin{std::istringstream{input},
+                                                                                     seqan3::format_sam{}};
+
+    EXPECT_TRUE((std::same_as<decltype(fin)::alignment_type, seqan3::cigar_alignment>));
+
+    size_t counter = 0;
+    for (auto & [ seq, alignment ] : fin)
+    {
+        auto [ gapped_ref, gapped_query ] = alignment.alignment(ref_seqs[0], seq);
+
+        EXPECT_TRUE(std::ranges::equal(gapped_ref, std::get<0>(alignments_expected[counter])));
+        EXPECT_TRUE(std::ranges::equal(gapped_query, std::get<1>(alignments_expected[counter])));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(alignment_file_input_sam_format_f, cigar_of_previous_record_is_not_kept)
+{
+    std::string const sam{"r1\t0\t*\t0\t0\t2M1I\t*\t0\t0\tACG\t*\n"
+                          "r2\t4\t*\t0\t0\t*\t*\t0\t0\tACG\t*\n"
+                          "r3\t0\t*\t0\t0\t3M\t*\t0\t0\tACG\t*\n"};
+
+    seqan3::alignment_file_input fin{std::istringstream{sam},
+                                     seqan3::format_sam{},
+                                     seqan3::fields<seqan3::field::cigar>{}};
+
+    std::vector<std::vector<seqan3::cigar>> cigars{};
+    for (auto & [ cigar_vector ] : fin)
+        cigars.push_back(cigar_vector);
+
+    EXPECT_EQ(cigars, (std::vector<std::vector<seqan3::cigar>>{{{2, 'M'_cigar_op}, {1, 'I'_cigar_op}},
+                                                                {},
+                                                                {{3, 'M'_cigar_op}}}));
+}
+
 // ----------------------------------------------------------------------------
 // BAM format specificities
 // ----------------------------------------------------------------------------
@@ -682,4 +730,23 @@ TEST_F(alignment_file_input_bam_format_f, construct_by_stream)
 
     EXPECT_EQ(counter, 3u);
 }
+
+TEST_F(alignment_file_input_bam_format_f, read_cigar_alignments)
+{
+    std::istringstream stream{binary_input};
+    seqan3::alignment_file_input<cigar_alignment_traits, cigar_alignment_fields> fin{stream, seqan3::format_bam{}};
+
+    size_t counter = 0;
+    for (auto & [ seq, alignment ] : fin)
+    {
+        auto [ gapped_ref, gapped_query ] = alignment.alignment(ref_seqs[0], seq);
+
+        EXPECT_TRUE(std::ranges::equal(gapped_ref, std::get<0>(alignments_expected[counter])));
+        EXPECT_TRUE(std::ranges::equal(gapped_query, std::get<1>(alignments_expected[counter])));
+
+        counter++;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
 #endif // SEQAN3_HAS_ZLIB
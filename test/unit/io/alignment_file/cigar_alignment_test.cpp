@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <seqan3/alphabet/gap/gapped.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/io/alignment_file/cigar_alignment.hpp>
+#include <seqan3/std/algorithm>
+
+using seqan3::operator""_cigar_op;
+using seqan3::operator""_dna4;
+
+struct cigar_alignment_test : public ::testing::Test
+{
+    // 2S3M1I2M1D2M1S on the reference ACTGATCGAGAGGATC at position 1
+    std::vector<seqan3::cigar> cigar_vector{{2, 'S'_cigar_op}, {3, 'M'_cigar_op}, {1, 'I'_cigar_op},
+                                            {2, 'M'_cigar_op}, {1, 'D'_cigar_op}, {2, 'M'_cigar_op},
+                                            {1, 'S'_cigar_op}};
+
+    seqan3::dna4_vector reference{"ACTGATCGAGAGGATC"_dna4};
+    seqan3::dna4_vector query{"TTCTGAATCAG"_dna4};
+};
+
+TEST_F(cigar_alignment_test, positions)
+{
+    seqan3::cigar_alignment alignment{cigar_vector, 1};
+
+    EXPECT_FALSE(alignment.empty());
+    EXPECT_EQ(alignment.reference_begin(), 1);
+    EXPECT_EQ(alignment.reference_end(), 9);
+    EXPECT_EQ(alignment.query_begin(), 2);
+    EXPECT_EQ(alignment.query_end(), 10);
+}
+
+TEST_F(cigar_alignment_test, packed_cigar)
+{
+    seqan3::cigar_alignment alignment{cigar_vector, 1};
+
+    // BAM codes: M = 0, I = 1, D = 2, S = 4
+    EXPECT_EQ(alignment.packed_cigar(), (std::vector<uint32_t>{2 << 4 | 4, 3 << 4, 1 << 4 | 1, 2 << 4,
+                                                               1 << 4 | 2, 2 << 4, 1 << 4 | 4}));
+    EXPECT_TRUE(std::ranges::equal(alignment.cigar_view(), cigar_vector));
+}
+
+TEST_F(cigar_alignment_test, alignment)
+{
+    seqan3::cigar_alignment alignment{cigar_vector, 1};
+
+    auto [gapped_reference, gapped_query] = alignment.alignment(reference, query);
+
+    using seqan3::gap;
+    std::vector<seqan3::gapped<seqan3::dna4>> expected_reference{'C'_dna4, 'T'_dna4, 'G'_dna4, gap{}, 'A'_dna4,
+                                                                 'T'_dna4, 'C'_dna4, 'G'_dna4, 'A'_dna4};
+    std::vector<seqan3::gapped<seqan3::dna4>> expected_query{'C'_dna4, 'T'_dna4, 'G'_dna4, 'A'_dna4, 'A'_dna4,
+                                                             'T'_dna4, gap{}, 'C'_dna4, 'A'_dna4};
+
+    EXPECT_TRUE(std::ranges::equal(gapped_reference, expected_reference));
+    EXPECT_TRUE(std::ranges::equal(gapped_query, expected_query));
+}
+
+TEST_F(cigar_alignment_test, clear_and_comparison)
+{
+    seqan3::cigar_alignment alignment{cigar_vector, 1};
+    seqan3::cigar_alignment other{};
+
+    EXPECT_NE(alignment, other);
+
+    other.assign(cigar_vector, 1);
+    EXPECT_EQ(alignment, other);
+
+    alignment.clear();
+    EXPECT_TRUE(alignment.empty());
+    EXPECT_EQ(alignment.reference_end(), 0);
+    EXPECT_EQ(alignment.query_end(), 0);
+
+    auto [gapped_reference, gapped_query] = alignment.alignment(reference, query);
+    EXPECT_TRUE(std::ranges::empty(gapped_reference));
+    EXPECT_TRUE(std::ranges::empty(gapped_query));
+}
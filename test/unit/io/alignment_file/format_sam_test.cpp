@@ -187,6 +187,13 @@ TEST_F(sam_format, windows_file)
     EXPECT_EQ(seqan3::get<seqan3::field::id>(*fin.begin()), std::string{"read1"});
 }
 
+TEST_F(sam_format, format_error_missing_fields)
+{
+    std::istringstream istream(std::string("read1\t41\tref\t1\t61\t*\tref\t10\t300\tACGT\n"));
+    seqan3::alignment_file_input fin{istream, seqan3::format_sam{}};
+    EXPECT_THROW(fin.begin(), seqan3::format_error);
+}
+
 TEST_F(sam_format, format_error_illegal_character_in_seq)
 {
     std::istringstream istream(std::string("*\t0\t*\t0\t0\t*\t*\t0\t0\tAC!T\t*\n"));
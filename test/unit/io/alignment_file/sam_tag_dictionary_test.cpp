@@ -7,7 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include <seqan3/io/alignment_file/sam_tag_dictionary.hpp>
 #include <seqan3/std/concepts>
@@ -159,3 +161,90 @@ TEST(sam_tag_dictionary, get_function_temporary_const)
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CO"_tag>())>));
     EXPECT_TRUE((std::is_rvalue_reference_v<decltype(std::move(dict2).get<"CG"_tag>())>));
 }
+
+TEST(sam_tag_dictionary, lookup)
+{
+    seqan3::sam_tag_dictionary dict{};
+
+    EXPECT_TRUE(dict.empty());
+    EXPECT_EQ(dict.find("NM"_tag), dict.end());
+    EXPECT_THROW(dict.at("NM"_tag), std::out_of_range);
+
+    dict.get<"NM"_tag>() = 3;
+    dict.get<"AS"_tag>() = 10;
+
+    EXPECT_EQ(dict.size(), 2u);
+    EXPECT_TRUE(dict.contains("NM"_tag));
+    EXPECT_EQ(dict.count("NM"_tag), 1u);
+    EXPECT_EQ(dict.count("XS"_tag), 0u);
+    ASSERT_NE(dict.find("AS"_tag), dict.end());
+    EXPECT_EQ(dict.find("AS"_tag)->first, "AS"_tag);
+    EXPECT_EQ(std::get<int32_t>(dict.at("AS"_tag)), 10);
+
+    auto const & dict2 = dict;
+    EXPECT_EQ(dict2.find("NM"_tag)->first, "NM"_tag);
+    EXPECT_THROW(dict2.at("XS"_tag), std::out_of_range);
+
+    // the tag of an entry cannot be modified
+    EXPECT_TRUE((std::is_const_v<std::remove_reference_t<decltype(dict.begin()->first)>>));
+}
+
+TEST(sam_tag_dictionary, modifiers)
+{
+    using variant_type = seqan3::sam_tag_dictionary::variant_type;
+
+    seqan3::sam_tag_dictionary dict{};
+
+    EXPECT_TRUE(dict.insert({"NM"_tag, variant_type{3}}).second);
+    EXPECT_FALSE(dict.insert({"NM"_tag, variant_type{5}}).second); // does not overwrite
+    EXPECT_TRUE(dict.emplace("CO"_tag, std::string{"comment"}).second);
+    EXPECT_EQ(dict.get<"NM"_tag>(), 3);
+
+    EXPECT_EQ(dict.erase("XS"_tag), 0u);
+    EXPECT_EQ(dict.erase("NM"_tag), 1u);
+    EXPECT_FALSE(dict.contains("NM"_tag));
+
+    auto it = dict.erase(dict.find("CO"_tag));
+    EXPECT_EQ(it, dict.end());
+    EXPECT_TRUE(dict.empty());
+
+    dict.get<"NM"_tag>() = 1;
+    dict.get<"XS"_tag>() = 3;
+    dict.get<"AS"_tag>() = 2; // inserted in front
+    it = dict.erase(dict.find("NM"_tag)); // erased in between
+    ASSERT_NE(it, dict.end());
+    EXPECT_EQ(it->first, "XS"_tag);
+    EXPECT_EQ(dict.size(), 2u);
+    EXPECT_EQ(dict.get<"AS"_tag>(), 2);
+
+    seqan3::sam_tag_dictionary dict2{};
+    dict2.get<"CO"_tag>() = "comment";
+    dict2 = dict;
+    EXPECT_EQ(dict2, dict);
+
+    dict.clear();
+    EXPECT_TRUE(dict.empty());
+}
+
+TEST(sam_tag_dictionary, iteration_order_and_comparison)
+{
+    seqan3::sam_tag_dictionary dict{};
+
+    dict.get<"NH"_tag>() = 3;
+    dict.get<"AS"_tag>() = 1;
+    dict.get<"NM"_tag>() = 2;
+
+    std::vector<uint16_t> tags{};
+    for (auto & [tag, variant] : dict)
+        tags.push_back(tag);
+
+    EXPECT_EQ(tags, (std::vector<uint16_t>{"AS"_tag, "NH"_tag, "NM"_tag})); // sorted by tag
+
+    seqan3::sam_tag_dictionary dict2{};
+    dict2.get<"NM"_tag>() = 2;
+    dict2.get<"NH"_tag>() = 3;
+    EXPECT_NE(dict, dict2);
+
+    dict2.get<"AS"_tag>() = 1;
+    EXPECT_EQ(dict, dict2);
+}
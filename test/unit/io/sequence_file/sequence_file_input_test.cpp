@@ -6,6 +6,8 @@
 // -----------------------------------------------------------------------------------------------------
 
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -323,6 +325,193 @@ TEST_F(sequence_file_input_f, file_view)
     EXPECT_EQ(counter, 3u);
 }
 
+// ----------------------------------------------------------------------------
+// read_batch
+// ----------------------------------------------------------------------------
+
+TEST_F(sequence_file_input_f, read_batch)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+
+    auto & batch = fin.read_batch(2);
+    EXPECT_TRUE((std::same_as<decltype(batch), typename decltype(fin)::batch_type &>));
+    ASSERT_EQ(batch.size(), 2u);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        EXPECT_TRUE((std::ranges::equal(batch.sequences[i], seq_comp[i])));
+        EXPECT_TRUE((std::ranges::equal(batch.ids[i], id_comp[i])));
+    }
+    EXPECT_TRUE(batch.qualities.empty());
+
+    size_t const concat_capacity = batch.sequences.concat_capacity();
+
+    EXPECT_EQ(std::addressof(fin.read_batch(2)), std::addressof(batch)); // the batch buffer is reused
+    ASSERT_EQ(batch.size(), 1u);
+    EXPECT_TRUE((std::ranges::equal(batch.sequences[0], seq_comp[2])));
+    EXPECT_TRUE((std::ranges::equal(batch.ids[0], id_comp[2])));
+    EXPECT_GE(batch.sequences.concat_capacity(), concat_capacity); // clearing keeps the memory
+
+    EXPECT_TRUE(fin.read_batch(2).empty());
+    EXPECT_TRUE(fin.begin() == fin.end());
+}
+
+TEST_F(sequence_file_input_f, read_batch_mixed_with_iteration)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input},
+                                    seqan3::format_fasta{},
+                                    seqan3::fields<seqan3::field::id>{}};
+
+    auto it = fin.begin();
+    EXPECT_TRUE((std::ranges::equal(seqan3::get<seqan3::field::id>(*it), id_comp[0])));
+
+    auto & batch = fin.read_batch(1); // continues with the current record
+    ASSERT_EQ(batch.size(), 1u);
+    EXPECT_TRUE(batch.sequences.empty());
+    EXPECT_TRUE((std::ranges::equal(batch.ids[0], id_comp[0])));
+
+    it = fin.begin();
+    EXPECT_TRUE((std::ranges::equal(seqan3::get<seqan3::field::id>(*it), id_comp[1])));
+    ++it;
+    EXPECT_TRUE((std::ranges::equal(seqan3::get<seqan3::field::id>(*it), id_comp[2])));
+    ++it;
+    EXPECT_TRUE(it == fin.end());
+    EXPECT_TRUE(fin.read_batch(10).empty());
+}
+
+TEST_F(sequence_file_input_f, read_batch_fastq)
+{
+    std::string const fastq{"@r1\nACGT\n+\nIIII\n@r2\nAC\nGTN\n+\n!!\n!!!\n"};
+    seqan3::sequence_file_input fin{std::istringstream{fastq}, seqan3::format_fastq{}};
+
+    auto & batch = fin.read_batch(10);
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_TRUE((std::ranges::equal(batch.sequences[1], "ACGTN"_dna5)));
+    EXPECT_TRUE((std::ranges::equal(batch.ids[1], std::string{"r2"})));
+    EXPECT_EQ(batch.qualities[0].size(), 4u);
+    EXPECT_EQ(batch.qualities[1].size(), 5u);
+    EXPECT_EQ(batch.qualities.concat_size(), 9u);
+}
+
+// ----------------------------------------------------------------------------
+// parallel_batches
+// ----------------------------------------------------------------------------
+
+TEST_F(sequence_file_input_f, parallel_batches)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+
+    EXPECT_TRUE((std::ranges::input_range<decltype(fin.parallel_batches(2, 2))>));
+    EXPECT_TRUE((std::same_as<std::ranges::range_value_t<decltype(fin.parallel_batches(2, 2))>,
+                              typename decltype(fin)::batch_type>));
+
+    std::vector<size_t> batch_sizes{};
+    size_t counter = 0;
+    for (auto & batch : fin.parallel_batches(2, 2))
+    {
+        batch_sizes.push_back(batch.size());
+
+        for (size_t i = 0; i < batch.size(); ++i, ++counter)
+        {
+            EXPECT_TRUE((std::ranges::equal(batch.sequences[i], seq_comp[counter])));
+            EXPECT_TRUE((std::ranges::equal(batch.ids[i], id_comp[counter])));
+        }
+        EXPECT_TRUE(batch.qualities.empty());
+    }
+
+    EXPECT_EQ(counter, 3u);
+    EXPECT_EQ(batch_sizes, (std::vector<size_t>{2, 1}));
+}
+
+TEST_F(sequence_file_input_f, parallel_batches_equal_sequential_reading)
+{
+    // multi-line sequences and qualities, quality lines that start with '@' and windows line endings
+    std::string fastq{};
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        std::string const seq(i % 40 + 1, "ACGTN"[i % 5]);
+        std::string const qual(i % 40 + 1, "@!#I"[i % 4]);
+        std::string const eol = (i % 3 == 0) ? "\r\n" : "\n";
+        fastq += "@read " + std::to_string(i) + eol +
+                 seq.substr(0, 7) + eol + (seq.size() > 7 ? seq.substr(7) + eol : "") +
+                 "+" + eol +
+                 qual.substr(0, 11) + eol + (qual.size() > 11 ? qual.substr(11) + eol : "");
+    }
+
+    for (size_t const thread_count : {1u, 4u})
+    {
+        seqan3::sequence_file_input sequential{std::istringstream{fastq}, seqan3::format_fastq{}};
+        seqan3::sequence_file_input parallel{std::istringstream{fastq}, seqan3::format_fastq{}};
+
+        auto record_it = sequential.begin();
+        size_t counter = 0;
+        for (auto & batch : parallel.parallel_batches(thread_count, 64))
+        {
+            EXPECT_LE(batch.size(), 64u);
+
+            for (size_t i = 0; i < batch.size(); ++i, ++counter, ++record_it)
+            {
+                ASSERT_TRUE(record_it != sequential.end());
+                EXPECT_TRUE((std::ranges::equal(batch.sequences[i], seqan3::get<seqan3::field::seq>(*record_it))));
+                EXPECT_TRUE((std::ranges::equal(batch.ids[i], seqan3::get<seqan3::field::id>(*record_it))));
+                EXPECT_TRUE((std::ranges::equal(batch.qualities[i], seqan3::get<seqan3::field::qual>(*record_it))));
+            }
+        }
+
+        EXPECT_EQ(counter, 1000u);
+        EXPECT_TRUE(record_it == sequential.end());
+    }
+}
+
+TEST_F(sequence_file_input_f, parallel_batches_custom_fields_and_options)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input},
+                                    seqan3::format_fasta{},
+                                    seqan3::fields<seqan3::field::id>{}};
+    fin.options.truncate_ids = true;
+
+    size_t counter = 0;
+    for (auto & batch : fin.parallel_batches(3, 1))
+    {
+        ASSERT_EQ(batch.size(), 1u);
+        EXPECT_TRUE(batch.sequences.empty());
+        EXPECT_TRUE((std::ranges::equal(batch.ids[0], (counter == 0) ? std::string{"TEST"} : id_comp[counter])));
+        ++counter;
+    }
+
+    EXPECT_EQ(counter, 3u);
+}
+
+TEST_F(sequence_file_input_f, parallel_batches_empty_stream)
+{
+    seqan3::sequence_file_input fin{std::istringstream{std::string{}}, seqan3::format_fasta{}};
+    auto batches = fin.parallel_batches(2, 10);
+
+    EXPECT_TRUE(batches.begin() == batches.end());
+}
+
+TEST_F(sequence_file_input_f, parallel_batches_parse_error)
+{
+    // the third record misses its sequence/quality separator
+    std::string const fastq{"@r1\nACGT\n+\nIIII\n@r2\nACGT\n+\nIIII\n@r3\nACGT\nIIII\n@r4\nACGT\n+\nIIII\n"};
+    seqan3::sequence_file_input fin{std::istringstream{fastq}, seqan3::format_fastq{}};
+    auto batches = fin.parallel_batches(4, 1);
+
+    auto it = batches.begin();
+    EXPECT_TRUE((std::ranges::equal(it->ids[0], std::string{"r1"})));
+    ++it;
+    EXPECT_TRUE((std::ranges::equal(it->ids[0], std::string{"r2"})));
+    EXPECT_THROW(++it, seqan3::parse_error);
+    EXPECT_TRUE(it == batches.end());
+}
+
+TEST_F(sequence_file_input_f, parallel_batches_invalid_arguments)
+{
+    seqan3::sequence_file_input fin{std::istringstream{input}, seqan3::format_fasta{}};
+
+    EXPECT_THROW(fin.parallel_batches(0, 10), std::invalid_argument);
+    EXPECT_THROW(fin.parallel_batches(10, 0), std::invalid_argument);
+}
+
 // ----------------------------------------------------------------------------
 // decompression
 // ----------------------------------------------------------------------------
@@ -0,0 +1,258 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <seqan3/io/sequence_file/input.hpp>
+#include <seqan3/io/sequence_file/output.hpp>
+#include <seqan3/io/stream/buffer.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using seqan3::operator""_dna5;
+
+seqan3::stream_buffer_options make_options(size_t const buffer_size, bool const with_pool = false)
+{
+    seqan3::stream_buffer_options options{};
+    options.buffer_size = buffer_size;
+    if (with_pool)
+        options.pool = std::make_shared<seqan3::stream_buffer_pool>();
+    return options;
+}
+
+// -----------------------------------------------------------------------------
+// stream_buffer_pool
+// -----------------------------------------------------------------------------
+
+TEST(stream_buffer_pool, acquire_allocates)
+{
+    seqan3::stream_buffer_pool pool{};
+
+    std::vector<char> buffer = pool.acquire(100);
+    EXPECT_EQ(buffer.size(), 100u);
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST(stream_buffer_pool, release_and_reuse)
+{
+    seqan3::stream_buffer_pool pool{};
+
+    std::vector<char> buffer = pool.acquire(100);
+    char const * data = buffer.data();
+    pool.release(std::move(buffer));
+    EXPECT_EQ(pool.size(), 1u);
+
+    // a smaller buffer is served from the pool without allocating
+    std::vector<char> reused = pool.acquire(50);
+    EXPECT_EQ(reused.size(), 50u);
+    EXPECT_EQ(reused.data(), data);
+    EXPECT_EQ(pool.size(), 0u);
+    pool.release(std::move(reused));
+
+    // a larger buffer is allocated, the pooled buffer stays in the pool
+    std::vector<char> larger = pool.acquire(200);
+    EXPECT_EQ(larger.size(), 200u);
+    EXPECT_EQ(pool.size(), 1u);
+}
+
+TEST(stream_buffer_pool, release_empty)
+{
+    seqan3::stream_buffer_pool pool{};
+
+    pool.release(std::vector<char>{});
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST(stream_buffer_pool, max_buffers)
+{
+    seqan3::stream_buffer_pool pool{2};
+
+    for (size_t i = 0; i < 5; ++i)
+        pool.release(std::vector<char>(10));
+
+    EXPECT_EQ(pool.size(), 2u);
+}
+
+TEST(stream_buffer_pool, concurrent_use)
+{
+    seqan3::stream_buffer_pool pool{};
+
+    std::vector<std::thread> threads{};
+    for (size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&pool] ()
+        {
+            for (size_t i = 0; i < 1000; ++i)
+            {
+                std::vector<char> buffer = pool.acquire(64);
+                buffer[0] = 'x';
+                pool.release(std::move(buffer));
+            }
+        });
+    }
+
+    for (auto & thread : threads)
+        thread.join();
+
+    EXPECT_GE(pool.size(), 1u);
+    EXPECT_LE(pool.size(), 4u);
+}
+
+// -----------------------------------------------------------------------------
+// file_stream_buffer
+// -----------------------------------------------------------------------------
+
+TEST(file_stream_buffer, construction)
+{
+    EXPECT_TRUE(std::is_nothrow_default_constructible_v<seqan3::detail::file_stream_buffer>);
+    EXPECT_FALSE(std::is_copy_constructible_v<seqan3::detail::file_stream_buffer>);
+    EXPECT_FALSE(std::is_copy_assignable_v<seqan3::detail::file_stream_buffer>);
+    EXPECT_TRUE(std::is_nothrow_move_constructible_v<seqan3::detail::file_stream_buffer>);
+    EXPECT_TRUE(std::is_nothrow_move_assignable_v<seqan3::detail::file_stream_buffer>);
+
+    EXPECT_EQ(seqan3::detail::file_stream_buffer{}.size(), 0u);
+    EXPECT_EQ(seqan3::detail::file_stream_buffer{seqan3::stream_buffer_options{}}.size(), 1'000'000u);
+    EXPECT_EQ(seqan3::detail::file_stream_buffer{make_options(0)}.size(), 0u);
+    EXPECT_EQ(seqan3::detail::file_stream_buffer{make_options(42)}.size(), 42u);
+}
+
+TEST(file_stream_buffer, returns_buffer_to_pool)
+{
+    seqan3::stream_buffer_options options = make_options(100, true);
+
+    {
+        seqan3::detail::file_stream_buffer buffer{options};
+        EXPECT_EQ(options.pool->size(), 0u);
+    }
+    EXPECT_EQ(options.pool->size(), 1u);
+
+    {
+        seqan3::detail::file_stream_buffer buffer{options}; // takes the pooled buffer
+        EXPECT_EQ(options.pool->size(), 0u);
+
+        seqan3::detail::file_stream_buffer moved{std::move(buffer)};
+        EXPECT_EQ(moved.size(), 100u);
+        EXPECT_EQ(options.pool->size(), 0u);
+    } // the moved-from buffer has nothing to hand back
+    EXPECT_EQ(options.pool->size(), 1u);
+}
+
+TEST(file_stream_buffer, move_assignment_keeps_old_buffer_alive)
+{
+    seqan3::stream_buffer_options options = make_options(100, true);
+
+    seqan3::detail::file_stream_buffer buffer{options};
+    {
+        seqan3::detail::file_stream_buffer other{make_options(10)};
+        buffer = std::move(other);
+        EXPECT_EQ(buffer.size(), 10u);
+        EXPECT_EQ(options.pool->size(), 0u);
+    } // the former buffer is handed back when the moved-from object is destroyed
+    EXPECT_EQ(options.pool->size(), 1u);
+}
+
+TEST(file_stream_buffer, open_input)
+{
+    seqan3::test::tmp_filename filename{"file_stream_buffer.txt"};
+    std::string content(100'000, ' ');
+    for (size_t i = 0; i < content.size(); ++i)
+        content[i] = 'A' + i % 23;
+
+    {
+        std::ofstream file{filename.get_path(), std::ios::binary};
+        file << content;
+    }
+
+    for (bool const sequential_read_hint : {false, true})
+    {
+        for (bool const direct_io : {false, true})
+        {
+            seqan3::stream_buffer_options options = make_options(10'000);
+            options.sequential_read_hint = sequential_read_hint;
+            options.direct_io = direct_io; // falls back to the page cache if the file system does not support it
+
+            seqan3::detail::file_stream_buffer buffer{options};
+            std::unique_ptr<std::basic_istream<char>> stream = buffer.open_input(filename.get_path());
+            ASSERT_TRUE(stream->good());
+
+            // the magic header of compressed files is read and put back
+            EXPECT_EQ(stream->get(), 'A');
+            EXPECT_EQ(stream->get(), 'B');
+            stream->unget();
+            stream->unget();
+
+            EXPECT_EQ((std::string{std::istreambuf_iterator<char>{*stream}, std::istreambuf_iterator<char>{}}),
+                      content);
+
+            EXPECT_FALSE(buffer.open_input(filename.get_path().string() + ".missing")->good());
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// files opened with stream_buffer_options
+// -----------------------------------------------------------------------------
+
+TEST(stream_buffer_options, sequence_file)
+{
+    using fields_t = seqan3::fields<seqan3::field::seq, seqan3::field::id>;
+    seqan3::test::tmp_filename filename{"stream_buffer_options.fasta"};
+    seqan3::stream_buffer_options options = make_options(16, true);
+
+    {
+        seqan3::sequence_file_output fout{filename.get_path(), fields_t{}, options};
+        fout.emplace_back("ACGTACGTACGTACGTACGTACGTACGT"_dna5, std::string{"TEST 1"});
+        fout.emplace_back("AGGCTGAAGGCTGAAGGCTGA"_dna5, std::string{"Test2"});
+    }
+    EXPECT_EQ(options.pool->size(), 1u);
+
+    for (size_t i = 0; i < 3; ++i) // every file reuses the buffer of the previous one
+    {
+        seqan3::sequence_file_input fin{filename.get_path(), fields_t{}, options};
+        EXPECT_EQ(options.pool->size(), 0u);
+
+        auto it = fin.begin();
+        EXPECT_EQ(seqan3::get<seqan3::field::seq>(*it), "ACGTACGTACGTACGTACGTACGTACGT"_dna5);
+        EXPECT_EQ(seqan3::get<seqan3::field::id>(*it), "TEST 1");
+        ++it;
+        EXPECT_EQ(seqan3::get<seqan3::field::seq>(*it), "AGGCTGAAGGCTGAAGGCTGA"_dna5);
+        EXPECT_EQ(seqan3::get<seqan3::field::id>(*it), "Test2");
+        ++it;
+        EXPECT_TRUE(it == fin.end());
+    }
+    EXPECT_EQ(options.pool->size(), 1u);
+}
+
+TEST(stream_buffer_options, sequence_file_with_hints)
+{
+    using fields_t = seqan3::fields<seqan3::field::seq, seqan3::field::id>;
+    seqan3::test::tmp_filename filename{"stream_buffer_options.fasta"};
+    seqan3::stream_buffer_options options = make_options(16, true);
+    options.sequential_read_hint = true;
+    options.direct_io = true;
+
+    {
+        seqan3::sequence_file_output fout{filename.get_path(), fields_t{}, options};
+        fout.emplace_back("ACGTACGTACGTACGTACGTACGTACGT"_dna5, std::string{"TEST 1"});
+    }
+
+    seqan3::sequence_file_input fin{filename.get_path(), fields_t{}, options};
+    auto it = fin.begin();
+    EXPECT_EQ(seqan3::get<seqan3::field::seq>(*it), "ACGTACGTACGTACGTACGTACGTACGT"_dna5);
+    EXPECT_EQ(seqan3::get<seqan3::field::id>(*it), "TEST 1");
+    ++it;
+    EXPECT_TRUE(it == fin.end());
+
+    EXPECT_THROW((seqan3::sequence_file_input{filename.get_path().string() + ".missing.fasta", fields_t{}, options}),
+                 seqan3::file_open_error);
+}
@@ -7,6 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <sstream>
+#include <string>
+
 #include <seqan3/io/stream/iterator.hpp>
 #include <seqan3/std/iterator>
 
@@ -58,6 +61,27 @@ TEST(fast_istreambuf_iterator, comparison)
     EXPECT_TRUE(std::ranges::default_sentinel != it);
 }
 
+TEST(fast_istreambuf_iterator, read_line)
+{
+    std::istringstream str{"first line\r\n\nlast line"};
+    seqan3::detail::fast_istreambuf_iterator<char> it{*str.rdbuf()};
+
+    std::string line{};
+    it.read_line(line);
+    EXPECT_EQ(line, "first line\r");
+
+    it.read_line(line); // appends the empty line
+    EXPECT_EQ(line, "first line\r");
+
+    line.clear();
+    it.read_line(line); // no trailing new line
+    EXPECT_EQ(line, "last line");
+    EXPECT_TRUE(it == std::ranges::default_sentinel);
+
+    it.read_line(line); // nothing left to read
+    EXPECT_EQ(line, "last line");
+}
+
 // -----------------------------------------------------------------------------
 // fast_ostreambuf_iterator
 // -----------------------------------------------------------------------------
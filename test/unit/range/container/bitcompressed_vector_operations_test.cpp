@@ -0,0 +1,186 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna15.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/bitcompressed_vector_operations.hpp>
+#include <seqan3/range/container/dna4_operations.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/range/views/slice.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using seqan3::operator""_dna4;
+
+// The sizes cover the remainders of a 64 bit word for all tested letter widths (2, 3, 4 and 5 bits).
+std::vector<size_t> const sizes{0, 1, 2, 11, 12, 13, 15, 16, 17, 20, 21, 22, 31, 32, 33, 63, 64, 65, 100, 1000};
+
+std::string random_chars(size_t const size, unsigned const seed)
+{
+    return seqan3::test::generate_chars("ACGTNacgtnRYSWKMBDHVEFILPQZ*-!", size, seed);
+}
+
+template <typename alphabet_t>
+seqan3::bitcompressed_vector<alphabet_t> random_sequence(size_t const size, unsigned const seed)
+{
+    return seqan3::bitcompressed_vector<alphabet_t>{random_chars(size, seed) | seqan3::views::char_to<alphabet_t>};
+}
+
+template <typename alphabet_t>
+class bitcompressed_vector_operations : public ::testing::Test
+{};
+
+// dna4: 2 bit, dna5: 3 bit, dna15: 4 bit, aa27: 5 bit
+using alphabet_types = ::testing::Types<seqan3::dna4, seqan3::dna5, seqan3::dna15, seqan3::aa27>;
+
+TYPED_TEST_SUITE(bitcompressed_vector_operations, alphabet_types, );
+
+TYPED_TEST(bitcompressed_vector_operations, assign_chars_to)
+{
+    for (size_t size : sizes)
+    {
+        std::string const chars = random_chars(size, size);
+        seqan3::bitcompressed_vector<TypeParam> const expected{chars | seqan3::views::char_to<TypeParam>};
+
+        seqan3::bitcompressed_vector<TypeParam> sequence{random_sequence<TypeParam>(2 * size + 1, 0)};
+        seqan3::assign_chars_to(chars, sequence);
+        EXPECT_EQ(sequence, expected) << "size: " << size;
+    }
+}
+
+TYPED_TEST(bitcompressed_vector_operations, count_mismatches)
+{
+    for (size_t size : sizes)
+    {
+        seqan3::bitcompressed_vector<TypeParam> const lhs = random_sequence<TypeParam>(size, size);
+        seqan3::bitcompressed_vector<TypeParam> const rhs = random_sequence<TypeParam>(size + 7, size + 1);
+
+        // the whole sequences; the last letters of rhs are ignored
+        size_t expected{};
+        for (size_t i = 0; i < size; ++i)
+            expected += (lhs[i] != rhs[i]);
+
+        EXPECT_EQ(seqan3::count_mismatches(lhs, rhs), expected) << "size: " << size;
+        EXPECT_EQ(seqan3::count_mismatches(rhs, lhs), expected) << "size: " << size;
+        EXPECT_EQ(seqan3::count_mismatches(lhs, lhs), 0u) << "size: " << size;
+
+        // slices that start at different offsets of a word
+        for (size_t lhs_begin = 0; lhs_begin < std::min<size_t>(size, 7); ++lhs_begin)
+        {
+            size_t const rhs_begin = 2 * lhs_begin + 1;
+            size_t const count = size - lhs_begin;
+
+            expected = 0;
+            for (size_t i = 0; i < count; ++i)
+                expected += (lhs[lhs_begin + i] != rhs[rhs_begin + i]);
+
+            EXPECT_EQ(seqan3::count_mismatches(lhs, lhs_begin, rhs, rhs_begin, count), expected) << "size: " << size;
+        }
+    }
+}
+
+TYPED_TEST(bitcompressed_vector_operations, equal_slices)
+{
+    for (size_t size : sizes)
+    {
+        seqan3::bitcompressed_vector<TypeParam> const sequence = random_sequence<TypeParam>(size, size);
+
+        // a copy of the sequence that is shifted by 5 letters
+        seqan3::bitcompressed_vector<TypeParam> shifted = random_sequence<TypeParam>(5, 0);
+        shifted.insert(shifted.end(), sequence.begin(), sequence.end());
+
+        EXPECT_TRUE(seqan3::equal_slices(sequence, 0, shifted, 5, size)) << "size: " << size;
+
+        for (size_t i = 0; i < size; i += 7)
+        {
+            seqan3::bitcompressed_vector<TypeParam> modified = shifted;
+            modified[5 + i] = (sequence[i] == TypeParam{}) ? seqan3::assign_rank_to(1, TypeParam{}) : TypeParam{};
+
+            EXPECT_FALSE(seqan3::equal_slices(sequence, 0, modified, 5, size)) << "size: " << size << " i: " << i;
+            EXPECT_TRUE(seqan3::equal_slices(sequence, i + 1, modified, i + 6, size - i - 1)) << "size: " << size;
+            EXPECT_TRUE(seqan3::equal_slices(sequence, 0, modified, 5, i)) << "size: " << size;
+        }
+    }
+}
+
+TYPED_TEST(bitcompressed_vector_operations, slice)
+{
+    for (size_t size : sizes)
+    {
+        seqan3::bitcompressed_vector<TypeParam> const sequence = random_sequence<TypeParam>(size, size);
+
+        for (size_t begin = 0; begin <= size; begin += 3)
+        {
+            for (size_t end = begin; end <= size; end += 5)
+            {
+                seqan3::bitcompressed_vector<TypeParam> const expected{sequence | seqan3::views::slice(begin, end)};
+                EXPECT_EQ(seqan3::slice(sequence, begin, end), expected) << "begin: " << begin << " end: " << end;
+            }
+        }
+    }
+}
+
+TYPED_TEST(bitcompressed_vector_operations, packed_kmers)
+{
+    constexpr size_t width = seqan3::detail::bitcompressed_letter_width<TypeParam>;
+
+    for (size_t size : sizes)
+    {
+        seqan3::bitcompressed_vector<TypeParam> const sequence = random_sequence<TypeParam>(size, size);
+
+        for (size_t k : {size_t{1}, size_t{3}, 64 / width})
+        {
+            std::vector<uint64_t> const kmers = seqan3::packed_kmers(sequence, k);
+            ASSERT_EQ(kmers.size(), (size >= k) ? size - k + 1 : 0u) << "size: " << size << " k: " << k;
+
+            for (size_t position = 0; position < kmers.size(); ++position)
+            {
+                uint64_t expected{};
+                for (size_t i = 0; i < k; ++i)
+                    expected |= static_cast<uint64_t>(seqan3::to_rank(sequence[position + i])) << (i * width);
+
+                EXPECT_EQ(kmers[position], expected) << "size: " << size << " k: " << k;
+                EXPECT_EQ(seqan3::packed_kmer(sequence, position, k), expected) << "size: " << size << " k: " << k;
+            }
+        }
+    }
+}
+
+TEST(bitcompressed_vector_operations_dna4, packed_kmer)
+{
+    seqan3::bitcompressed_vector<seqan3::dna4> const sequence{"ACGTGCA"_dna4};
+
+    // the first letter is stored in the lowest bits: A=0, C=1, G=2, T=3
+    EXPECT_EQ(seqan3::packed_kmer(sequence, 0, 3), 0b10'01'00u);
+    EXPECT_EQ(seqan3::packed_kmer(sequence, 2, 4), 0b01'10'11'10u);
+}
+
+TEST(bitcompressed_vector_operations_dna4, simd_overload)
+{
+    // the simd overload of seqan3::dna4_operations.hpp and the generic word-level overload give the same result
+    for (size_t size : sizes)
+    {
+        std::string const chars = random_chars(size, size);
+
+        seqan3::bitcompressed_vector<seqan3::dna4> simd{};
+        seqan3::assign_chars_to(chars, simd);
+
+        seqan3::bitcompressed_vector<seqan3::dna4> word_level{};
+        seqan3::assign_chars_to<seqan3::dna4>(chars, word_level);
+
+        EXPECT_EQ(simd, word_level) << "size: " << size;
+    }
+}
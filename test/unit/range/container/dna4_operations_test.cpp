@@ -0,0 +1,162 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/dna4_operations.hpp>
+#include <seqan3/range/views/char_to.hpp>
+#include <seqan3/range/views/complement.hpp>
+#include <seqan3/range/views/to.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/std/span>
+#include <seqan3/test/performance/sequence_generator.hpp>
+#include <seqan3/test/pretty_printing.hpp>
+
+using seqan3::operator""_dna4;
+
+// The sizes cover the scalar remainders of all simd widths and of the 32 letters of a packed word.
+std::vector<size_t> const sizes{0, 1, 2, 15, 16, 17, 31, 32, 33, 63, 64, 65, 95, 96, 97, 127, 128, 129, 255, 256, 257,
+                                1000, 10'007};
+
+std::string random_chars(size_t const size)
+{
+    // includes lower case and IUPAC characters as well as characters that are no nucleotides
+    return seqan3::test::generate_chars("ACGTacgtUuNnRYSWKMBDHVrysw-*.!Q \xE3\xC3", size, size);
+}
+
+std::vector<seqan3::detail::simd_instruction_set> supported_instruction_sets()
+{
+    using set_t = seqan3::detail::simd_instruction_set;
+
+    std::vector<set_t> sets{};
+    for (set_t set : {set_t::generic, set_t::sse4, set_t::avx2})
+        if (set <= seqan3::detail::runtime_simd_instruction_set())
+            sets.push_back(set);
+
+    return sets;
+}
+
+TEST(dna4_operations, assign_chars_to_vector)
+{
+    for (size_t size : sizes)
+    {
+        std::string const chars = random_chars(size);
+        std::vector<seqan3::dna4> const expected = chars | seqan3::views::char_to<seqan3::dna4>
+                                                         | seqan3::views::to<std::vector>;
+
+        std::vector<seqan3::dna4> sequence{"ACGT"_dna4};
+        seqan3::assign_chars_to(chars, sequence);
+        EXPECT_EQ(sequence, expected) << "size: " << size;
+    }
+}
+
+TEST(dna4_operations, assign_chars_to_bitcompressed_vector)
+{
+    for (size_t size : sizes)
+    {
+        std::string const chars = random_chars(size);
+        seqan3::bitcompressed_vector<seqan3::dna4> const expected{chars | seqan3::views::char_to<seqan3::dna4>};
+
+        seqan3::bitcompressed_vector<seqan3::dna4> sequence{"ACGT"_dna4};
+        seqan3::assign_chars_to(chars, sequence);
+        EXPECT_EQ(sequence, expected) << "size: " << size;
+    }
+}
+
+TEST(dna4_operations, assign_ranks_to)
+{
+    for (size_t size : sizes)
+    {
+        std::vector<seqan3::dna4> const letters = random_chars(size) | seqan3::views::char_to<seqan3::dna4>
+                                                                    | seqan3::views::to<std::vector>;
+        seqan3::bitcompressed_vector<seqan3::dna4> const expected{letters};
+
+        seqan3::bitcompressed_vector<seqan3::dna4> sequence{"ACGT"_dna4};
+        seqan3::assign_ranks_to(letters, sequence);
+        EXPECT_EQ(sequence, expected) << "size: " << size;
+
+        // works on every contiguous range, e.g. a subrange
+        seqan3::assign_ranks_to(std::span{letters}.subspan(0, size / 2), sequence);
+        EXPECT_TRUE(std::ranges::equal(sequence, letters | std::views::take(size / 2))) << "size: " << size;
+    }
+}
+
+TEST(dna4_operations, reverse_complement_vector)
+{
+    for (size_t size : sizes)
+    {
+        std::vector<seqan3::dna4> const original = random_chars(size) | seqan3::views::char_to<seqan3::dna4>
+                                                                      | seqan3::views::to<std::vector>;
+        std::vector<seqan3::dna4> const expected = original | std::views::reverse | seqan3::views::complement
+                                                            | seqan3::views::to<std::vector>;
+
+        std::vector<seqan3::dna4> sequence = original;
+        seqan3::reverse_complement(sequence);
+        EXPECT_EQ(sequence, expected) << "size: " << size;
+
+        seqan3::reverse_complement(std::span{sequence});
+        EXPECT_EQ(sequence, original) << "size: " << size;
+    }
+}
+
+TEST(dna4_operations, reverse_complement_bitcompressed_vector)
+{
+    for (size_t size : sizes)
+    {
+        seqan3::bitcompressed_vector<seqan3::dna4> const original{random_chars(size)
+                                                                  | seqan3::views::char_to<seqan3::dna4>};
+        seqan3::bitcompressed_vector<seqan3::dna4> const expected{original | std::views::reverse
+                                                                           | seqan3::views::complement};
+
+        seqan3::bitcompressed_vector<seqan3::dna4> sequence = original;
+        seqan3::reverse_complement(sequence);
+        EXPECT_EQ(sequence, expected) << "size: " << size;
+
+        seqan3::reverse_complement(sequence);
+        EXPECT_EQ(sequence, original) << "size: " << size;
+    }
+}
+
+TEST(dna4_operations, all_instruction_sets)
+{
+    for (seqan3::detail::simd_instruction_set instruction_set : supported_instruction_sets())
+    {
+        for (size_t size : sizes)
+        {
+            std::string const chars = random_chars(size);
+            seqan3::bitcompressed_vector<seqan3::dna4> const expected{chars | seqan3::views::char_to<seqan3::dna4>
+                                                                            | std::views::reverse
+                                                                            | seqan3::views::complement};
+            std::vector<uint8_t> ranks(size);
+            seqan3::bitcompressed_vector<seqan3::dna4> sequence{};
+            sequence.resize(size);
+
+            seqan3::detail::invoke_simd_kernel<uint8_t>([&] (auto simd_type)
+            {
+                using simd_t = typename decltype(simd_type)::type;
+                seqan3::detail::dna4_chars_to_ranks<simd_t>(chars.data(), ranks.data(), size);
+                seqan3::detail::dna4_reverse_complement_ranks<simd_t>(ranks.data(), size);
+                seqan3::detail::dna4_pack<simd_t>(nullptr, ranks.data(), sequence.raw_data().data(), size);
+            }, instruction_set);
+            EXPECT_EQ(sequence, expected) << "size: " << size;
+
+            seqan3::detail::invoke_simd_kernel<uint8_t>([&] (auto simd_type)
+            {
+                using simd_t = typename decltype(simd_type)::type;
+                seqan3::detail::dna4_pack<simd_t>(chars.data(), nullptr, sequence.raw_data().data(), size);
+                if (size > 0)
+                    seqan3::detail::dna4_reverse_complement_packed<simd_t>(sequence.raw_data().data(), size);
+            }, instruction_set);
+            EXPECT_EQ(sequence, expected) << "size: " << size;
+        }
+    }
+}
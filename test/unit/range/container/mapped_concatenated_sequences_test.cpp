@@ -0,0 +1,192 @@
+// -----------------------------------------------------------------------------------------------------
+// Copyright (c) 2006-2020, Knut Reinert & Freie Universität Berlin
+// Copyright (c) 2016-2020, Knut Reinert & MPI für molekulare Genetik
+// This file may be used, modified and/or redistributed under the terms of the 3-clause BSD-License
+// shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
+// -----------------------------------------------------------------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
+#include <seqan3/alphabet/nucleotide/dna5.hpp>
+#include <seqan3/range/container/bitcompressed_vector.hpp>
+#include <seqan3/range/container/concatenated_sequences.hpp>
+#include <seqan3/range/container/mapped_concatenated_sequences.hpp>
+#include <seqan3/std/ranges>
+#include <seqan3/test/expect_range_eq.hpp>
+#include <seqan3/test/tmp_filename.hpp>
+
+using seqan3::operator""_aa27;
+using seqan3::operator""_dna4;
+
+std::string file_content(std::filesystem::path const & path)
+{
+    std::ifstream stream{path, std::ios::binary};
+    return std::string{std::istreambuf_iterator<char>{stream}, std::istreambuf_iterator<char>{}};
+}
+
+void write_file(std::filesystem::path const & path, std::string const & content)
+{
+    std::ofstream stream{path, std::ios::binary};
+    stream << content;
+}
+
+// 50 sequences with sizes 0, 7, 14, ... so the sequences start at all offsets of a packed word
+seqan3::concatenated_sequences<seqan3::bitcompressed_vector<seqan3::dna4>> dna4_sequences()
+{
+    seqan3::concatenated_sequences<seqan3::bitcompressed_vector<seqan3::dna4>> sequences{};
+    for (size_t i = 0; i < 50; ++i)
+    {
+        seqan3::bitcompressed_vector<seqan3::dna4> sequence{};
+        for (size_t j = 0; j < 7 * i; ++j)
+            sequence.push_back(seqan3::assign_rank_to((i * j + j / 3) % 4, seqan3::dna4{}));
+        sequences.push_back(sequence);
+    }
+    return sequences;
+}
+
+TEST(mapped_concatenated_sequences, concepts)
+{
+    using mapped_t = seqan3::mapped_concatenated_sequences<seqan3::dna4>;
+    using sequence_t = std::ranges::range_reference_t<mapped_t>;
+
+    EXPECT_TRUE(std::ranges::random_access_range<mapped_t>);
+    EXPECT_TRUE(std::ranges::sized_range<mapped_t>);
+    EXPECT_TRUE(std::ranges::random_access_range<sequence_t>);
+    EXPECT_TRUE(std::ranges::sized_range<sequence_t>);
+    EXPECT_TRUE(std::ranges::view<sequence_t>);
+    EXPECT_TRUE((std::same_as<std::ranges::range_value_t<sequence_t>, seqan3::dna4>));
+}
+
+TEST(mapped_concatenated_sequences, concatenated_sequences)
+{
+    auto const sequences = dna4_sequences();
+    seqan3::test::tmp_filename filename{"sequences.mapped"};
+    seqan3::write_mapped_sequences(filename.get_path(), sequences);
+
+    seqan3::mapped_concatenated_sequences<seqan3::dna4> mapped{filename.get_path()};
+    ASSERT_EQ(mapped.size(), sequences.size());
+    EXPECT_EQ(mapped.concat_size(), sequences.concat_size());
+    EXPECT_FALSE(mapped.empty());
+
+    for (size_t i = 0; i < sequences.size(); ++i)
+        EXPECT_RANGE_EQ(mapped[i], sequences[i]);
+
+    EXPECT_RANGE_EQ(mapped.front(), sequences.front());
+    EXPECT_RANGE_EQ(mapped.back(), sequences.back());
+    EXPECT_RANGE_EQ(mapped.at(3), sequences[3]);
+    EXPECT_THROW(mapped.at(sequences.size()), std::out_of_range);
+
+    size_t count{};
+    for (auto && sequence : mapped)
+        EXPECT_EQ(std::ranges::size(sequence), sequences[count++].size());
+    EXPECT_EQ(count, sequences.size());
+}
+
+TEST(mapped_concatenated_sequences, range_of_ranges)
+{
+    std::vector<std::vector<seqan3::aa27>> const sequences{"MKWVTFISLL"_aa27, ""_aa27, "ACDEFGHIKLMNPQRSTVWY*"_aa27};
+    seqan3::test::tmp_filename filename{"sequences.mapped"};
+    seqan3::write_mapped_sequences(filename.get_path(), sequences);
+
+    seqan3::mapped_concatenated_sequences<seqan3::aa27> mapped{filename.get_path()};
+    ASSERT_EQ(mapped.size(), 3u);
+    EXPECT_EQ(mapped.concat_size(), 31u);
+    EXPECT_RANGE_EQ(mapped[0], sequences[0]);
+    EXPECT_TRUE(std::ranges::empty(mapped[1]));
+    EXPECT_RANGE_EQ(mapped[2], sequences[2]);
+}
+
+TEST(mapped_concatenated_sequences, same_file_for_all_inputs)
+{
+    auto const sequences = dna4_sequences();
+    std::vector<std::vector<seqan3::dna4>> vectors{};
+    for (auto && sequence : sequences)
+        vectors.emplace_back(sequence.begin(), sequence.end());
+
+    seqan3::test::tmp_filename packed_file{"packed.mapped"};
+    seqan3::test::tmp_filename vector_file{"vector.mapped"};
+    seqan3::write_mapped_sequences(packed_file.get_path(), sequences);
+    seqan3::write_mapped_sequences(vector_file.get_path(), vectors);
+    EXPECT_EQ(file_content(packed_file.get_path()), file_content(vector_file.get_path()));
+
+    // a mapped file can be written back to the file it is mapped from
+    seqan3::mapped_concatenated_sequences<seqan3::dna4> mapped{vector_file.get_path()};
+    seqan3::write_mapped_sequences(vector_file.get_path(), mapped);
+    EXPECT_EQ(file_content(packed_file.get_path()), file_content(vector_file.get_path()));
+    EXPECT_RANGE_EQ(mapped[10], sequences[10]);
+}
+
+TEST(mapped_concatenated_sequences, empty)
+{
+    seqan3::mapped_concatenated_sequences<seqan3::dna4> default_constructed{};
+    EXPECT_TRUE(default_constructed.empty());
+    EXPECT_EQ(default_constructed.concat_size(), 0u);
+    EXPECT_TRUE(default_constructed.begin() == default_constructed.end());
+
+    seqan3::test::tmp_filename filename{"empty.mapped"};
+    seqan3::write_mapped_sequences(filename.get_path(), std::vector<std::vector<seqan3::dna4>>{});
+
+    seqan3::mapped_concatenated_sequences<seqan3::dna4> mapped{filename.get_path()};
+    EXPECT_TRUE(mapped.empty());
+    EXPECT_EQ(mapped.concat_size(), 0u);
+}
+
+TEST(mapped_concatenated_sequences, copies_share_the_mapping)
+{
+    auto const sequences = dna4_sequences();
+    seqan3::test::tmp_filename filename{"sequences.mapped"};
+    seqan3::write_mapped_sequences(filename.get_path(), sequences);
+
+    seqan3::mapped_concatenated_sequences<seqan3::dna4> copy{};
+    std::ranges::range_reference_t<decltype(copy)> sequence{};
+    {
+        seqan3::mapped_concatenated_sequences<seqan3::dna4> mapped{filename.get_path()};
+        copy = mapped;
+        sequence = mapped[20];
+    }
+
+    // the sequence stays valid as long as the copy exists
+    EXPECT_RANGE_EQ(sequence, sequences[20]);
+    EXPECT_RANGE_EQ(copy[20], sequences[20]);
+}
+
+TEST(mapped_concatenated_sequences, invalid_files)
+{
+    seqan3::test::tmp_filename filename{"sequences.mapped"};
+    seqan3::write_mapped_sequences(filename.get_path(), dna4_sequences());
+    std::string const content = file_content(filename.get_path());
+
+    seqan3::test::tmp_filename invalid{"invalid.mapped"};
+    using mapped_t = seqan3::mapped_concatenated_sequences<seqan3::dna4>;
+
+    EXPECT_THROW(mapped_t{invalid.get_path()}, seqan3::file_open_error); // does not exist
+
+    write_file(invalid.get_path(), content.substr(0, 20)); // shorter than the header
+    EXPECT_THROW(mapped_t{invalid.get_path()}, seqan3::parse_error);
+
+    write_file(invalid.get_path(), content.substr(0, content.size() - 1)); // truncated
+    EXPECT_THROW(mapped_t{invalid.get_path()}, seqan3::parse_error);
+
+    write_file(invalid.get_path(), content + std::string(8, '\0')); // trailing data
+    EXPECT_THROW(mapped_t{invalid.get_path()}, seqan3::parse_error);
+
+    std::string wrong_magic = content;
+    wrong_magic[0] = 'X';
+    write_file(invalid.get_path(), wrong_magic);
+    EXPECT_THROW(mapped_t{invalid.get_path()}, seqan3::parse_error);
+
+    std::string wrong_delimiter = content;
+    wrong_delimiter[sizeof(seqan3::detail::mapped_sequences_header) + 8 * 10 + 7] = 0x40; // sequence 10 begins late
+    write_file(invalid.get_path(), wrong_delimiter);
+    EXPECT_THROW(mapped_t{invalid.get_path()}, seqan3::parse_error);
+
+    // written for seqan3::dna4 (2 bit), but read as seqan3::dna5 (3 bit)
+    EXPECT_THROW(seqan3::mapped_concatenated_sequences<seqan3::dna5>{filename.get_path()}, seqan3::parse_error);
+}
@@ -9,6 +9,7 @@
 #include <list>
 #include <type_traits>
 
+#include <seqan3/alphabet/aminoacid/aa27.hpp>
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/alphabet/nucleotide/dna5.hpp>
 #include <seqan3/range/container/bitcompressed_vector.hpp>
@@ -225,3 +226,48 @@ TYPED_TEST(kmer_hash_gapped_test, issue1754)
         EXPECT_NO_THROW(text1 | prefix_until_first_thymine | std::views::reverse | gapped_view);
     }
 }
+
+template <typename alphabet_t>
+void expect_rolled_hashes_equal_recomputed_hashes(seqan3::shape const & shape_)
+{
+    std::vector<alphabet_t> text(300);
+    for (size_t i = 0; i < text.size(); ++i)
+        seqan3::assign_rank_to((i * 7 + i / 13) % seqan3::alphabet_size<alphabet_t>, text[i]);
+
+    auto hashes = text | seqan3::views::kmer_hash(shape_);
+    size_t i{0};
+
+    // Incrementing rolls the hash value, the subscript operator recomputes it.
+    for (auto it = hashes.begin(); it != hashes.end(); ++it, ++i)
+        EXPECT_EQ(*it, hashes[i]) << "position " << i;
+
+    EXPECT_EQ(i, hashes.size());
+
+    // Decrementing recomputes the hash value and must keep the iterator consistent for further increments.
+    auto it = std::ranges::next(hashes.begin(), 10);
+    --it;
+    ++it;
+    ++it;
+    EXPECT_EQ(*it, hashes[11]);
+}
+
+TEST(kmer_hash_gapped_test, rolling_hash)
+{
+    for (seqan3::shape const & shape_ : {0b101_shape, 0b1100111011_shape, 0b111010010100110111_shape,
+                                         0b10101010101010101010101010101_shape, 0xFFFFFFFE001_shape})
+    {
+        expect_rolled_hashes_equal_recomputed_hashes<seqan3::dna4>(shape_);
+    }
+
+    for (seqan3::shape const & shape_ : {0b101_shape, 0b1100111011_shape, 0b111010010100110111_shape,
+                                         0b1000000000000000000001_shape})
+    {
+        expect_rolled_hashes_equal_recomputed_hashes<seqan3::dna5>(shape_);
+    }
+
+    for (seqan3::shape const & shape_ : {0b101_shape, 0b1100111011_shape, 0b110000000011_shape,
+                                         0b11101000000011_shape})
+    {
+        expect_rolled_hashes_equal_recomputed_hashes<seqan3::aa27>(shape_);
+    }
+}
@@ -5,8 +5,11 @@
 // shipped with this file and also available at: https://github.com/seqan/seqan3/blob/master/LICENSE.md
 // -----------------------------------------------------------------------------------------------------
 
+#include <algorithm>
 #include <forward_list>
 #include <list>
+#include <numeric>
+#include <random>
 #include <type_traits>
 
 #include <seqan3/alphabet/nucleotide/dna4.hpp>
@@ -143,3 +146,31 @@ TEST_F(minimiser_test, non_arithmetic_value)
     // just compute the minimizer directly on the alphabet
     EXPECT_RANGE_EQ("ACACA"_dna4, text3 | minimiser_view);
 }
+
+TEST_F(minimiser_test, large_window)
+{
+    // compares against the minimum of each window for inputs where the minimum leaves the window in every step
+    // (ascending), every new value is the minimum (descending) and a random permutation; the values are distinct, so
+    // a minimiser is reported exactly when the minimum changes
+    std::vector<size_t> ascending(2000);
+    std::iota(ascending.begin(), ascending.end(), 0u);
+    std::vector<size_t> descending(ascending.rbegin(), ascending.rend());
+    std::vector<size_t> random = ascending;
+    std::shuffle(random.begin(), random.end(), std::mt19937_64{42});
+
+    for (auto const & values : {ascending, descending, random})
+    {
+        for (uint32_t window_size : {2u, 3u, 100u, 1000u, 1999u})
+        {
+            result_t expected{};
+            for (size_t i = 0; i + window_size <= values.size(); ++i)
+            {
+                size_t const minimum = *std::min_element(values.begin() + i, values.begin() + i + window_size);
+                if (expected.empty() || expected.back() != minimum)
+                    expected.push_back(minimum);
+            }
+
+            EXPECT_RANGE_EQ(expected, values | seqan3::views::minimiser(window_size));
+        }
+    }
+}
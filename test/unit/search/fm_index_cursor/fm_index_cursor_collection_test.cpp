@@ -70,3 +70,23 @@ INSTANTIATE_TYPED_TEST_SUITE_P(dna5_default_traits, fm_index_cursor_collection_t
 // char
 using it_t6 = seqan3::fm_index_cursor<seqan3::fm_index<char, seqan3::text_layout::collection>>;
 INSTANTIATE_TYPED_TEST_SUITE_P(char_default_traits, fm_index_cursor_collection_test, it_t6, );
+
+// suffix array sampling
+using it_t7 = seqan3::fm_index_cursor<seqan3::fm_index<seqan3::dna4,
+                                                       seqan3::text_layout::collection,
+                                                       seqan3::sdsl_wt_sampled_index_type<4>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(sa_order_sampling_traits, fm_index_cursor_collection_test, it_t7, );
+
+using it_t8 = seqan3::fm_index_cursor<seqan3::fm_index<seqan3::dna4,
+                                                       seqan3::text_layout::collection,
+                                                       seqan3::sdsl_wt_sampled_index_type<
+                                                           4,
+                                                           sdsl::text_order_sa_sampling<>>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(text_order_sampling_traits, fm_index_cursor_collection_test, it_t8, );
+
+using it_t9 = seqan3::bi_fm_index_cursor<seqan3::bi_fm_index<seqan3::dna4,
+                                                             seqan3::text_layout::collection,
+                                                             seqan3::sdsl_wt_sampled_index_type<
+                                                                 32,
+                                                                 sdsl::text_order_sa_sampling<>>>>;
+INSTANTIATE_TYPED_TEST_SUITE_P(bi_text_order_sampling_traits, fm_index_cursor_collection_test, it_t9, );
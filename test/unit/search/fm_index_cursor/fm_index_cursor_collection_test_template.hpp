@@ -321,6 +321,28 @@ TYPED_TEST_P(fm_index_cursor_collection_test, lazy_locate)
     EXPECT_TRUE(std::ranges::equal(it.locate(), it.lazy_locate()));
 }
 
+TYPED_TEST_P(fm_index_cursor_collection_test, locate_repetitive)
+{
+    // more occurrences than are located in one batch
+    std::vector<typename TestFixture::text_type> text_col(50, this->text1); // {"ACGACG", ..., "ACGACG"}
+
+    typename TypeParam::index_type fm{text_col};
+
+    TypeParam it = TypeParam(fm);
+    it.extend_right(seqan3::views::slice(this->text1, 0, 3));    // "ACG"
+
+    std::vector<std::pair<uint64_t, uint64_t>> expected{};
+    for (uint64_t i = 0; i < 50; ++i)
+    {
+        expected.emplace_back(i, 0);
+        expected.emplace_back(i, 3);
+    }
+
+    EXPECT_EQ(it.count(), 100u);
+    EXPECT_EQ(seqan3::uniquify(it.locate()), expected);
+    EXPECT_TRUE(std::ranges::equal(it.locate(), it.lazy_locate()));
+}
+
 TYPED_TEST_P(fm_index_cursor_collection_test, extend_const_char_pointer)
 {
     using alphabet_type = typename TestFixture::alphabet_type;
@@ -350,4 +372,4 @@ TYPED_TEST_P(fm_index_cursor_collection_test, concept_check)
 REGISTER_TYPED_TEST_SUITE_P(fm_index_cursor_collection_test, ctr, begin, extend_right_range,
                             extend_right_range_empty_text, extend_right_char, extend_right_range_and_cycle,
                             extend_right_char_and_cycle, extend_right_and_cycle, query, last_rank, incomplete_alphabet,
-                            lazy_locate, extend_const_char_pointer, concept_check);
+                            lazy_locate, locate_repetitive, extend_const_char_pointer, concept_check);
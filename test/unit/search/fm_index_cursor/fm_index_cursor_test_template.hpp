@@ -292,6 +292,51 @@ TYPED_TEST_P(fm_index_cursor_test, lazy_locate)
     EXPECT_TRUE(std::ranges::equal(it.locate(), it.lazy_locate()));
 }
 
+TYPED_TEST_P(fm_index_cursor_test, locate_repetitive)
+{
+    // more occurrences than are located in one batch
+    typename TestFixture::text_type text{};
+    for (size_t i = 0; i < 100; ++i)
+        text.insert(text.end(), this->text1.begin(), this->text1.end()); // "ACGACG"...
+
+    typename TypeParam::index_type fm{text};
+
+    TypeParam it = TypeParam(fm);
+    it.extend_right(seqan3::views::slice(this->text1, 0, 3));   // "ACG"
+
+    locate_result_t expected{};
+    for (uint64_t i = 0; i < 200; ++i)
+        expected.emplace_back(0, 3 * i);
+
+    EXPECT_EQ(it.count(), 200u);
+    EXPECT_EQ(seqan3::uniquify(it.locate()), expected);
+    EXPECT_TRUE(std::ranges::equal(it.locate(), it.lazy_locate()));
+}
+
+TYPED_TEST_P(fm_index_cursor_test, locate_partial)
+{
+    typename TestFixture::text_type text{};
+    for (size_t i = 0; i < 100; ++i)
+        text.insert(text.end(), this->text1.begin(), this->text1.end()); // "ACGACG"...
+
+    typename TypeParam::index_type fm{text};
+
+    TypeParam it = TypeParam(fm);
+    it.extend_right(seqan3::views::slice(this->text1, 0, 3));   // "ACG"
+
+    locate_result_t all = it.locate();
+    locate_result_t pages{};
+    for (uint64_t first = 0; first < it.count(); first += 33)
+    {
+        locate_result_t page = it.locate(first, std::min<uint64_t>(33, it.count() - first));
+        pages.insert(pages.end(), page.begin(), page.end());
+    }
+
+    EXPECT_EQ(pages, all);
+    EXPECT_TRUE(it.locate(0, 0).empty());
+    EXPECT_EQ(it.locate(199, 1), (locate_result_t{all[199]}));
+}
+
 TYPED_TEST_P(fm_index_cursor_test, concept_check)
 {
     EXPECT_TRUE(seqan3::fm_index_cursor_specialisation<TypeParam>);
@@ -299,4 +344,5 @@ TYPED_TEST_P(fm_index_cursor_test, concept_check)
 
 REGISTER_TYPED_TEST_SUITE_P(fm_index_cursor_test, ctr, begin, extend_right_range, extend_right_char,
                             extend_right_range_and_cycle, extend_right_char_and_cycle, extend_right_and_cycle, query,
-                            last_rank, incomplete_alphabet, lazy_locate, concept_check);
+                            last_rank, incomplete_alphabet, lazy_locate, locate_repetitive, locate_partial,
+                            concept_check);
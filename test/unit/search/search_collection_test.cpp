@@ -169,6 +169,19 @@ TYPED_TEST(search_test, multiple_queries)
     EXPECT_RANGE_EQ(search(queries, this->index, cfg) | query_id, expected_query_ids);
 }
 
+TYPED_TEST(search_test, verification)
+{
+    typename TestFixture::hits_result_t expected_hits{{0, 0}, {0, 4}, {0, 8}, {1, 0}, {1, 4}, {1, 8}}; //{refid, pos}
+    // The occurrences with a deleted A overlap the error-free ones.
+    typename TestFixture::hits_result_t expected_overlapping_hits{{0, 0}, {0, 1}, {0, 4}, {0, 5}, {0, 8}, {0, 9},
+                                                                  {1, 0}, {1, 1}, {1, 4}, {1, 5}, {1, 8}, {1, 9}};
+
+    seqan3::configuration const cfg = seqan3::search_cfg::max_error{seqan3::search_cfg::total{1}} |
+                                      seqan3::search_cfg::verification{this->text};
+    EXPECT_RANGE_EQ(search("ACGT"_dna4, this->index, cfg) | ref_id_and_position, expected_overlapping_hits);
+    EXPECT_RANGE_EQ(search("ACTT"_dna4, this->index, cfg) | ref_id_and_position, expected_hits);
+}
+
 TYPED_TEST(search_string_test, error_free_string)
 {
     typename TestFixture::hits_result_t empty_result{};
@@ -329,3 +329,45 @@ TEST(search_scheme_test, search_scheme_edit)
     test_search_scheme_edit(seqan3::detail::optimum_search_scheme<0, 2>, seed, 10);
     test_search_scheme_edit(seqan3::detail::optimum_search_scheme<0, 3>, seed, 10);
 }
+
+TEST(search_scheme_test, computed_search_scheme_edit)
+{
+    size_t seed = 42;
+    seqan3::dna4_vector text = seqan3::test::generate_sequence<seqan3::dna4>(1000, 0/*variance*/, seed);
+    seqan3::bi_fm_index index(text);
+
+    for (uint8_t max_error = 4; max_error <= 5; ++max_error)
+    {
+        auto const search_scheme = seqan3::detail::compute_ss(0, max_error);
+        seqan3::detail::search_param error_left{max_error, max_error, 1, 1};
+
+        for (uint64_t query_length = max_error + 1; query_length < 14; ++query_length)
+        {
+            seqan3::dna4_vector query = seqan3::test::generate_sequence<seqan3::dna4>(query_length, 0, seed);
+
+            std::vector<uint64_t> hits_trivial, hits_ss;
+
+            auto delegate_trivial = [&hits_trivial] (auto const & it)
+            {
+                for (auto && res : it.locate())
+                    hits_trivial.push_back(res.second);
+            };
+
+            auto delegate_ss = [&hits_ss] (auto const & it)
+            {
+                for (auto && res : it.locate())
+                    hits_ss.push_back(res.second);
+            };
+
+            auto const blocks_length = seqan3::detail::optimum_blocks_length(search_scheme, query_length, 4, 1000);
+            auto const block_info = seqan3::detail::search_scheme_block_info(search_scheme, blocks_length);
+
+            // Find all hits using search schemes.
+            seqan3::detail::search_ss<false>(index, query, error_left, search_scheme, block_info, delegate_ss);
+            // Find all hits using trivial backtracking.
+            seqan3::detail::test_accessor::search_trivial<false>(index, query, error_left, delegate_trivial);
+
+            EXPECT_EQ(seqan3::uniquify(hits_ss), seqan3::uniquify(hits_trivial));
+        }
+    }
+}
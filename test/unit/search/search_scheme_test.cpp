@@ -6,6 +6,7 @@
 // -----------------------------------------------------------------------------------------------------
 
 #include <algorithm>
+#include <numeric>
 #include <type_traits>
 
 #include "helper_search_scheme.hpp"
@@ -142,3 +143,55 @@ TEST(search_scheme_test, error_distribution_disjoint_optimum_search_schemes)
     ret = check_disjoint_search_scheme<0, 3, false>();
     EXPECT_TRUE(ret);
 }
+
+TEST(search_scheme_test, optimum_blocks_length)
+{
+    for (uint8_t max_error = 0; max_error <= 6; ++max_error)
+    {
+        auto const search_scheme = seqan3::detail::compute_ss(0, max_error);
+
+        for (size_t query_length : {size_t{max_error + 1u}, size_t{50}, size_t{150}})
+        {
+            auto const blocks_length = seqan3::detail::optimum_blocks_length(search_scheme, query_length, 4, 1e9);
+
+            EXPECT_EQ(blocks_length.size(), max_error + 1u);
+            EXPECT_EQ(std::accumulate(blocks_length.begin(), blocks_length.end(), size_t{0}), query_length);
+            EXPECT_TRUE(std::ranges::all_of(blocks_length, [] (size_t const length) { return length > 0; }));
+
+            // never worse than blocks of equal length
+            std::vector<size_t> uniform_blocks_length(max_error + 1, query_length / (max_error + 1));
+            for (size_t i = 0; i < query_length % (max_error + 1); ++i)
+                ++uniform_blocks_length[i];
+
+            EXPECT_LE(seqan3::detail::search_scheme_cost(search_scheme, blocks_length, 4, 1e9),
+                      seqan3::detail::search_scheme_cost(search_scheme, uniform_blocks_length, 4, 1e9));
+        }
+    }
+}
+
+TEST(search_scheme_test, scale_blocks_length)
+{
+    std::vector<size_t> const blocks_length{5, 1, 3, 7};
+
+    EXPECT_EQ(seqan3::detail::scale_blocks_length(blocks_length, 16), blocks_length);
+    EXPECT_EQ(seqan3::detail::scale_blocks_length(blocks_length, 32), (std::vector<size_t>{10, 2, 6, 14}));
+
+    for (size_t query_length = 16; query_length < 200; ++query_length)
+    {
+        auto const scaled_blocks_length = seqan3::detail::scale_blocks_length(blocks_length, query_length);
+
+        EXPECT_EQ(scaled_blocks_length.size(), blocks_length.size());
+        EXPECT_EQ(std::accumulate(scaled_blocks_length.begin(), scaled_blocks_length.end(), size_t{0}), query_length);
+        EXPECT_TRUE(std::ranges::all_of(scaled_blocks_length, [] (size_t const length) { return length > 0; }));
+    }
+}
+
+TEST(search_scheme_test, search_scheme_cost)
+{
+    auto const search_scheme = seqan3::detail::compute_ss(0, 4);
+    std::vector<size_t> blocks_length(5, 10);
+
+    // larger texts are more expensive
+    EXPECT_LT(seqan3::detail::search_scheme_cost(search_scheme, blocks_length, 4, 1e6),
+              seqan3::detail::search_scheme_cost(search_scheme, blocks_length, 4, 1e9));
+}
@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <type_traits>
 
+#include <seqan3/alphabet/nucleotide/dna4.hpp>
 #include <seqan3/range/views/persist.hpp>
 #include <seqan3/search/all.hpp>
 #include <seqan3/search/fm_index/bi_fm_index.hpp>
@@ -377,6 +378,156 @@ TYPED_TEST(search_test, search_strategy_strata)
     // }
 }
 
+TYPED_TEST(search_test, verification)
+{
+    {
+        // hits overlapping a hit with fewer errors (1, 5, 9) are reported as well
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error{seqan3::search_cfg::total{1}} |
+                                          seqan3::search_cfg::verification{this->text};
+        EXPECT_RANGE_EQ(search("ACGT"_dna4, this->index, cfg) | position, (std::vector{0, 1, 4, 5, 8, 9}));
+        EXPECT_RANGE_EQ(search("AAAA"_dna4, this->index, cfg) | position, (std::vector<int>{})); // no hit
+    }
+
+    {
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error{seqan3::search_cfg::total{1}} |
+                                          seqan3::search_cfg::hit_single_best |
+                                          seqan3::search_cfg::verification{this->text};
+        std::vector possible_hits{0, 4, 8};
+        std::vector result = search("ACGT"_dna4, this->index, cfg) | position | seqan3::views::to<std::vector>;
+        ASSERT_EQ(result.size(), 1u);
+        EXPECT_TRUE(std::find(possible_hits.begin(), possible_hits.end(), result[0]) != possible_hits.end());
+    }
+
+    {
+        // a substitution and a deletion: CGT[T->A]GCA[G]TC
+        seqan3::dna4_vector text{"AAAAAAAAAACGTTGCAGTCAAAAAAAAAA"_dna4};
+        TypeParam index{text};
+
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error{seqan3::search_cfg::total{2}} |
+                                          seqan3::search_cfg::verification{text};
+        EXPECT_RANGE_EQ(search("CGTAGCATC"_dna4, index, cfg) | position, (std::vector{10}));
+
+        seqan3::configuration const cfg_one_error = seqan3::search_cfg::max_error{seqan3::search_cfg::total{1}} |
+                                                    seqan3::search_cfg::verification{text};
+        EXPECT_RANGE_EQ(search("CGTAGCATC"_dna4, index, cfg_one_error) | position, (std::vector<int>{}));
+    }
+
+    {
+        // more errors than the query is long: every reference sequence is a candidate
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error{seqan3::search_cfg::total{3}} |
+                                          seqan3::search_cfg::hit_single_best |
+                                          seqan3::search_cfg::verification{this->text};
+        EXPECT_EQ((search("GG"_dna4, this->index, cfg) | position | seqan3::views::to<std::vector>).size(), 1u);
+    }
+}
+
+TYPED_TEST(search_test, verification_in_periodic_text)
+{
+    // Occurrences in periodic text overlap each other. The verification reports the same text positions as the
+    // backtracking.
+    seqan3::dna4_vector const period{"ACGTT"_dna4};
+    seqan3::dna4_vector text{};
+    for (size_t i = 0; i < 200; ++i)
+        text.push_back((i % 23 == 0) ? seqan3::complement(period[i % 5]) : period[i % 5]);
+
+    TypeParam index{text};
+
+    std::vector<seqan3::dna4_vector> queries{};
+    for (size_t begin = 0; begin < 60; begin += 7)
+    {
+        queries.emplace_back(text.begin() + begin, text.begin() + begin + 12);
+        queries.emplace_back(queries.back());
+        queries.back()[begin % 12] = seqan3::complement(queries.back()[begin % 12]);
+    }
+
+    for (uint8_t errors = 0; errors <= 3; ++errors)
+    {
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error{seqan3::search_cfg::total{errors}} |
+                                          seqan3::search_cfg::hit_all;
+
+        for (auto const & query : queries)
+        {
+            EXPECT_RANGE_EQ(search(query, index, cfg | seqan3::search_cfg::verification{text}) | position,
+                            search(query, index, cfg) | position);
+        }
+    }
+}
+
+TYPED_TEST(search_test, paged_locate)
+{
+    auto sorted_positions = [] (auto && results)
+    {
+        std::vector result = results | position | seqan3::views::to<std::vector>;
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    {
+        seqan3::configuration const cfg = seqan3::search_cfg::page_size{2};
+        EXPECT_RANGE_EQ(sorted_positions(search("ACGT"_dna4, this->index, cfg)), (std::vector{0, 4, 8}));
+        EXPECT_RANGE_EQ(search("ACGG"_dna4, this->index, cfg) | position, (std::vector<int>{}));
+        EXPECT_THROW(search("ACGT"_dna4, this->index, seqan3::search_cfg::page_size{0}), std::invalid_argument);
+    }
+
+    {
+        // results of consecutive queries are not mixed up
+        seqan3::configuration const cfg = seqan3::search_cfg::page_size{1};
+        std::vector<seqan3::dna4_vector> queries{"ACGT"_dna4, "ACGG"_dna4, "GTA"_dna4};
+        EXPECT_RANGE_EQ(search(queries, this->index, cfg) | query_id, (std::vector{0, 0, 0, 2, 2}));
+    }
+
+    {
+        // a position might be reported more than once
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error{seqan3::search_cfg::total{1}} |
+                                          seqan3::search_cfg::page_size{1};
+        std::vector result = sorted_positions(search("ACGT"_dna4, this->index, cfg));
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+        EXPECT_RANGE_EQ(result, (std::vector{0, 1, 4, 5, 8, 9}));
+    }
+}
+
+TYPED_TEST(search_test, max_hits)
+{
+    std::vector possible_hits{0, 4, 8};
+
+    for (auto const & cfg : {seqan3::search_cfg::max_hits{2} | seqan3::search_cfg::page_size{1},
+                             seqan3::search_cfg::max_hits{2} | seqan3::search_cfg::page_size{5}})
+    {
+        std::vector result = search("ACGT"_dna4, this->index, cfg) | position | seqan3::views::to<std::vector>;
+        ASSERT_EQ(result.size(), 2u);
+        for (auto pos : result)
+            EXPECT_TRUE(std::find(possible_hits.begin(), possible_hits.end(), pos) != possible_hits.end());
+    }
+
+    {
+        seqan3::configuration const cfg = seqan3::search_cfg::max_hits{2};
+        std::vector result = search("ACGT"_dna4, this->index, cfg) | position | seqan3::views::to<std::vector>;
+        ASSERT_EQ(result.size(), 2u);
+        for (auto pos : result)
+            EXPECT_TRUE(std::find(possible_hits.begin(), possible_hits.end(), pos) != possible_hits.end());
+    }
+}
+
+TYPED_TEST(search_test, max_hits_with_overlapping_cursors)
+{
+    // The cursors of the approximate search locate some text positions more than once.
+    std::vector possible_hits{0, 1, 4, 5, 8, 9};
+
+    for (size_t hits = 1; hits <= possible_hits.size() + 1; ++hits)
+    {
+        seqan3::configuration const cfg = seqan3::search_cfg::max_error{seqan3::search_cfg::total{1}} |
+                                          seqan3::search_cfg::max_hits{hits};
+        std::vector result = search("ACGT"_dna4, this->index, cfg) | position | seqan3::views::to<std::vector>;
+
+        // Only unique text positions count towards the limit.
+        EXPECT_EQ(result.size(), std::min(hits, possible_hits.size()));
+        EXPECT_TRUE(std::is_sorted(result.begin(), result.end()));
+        EXPECT_TRUE(std::adjacent_find(result.begin(), result.end()) == result.end());
+        for (auto pos : result)
+            EXPECT_TRUE(std::find(possible_hits.begin(), possible_hits.end(), pos) != possible_hits.end());
+    }
+}
+
 TYPED_TEST(search_string_test, error_free_string)
 {
     // successful and unsuccesful exact search without cfg